@@ -34,6 +34,11 @@ SHARED_LIB_FLAG = "-shared "
 
 DEBUG_FOLDER = "Debug"
 
+# The offline decoder (command line tool), it shares these plugin sources
+CLI_NAME = "AbccSpiDecode"
+CLI_SOURCE_FOLDER = "source/cli"
+CLI_SHARED_SOURCES = ["AbccByteArena.cpp", "AbccCrc.cpp", "AbccDecoder.cpp", "AbccExportWriter.cpp", "AbccJitterAnalyzer.cpp", "AbccLatencyStatistics.cpp", "AbccMessageTable.cpp", "AbccProcessDataFilter.cpp", "AbccSpiAnalyzerExport.cpp", "AbccSpiAnalyzerLookup.cpp", "AbccTransactionIndex.cpp"]
+
 # Specify the search paths/dependencies/options for gcc
 INCLUDE_PATHS = ["./sdk/release/include"]
 LINK_PATHS = ["./sdk/release/lib"]
@@ -314,9 +319,67 @@ def _gnu_build(release_path: str, release_path32: str = None, dylib_ext: str = L
             retcode = os.system(debug_command)
             build_error |= _error_returned(retcode)
 
+    build_error |= _gnu_build_cli(release_path, link_dependencies)
+
     exit(build_error)
 
 
+def _gnu_build_cli(release_path: str, link_dependencies: list) -> bool:
+    '''
+    Routine to compile the offline decoder using G++. The shared plugin
+    sources must already be compiled to object files in release_path.
+
+    Parameters
+    ----------
+    release_path: str
+        The output path of the compiled plugin, the offline decoder is
+        written to the same folder.
+    link_dependencies: list
+        The SDK library to link, the decoder uses the SDK's helper routines.
+
+    Returns
+    ----------
+    bool
+        True if an error occurred.
+    '''
+
+    build_error = False
+    # The parallel decode mode runs on a pool of threads
+    compile_flags = f"-O3 -w -c -pthread -std={GNU_CPP_STD} "
+    obj_files = [release_path + cpp_file.replace(CPP_EXT, OBJ_EXT) for cpp_file in CLI_SHARED_SOURCES]
+
+    for cpp_file in glob.glob(CLI_SOURCE_FOLDER + "/*" + CPP_EXT):
+        obj_file = release_path + os.path.basename(cpp_file).replace(CPP_EXT, OBJ_EXT)
+        command = COMPILER
+
+        for path in INCLUDE_PATHS:
+            command += f"-I\"{path}\" "
+
+        command += f"-I\"source\" {compile_flags}-o \"{obj_file}\" \"{cpp_file}\""
+
+        print(command)
+        retcode = os.system(command)
+        build_error |= _error_returned(retcode)
+        obj_files.append(obj_file)
+
+    command = COMPILER + f"-pthread -o \"{release_path}{CLI_NAME}\" "
+
+    for obj_file in obj_files:
+        command += f"\"{obj_file}\" "
+
+    for link_path in LINK_PATHS:
+        command += f"-L\"{link_path}\" -Wl,-rpath,\"{os.path.abspath(link_path)}\" "
+
+    for link_dependency in link_dependencies:
+        command += link_dependency + " "
+
+    print(command)
+    retcode = os.system(command)
+    build_error |= _error_returned(retcode)
+
+    return build_error
+
+
 def _error_returned(ret_code: int) -> bool:
     '''
     Determines if the return code from a system-call indicates an error.
@@ -0,0 +1,97 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccByteArena.cpp
+**    Summary: Append-only byte storage for the payload of aggregated frames.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <cstring>
+
+#include "AbccByteArena.h"
+
+AbccByteArena::AbccByteArena()
+	: mSize(0)
+{
+}
+
+U64 AbccByteArena::Append(const U8* data, U32 length)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	U64 offset = mSize;
+
+	while (length > 0)
+	{
+		U32 pageOffset = (U32)(mSize % BYTE_ARENA_PAGE_SIZE);
+		U32 count = BYTE_ARENA_PAGE_SIZE - pageOffset;
+
+		if ((mSize / BYTE_ARENA_PAGE_SIZE) >= mPages.size())
+		{
+			mPages.emplace_back(new U8[BYTE_ARENA_PAGE_SIZE]);
+		}
+
+		if (count > length)
+		{
+			count = length;
+		}
+
+		memcpy(&mPages[(size_t)(mSize / BYTE_ARENA_PAGE_SIZE)][pageOffset], data, count);
+
+		data += count;
+		length -= count;
+		mSize += count;
+	}
+
+	return offset;
+}
+
+U32 AbccByteArena::Read(U64 offset, U8* data, U32 length) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	U32 bytesRead = 0;
+
+	while ((bytesRead < length) && (offset < mSize))
+	{
+		U32 pageOffset = (U32)(offset % BYTE_ARENA_PAGE_SIZE);
+		U64 count = BYTE_ARENA_PAGE_SIZE - pageOffset;
+
+		if (count > (U64)(length - bytesRead))
+		{
+			count = length - bytesRead;
+		}
+
+		if (count > (mSize - offset))
+		{
+			count = mSize - offset;
+		}
+
+		memcpy(&data[bytesRead], &mPages[(size_t)(offset / BYTE_ARENA_PAGE_SIZE)][pageOffset], (size_t)count);
+
+		bytesRead += (U32)count;
+		offset += count;
+	}
+
+	return bytesRead;
+}
+
+void AbccByteArena::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// The first page is kept, when cleared after each packet no memory is allocated
+	if (mPages.size() > 1)
+	{
+		mPages.resize(1);
+	}
+
+	mSize = 0;
+}
+
+U64 AbccByteArena::GetSize() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	return mSize;
+}
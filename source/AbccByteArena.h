@@ -0,0 +1,73 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccByteArena.h
+**    Summary: Append-only byte storage for the payload of aggregated frames.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_BYTE_ARENA_H
+#define ABCC_BYTE_ARENA_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+
+/* Bytes are stored in pages of this size, so that appending never moves the
+** bytes already stored */
+#define BYTE_ARENA_PAGE_SIZE				65536
+
+/*
+** @brief Stores the bytes of frames that cover more data than fits into the
+**        frame itself. A frame refers to its bytes by the offset returned when
+**        they were appended.
+*/
+class AbccByteArena
+{
+public:
+
+	AbccByteArena();
+
+	/*******************************************************************************
+	** @brief Append a block of bytes.
+	**
+	** @param data - The bytes to store.
+	** @param length - The number of bytes.
+	**
+	** @return The offset of the first byte, used to read the block back.
+	*/
+	U64 Append(const U8* data, U32 length);
+
+	/*******************************************************************************
+	** @brief Read back (part of) a block of bytes.
+	**
+	** @param offset - The offset returned by Append().
+	** @param data - Receives the bytes.
+	** @param length - The number of bytes to read.
+	**
+	** @return The number of bytes read, less than length if reading past the end.
+	*/
+	U32 Read(U64 offset, U8* data, U32 length) const;
+
+	/*******************************************************************************
+	** @brief Discard all bytes, previously returned offsets become invalid.
+	*/
+	void Clear();
+
+	/*******************************************************************************
+	** @brief The number of bytes stored.
+	*/
+	U64 GetSize() const;
+
+protected: // Members
+
+	mutable std::mutex mMutex;
+	std::vector<std::unique_ptr<U8[]>> mPages;
+	U64 mSize;
+};
+
+#endif /* ABCC_BYTE_ARENA_H */
@@ -8,24 +8,215 @@
 *******************************************************************************
 ******************************************************************************/
 
-#include "Analyzer.h"
+#include <cstddef>
+
+#include "LogicPublicTypes.h"
 #include "AbccCrc.h"
 
-static const U8 abBitReverseTable16[] =
+#if ABCC_CRC_ENABLE_CLMUL
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+/* The CRC-32 polynomial, MSB-first */
+#define CRC32_POLYNOMIAL			0x04C11DB7UL
+
+/* The MSB-first state corresponding to the ABCC40 initial CRC of zero */
+#define CRC32_INITIAL_STATE			0xFFFFFFFFUL
+
+/* Number of bytes processed per iteration of the table-driven loop */
+#define CRC32_SLICES				8
+
+/* Shorter buffers are not worth the setup of the carry-less multiplication */
+#define CRC32_CLMUL_MIN_LENGTH		64
+
+typedef struct Crc32Tables
 {
-	0x00, 0x08, 0x04, 0x0C,
-	0x02, 0x0A, 0x06, 0x0E,
-	0x01, 0x09, 0x05, 0x0D,
-	0x03, 0x0B, 0x07, 0x0F
-};
+	// adwTable[n][i] is the CRC of byte i followed by n zero bytes
+	U32 adwTable[CRC32_SLICES][256];
 
-static const U32 adwCrcTable32[] =
+	// Folding constants, x^n mod P, for 512- and 128-bit fold distances
+	U32 dwFold512Hi;	// x^576
+	U32 dwFold512Lo;	// x^512
+	U32 dwFold128Hi;	// x^192
+	U32 dwFold128Lo;	// x^128
+	bool fClmulSupported;
+} Crc32Tables_t;
+
+/* Computes x^n mod P, i.e. the CRC of a one followed by n zero bits */
+static U32 GetXPowModP(U32 n)
 {
-	0x4DBDF21CUL, 0x500AE278UL, 0x76D3D2D4UL, 0x6B64C2B0UL,
-	0x3B61B38CUL, 0x26D6A3E8UL, 0x000F9344UL, 0x1DB88320UL,
-	0xA005713CUL, 0xBDB26158UL, 0x9B6B51F4UL, 0x86DC4190UL,
-	0xD6D930ACUL, 0xCB6E20C8UL, 0xEDB71064UL, 0xF0000000UL
-};
+	U32 dwResult = 1;
+
+	while (n-- > 0)
+	{
+		dwResult = (dwResult << 1) ^ (((dwResult & 0x80000000UL) != 0) ? CRC32_POLYNOMIAL : 0);
+	}
+
+	return dwResult;
+}
+
+#if ABCC_CRC_ENABLE_CLMUL
+static bool IsClmulSupported()
+{
+#if defined(_MSC_VER)
+	int aiRegisters[4];
+
+	__cpuid(aiRegisters, 1);
+
+	// ECX bit 1: PCLMULQDQ, bit 9: SSSE3
+	return ((aiRegisters[2] & (1 << 1)) != 0) && ((aiRegisters[2] & (1 << 9)) != 0);
+#else
+	__builtin_cpu_init();
+
+	return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+#endif
+}
+#endif
+
+static Crc32Tables_t BuildCrc32Tables()
+{
+	Crc32Tables_t sTables;
+
+	for (U32 i = 0; i < 256; i++)
+	{
+		U32 lCrc = i << 24;
+
+		for (U32 bit = 0; bit < 8; bit++)
+		{
+			lCrc = (lCrc << 1) ^ (((lCrc & 0x80000000UL) != 0) ? CRC32_POLYNOMIAL : 0);
+		}
+
+		sTables.adwTable[0][i] = lCrc;
+	}
+
+	for (U32 n = 1; n < CRC32_SLICES; n++)
+	{
+		for (U32 i = 0; i < 256; i++)
+		{
+			U32 lCrc = sTables.adwTable[n - 1][i];
+			sTables.adwTable[n][i] = (lCrc << 8) ^ sTables.adwTable[0][lCrc >> 24];
+		}
+	}
+
+	sTables.dwFold512Hi = GetXPowModP(512 + 64);
+	sTables.dwFold512Lo = GetXPowModP(512);
+	sTables.dwFold128Hi = GetXPowModP(128 + 64);
+	sTables.dwFold128Lo = GetXPowModP(128);
+
+#if ABCC_CRC_ENABLE_CLMUL
+	sTables.fClmulSupported = IsClmulSupported();
+#else
+	sTables.fClmulSupported = false;
+#endif
+
+	return sTables;
+}
+
+static const Crc32Tables_t& GetCrc32Tables()
+{
+	static const Crc32Tables_t sTables = BuildCrc32Tables();
+
+	return sTables;
+}
+
+static U32 Crc32SliceBy8(U32 lCrc, const U8* pbBuffer, size_t iLength, const Crc32Tables_t& sTables)
+{
+	const U32 (*t)[256] = sTables.adwTable;
+
+	while (iLength >= CRC32_SLICES)
+	{
+		lCrc ^= ((U32)pbBuffer[0] << 24) | ((U32)pbBuffer[1] << 16) | ((U32)pbBuffer[2] << 8) | (U32)pbBuffer[3];
+		lCrc = t[7][lCrc >> 24] ^ t[6][(lCrc >> 16) & 0xFF] ^ t[5][(lCrc >> 8) & 0xFF] ^ t[4][lCrc & 0xFF] ^
+			t[3][pbBuffer[4]] ^ t[2][pbBuffer[5]] ^ t[1][pbBuffer[6]] ^ t[0][pbBuffer[7]];
+		pbBuffer += CRC32_SLICES;
+		iLength -= CRC32_SLICES;
+	}
+
+	while (iLength-- > 0)
+	{
+		lCrc = (lCrc << 8) ^ t[0][(lCrc >> 24) ^ *pbBuffer++];
+	}
+
+	return lCrc;
+}
+
+#if ABCC_CRC_ENABLE_CLMUL
+#if defined(_MSC_VER)
+#define CRC32_CLMUL_TARGET
+#else
+#define CRC32_CLMUL_TARGET			__attribute__((target("pclmul,ssse3")))
+#endif
+
+/* Loads 16 bytes with the first byte in the most significant position */
+CRC32_CLMUL_TARGET static inline __m128i LoadBigEndian(const U8* pbBuffer)
+{
+	const __m128i byteSwap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+	return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)pbBuffer), byteSwap);
+}
+
+/* Multiplies the 128-bit remainder by x^n mod P, for the fold distance n the
+** constants were computed for. The result is congruent and at most 96 bits */
+CRC32_CLMUL_TARGET static inline __m128i Fold(__m128i remainder, __m128i constants)
+{
+	return _mm_xor_si128(
+		_mm_clmulepi64_si128(remainder, constants, 0x11),
+		_mm_clmulepi64_si128(remainder, constants, 0x00));
+}
+
+/*
+** Folds the buffer into a 128-bit remainder congruent to it modulo P, four
+** blocks at a time, then takes the CRC of the remainder from the tables. The
+** CRC state is added to the leading 32 bits of the buffer, the remainder is
+** then the buffer polynomial itself, and its CRC from a zero state equals the
+** CRC of the buffer from the initial state.
+*/
+CRC32_CLMUL_TARGET static U32 Crc32Clmul(U32 lCrc, const U8* pbBuffer, size_t iLength, const Crc32Tables_t& sTables)
+{
+	const __m128i fold512 = _mm_set_epi64x((long long)sTables.dwFold512Hi, (long long)sTables.dwFold512Lo);
+	const __m128i fold128 = _mm_set_epi64x((long long)sTables.dwFold128Hi, (long long)sTables.dwFold128Lo);
+	U8 abRemainder[16];
+	__m128i x0 = _mm_xor_si128(LoadBigEndian(pbBuffer), _mm_set_epi32((int)lCrc, 0, 0, 0));
+	__m128i x1 = LoadBigEndian(pbBuffer + 16);
+	__m128i x2 = LoadBigEndian(pbBuffer + 32);
+	__m128i x3 = LoadBigEndian(pbBuffer + 48);
+
+	pbBuffer += 64;
+	iLength -= 64;
+
+	while (iLength >= 64)
+	{
+		x0 = _mm_xor_si128(Fold(x0, fold512), LoadBigEndian(pbBuffer));
+		x1 = _mm_xor_si128(Fold(x1, fold512), LoadBigEndian(pbBuffer + 16));
+		x2 = _mm_xor_si128(Fold(x2, fold512), LoadBigEndian(pbBuffer + 32));
+		x3 = _mm_xor_si128(Fold(x3, fold512), LoadBigEndian(pbBuffer + 48));
+		pbBuffer += 64;
+		iLength -= 64;
+	}
+
+	x0 = _mm_xor_si128(Fold(x0, fold128), x1);
+	x0 = _mm_xor_si128(Fold(x0, fold128), x2);
+	x0 = _mm_xor_si128(Fold(x0, fold128), x3);
+
+	while (iLength >= 16)
+	{
+		x0 = _mm_xor_si128(Fold(x0, fold128), LoadBigEndian(pbBuffer));
+		pbBuffer += 16;
+		iLength -= 16;
+	}
+
+	// Store the remainder back in byte order (the shuffle is its own inverse)
+	_mm_storeu_si128((__m128i*)abRemainder, LoadBigEndian((const U8*)&x0));
+
+	lCrc = Crc32SliceBy8(0, abRemainder, sizeof(abRemainder), sTables);
+
+	return Crc32SliceBy8(lCrc, pbBuffer, iLength, sTables);
+}
+#endif
 
 #if ABCC_CRC_ENABLE_CRC16
 static const U8 abCrc16Hi[] =
@@ -77,9 +268,14 @@ static const U8 abCrc16Lo[] =
 };
 #endif
 
+AbccCrc::AbccCrc()
+{
+	Init();
+}
+
 void AbccCrc::Init()
 {
-	mCrc32 = 0;
+	mCrc32 = CRC32_INITIAL_STATE;
 #if ABCC_CRC_ENABLE_CRC16
 	mCrc16 = 0;
 #endif
@@ -107,22 +303,16 @@ U32 AbccCrc::Crc32()
 
 U32 AbccCrc::CRC_Crc32(U32 iInitCrc, U8* pbBufferStart, U16 iLength)
 {
-	U8 bCrcReverseByte;
-	U32 lCrc = iInitCrc;
+	const Crc32Tables_t& sTables = GetCrc32Tables();
 
-	for (U16 i = 0; i < iLength; i++)
+#if ABCC_CRC_ENABLE_CLMUL
+	if ((iLength >= CRC32_CLMUL_MIN_LENGTH) && sTables.fClmulSupported)
 	{
-		// Process upper-nibble
-		bCrcReverseByte = (U8)(lCrc ^ abBitReverseTable16[(*pbBufferStart >> 4) & 0x0F]);
-		lCrc = (lCrc >> 4) ^ adwCrcTable32[bCrcReverseByte & 0x0F];
-
-		// Process lower-nibble
-		bCrcReverseByte = (U8)(lCrc ^ abBitReverseTable16[(*pbBufferStart >> 0) & 0x0F]);
-		lCrc = (lCrc >> 4) ^ adwCrcTable32[bCrcReverseByte & 0x0F];
-		pbBufferStart++;
+		return Crc32Clmul(iInitCrc, pbBufferStart, iLength, sTables);
 	}
+#endif
 
-	return lCrc;
+	return Crc32SliceBy8(iInitCrc, pbBufferStart, iLength, sTables);
 }
 
 #if ABCC_CRC_ENABLE_CRC16
@@ -149,14 +339,15 @@ U16 AbccCrc::CRC_Crc16(U16 iInitCrc, U8* pbBufferStart, U16 iLength)
 
 U32 AbccCrc::CRC_FormatCrc32(U32 lCrc)
 {
-	return	((U32)abBitReverseTable16[(lCrc & 0x000000F0UL) >> 4]) |
-			((U32)abBitReverseTable16[(lCrc & 0x0000000FUL)]) << 4 |
-			((U32)abBitReverseTable16[(lCrc & 0x0000F000UL) >> 12] << 8) |
-			((U32)abBitReverseTable16[(lCrc & 0x00000F00UL) >> 8] << 12) |
-			((U32)abBitReverseTable16[(lCrc & 0x00F00000UL) >> 20] << 16) |
-			((U32)abBitReverseTable16[(lCrc & 0x000F0000UL) >> 16] << 20) |
-			((U32)abBitReverseTable16[(lCrc & 0xF0000000UL) >> 28] << 24) |
-			((U32)abBitReverseTable16[(lCrc & 0x0F000000UL) >> 24] << 28);
+	// The ABCC40 CRC32 is the bit-reflected CRC-32 of the bit-reversed bytes,
+	// with the bits of each byte of the result reversed. In the MSB-first state
+	// this reduces to inverting the state and swapping its bytes.
+	lCrc = ~lCrc;
+
+	return	((lCrc & 0x000000FFUL) << 24) |
+			((lCrc & 0x0000FF00UL) << 8) |
+			((lCrc & 0x00FF0000UL) >> 8) |
+			((lCrc & 0xFF000000UL) >> 24);
 }
 
 #if ABCC_CRC_ENABLE_CRC16
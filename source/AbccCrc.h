@@ -12,12 +12,21 @@
 #ifndef ABCC_CRC_H
 #define ABCC_CRC_H
 
-#include "Analyzer.h"
+#include "LogicPublicTypes.h"
 
 #ifndef ABCC_CRC_ENABLE_CRC16
 	#define ABCC_CRC_ENABLE_CRC16	FALSE
 #endif
 
+/* Fold long buffers with PCLMULQDQ when the CPU supports it (x86 only) */
+#ifndef ABCC_CRC_ENABLE_CLMUL
+	#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+		#define ABCC_CRC_ENABLE_CLMUL	1
+	#else
+		#define ABCC_CRC_ENABLE_CLMUL	0
+	#endif
+#endif
+
 /*
 ** @brief A helper class for computing the CRC32 for ABCC SPI communication.
 */
@@ -25,6 +34,8 @@ class AbccCrc
 {
 public:
 
+	AbccCrc();
+
 	/*******************************************************************************
 	** @brief Initialize the CRC unit's internal state.
 	*/
@@ -58,12 +69,15 @@ public:
 private:
 
 	/*
-	** @brief Internal CRC32 state.
+	** @brief Internal CRC32 state, kept MSB-first so the table lookups need no
+	**        bit reversal.
 	*/
 	U32 mCrc32;
 
 	/*******************************************************************************
-	** @brief Computes and returns an unformatted CRC32.
+	** @brief Computes and returns an unformatted CRC32. Buffers of at least
+	**        CRC32_CLMUL_MIN_LENGTH bytes are folded with carry-less
+	**        multiplication if supported, others are processed 8 bytes at a time.
 	**
 	** @param  iInitCrc      - The initial CRC32 state.
 	** @param  pbBufferStart - The start of a data buffer which to continue
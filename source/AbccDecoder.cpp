@@ -0,0 +1,2090 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccDecoder.cpp
+**    Summary: SDK-independent ABCC SPI protocol decoder. Consumes acquired
+**             SPI transfers and emits frame and packet events to a sink.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <cstring>
+
+#include "AbccDecoder.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+#define ABCC_MSG_SIZE_FIELD_SIZE		2
+#define ABCC_MSG_RES1_FIELD_SIZE		2
+#define ABCC_MSG_SRC_ID_FIELD_SIZE		1
+#define ABCC_MSG_OBJ_FIELD_SIZE			1
+#define ABCC_MSG_INST_FIELD_SIZE		2
+#define ABCC_MSG_CMD_FIELD_SIZE			1
+#define ABCC_MSG_RES2_FIELD_SIZE		1
+#define ABCC_MSG_CMDEXT_FIELD_SIZE		2
+#define ABCC_MSG_CMDEXT0_FIELD_SIZE		1
+#define ABCC_MSG_CMDEXT1_FIELD_SIZE		1
+#define ABCC_MSG_DATA_FIELD_SIZE		1
+
+/*******************************************************************************
+**
+** Protocol state lookup tables
+**
+*******************************************************************************/
+
+const AbccMosiInfo_t asMosiStates[] =
+{
+	{ AbccMosiStates::Idle,								"",			0 },
+	{ AbccMosiStates::SpiControl,						"SPI_CTL",	1 },
+	{ AbccMosiStates::Reserved1,						"RES",		1 },
+	{ AbccMosiStates::MessageLength,					"MSG_LEN",	2 },
+	{ AbccMosiStates::ProcessDataLength,				"PD_LEN",	2 },
+	{ AbccMosiStates::ApplicationStatus,				"APP_STS",	1 },
+	{ AbccMosiStates::InterruptMask,					"INT_MSK",	1 },
+	{ AbccMosiStates::MessageField,						"MD",		ABCC_MSG_DATA_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Size,				"MSG_SIZE",	ABCC_MSG_SIZE_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Reserved1,			"RES",		ABCC_MSG_RES1_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_SourceId,			"SRC_ID",	ABCC_MSG_SRC_ID_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Object,				"OBJ",		ABCC_MSG_OBJ_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Instance,			"INST",		ABCC_MSG_INST_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Command,				"CMD",		ABCC_MSG_CMD_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Reserved2,			"RES",		ABCC_MSG_RES2_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_CommandExtension,	"EXT",		ABCC_MSG_CMDEXT_FIELD_SIZE },
+	{ AbccMosiStates::MessageField_Data,				"MD",		ABCC_MSG_DATA_FIELD_SIZE },
+	{ AbccMosiStates::WriteProcessData,					"PD",		1 },
+	{ AbccMosiStates::Crc32,							"CRC32",	4 },
+	{ AbccMosiStates::Pad,								"PAD",		2 },
+	{ AbccMosiStates::MessageField_DataNotValid, 		"--",		1 }
+};
+
+const AbccMisoInfo_t asMisoStates[] =
+{
+	{ AbccMisoStates::Idle,								"",			0 },
+	{ AbccMisoStates::Reserved1,						"RES",		1 },
+	{ AbccMisoStates::Reserved2,						"RES",		1 },
+	{ AbccMisoStates::LedStatus,						"LED_STS",	2 },
+	{ AbccMisoStates::AnybusStatus,						"ANB_STS",	1 },
+	{ AbccMisoStates::SpiStatus,						"SPI_STS",	1 },
+	{ AbccMisoStates::NetworkTime,						"TIME",		4 },
+	{ AbccMisoStates::MessageField,						"MD",		ABCC_MSG_DATA_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Size,				"MD_SIZE",	ABCC_MSG_SIZE_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Reserved1,			"RES",		ABCC_MSG_RES1_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_SourceId,			"SRC_ID",	ABCC_MSG_SRC_ID_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Object,				"OBJ",		ABCC_MSG_OBJ_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Instance,			"INST",		ABCC_MSG_INST_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Command,				"CMD",		ABCC_MSG_CMD_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Reserved2,			"RES",		ABCC_MSG_RES2_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_CommandExtension,	"EXT",		ABCC_MSG_CMDEXT_FIELD_SIZE },
+	{ AbccMisoStates::MessageField_Data,				"MD",		ABCC_MSG_DATA_FIELD_SIZE },
+	{ AbccMisoStates::ReadProcessData,					"PD",		1 },
+	{ AbccMisoStates::Crc32,							"CRC32",	4 },
+	{ AbccMisoStates::MessageField_DataNotValid, 		"--",		1 }
+
+};
+
+const AbccMsgInfo_t asMsgStates[] =
+{
+	{ AbccMsgField::Size,				"MD_SIZE",	ABCC_MSG_SIZE_FIELD_SIZE },
+	{ AbccMsgField::Reserved1,			"RES",		ABCC_MSG_RES1_FIELD_SIZE },
+	{ AbccMsgField::SourceId,			"SRC_ID",	ABCC_MSG_SRC_ID_FIELD_SIZE },
+	{ AbccMsgField::Object,				"OBJ",		ABCC_MSG_OBJ_FIELD_SIZE },
+	{ AbccMsgField::Instance,			"INST",		ABCC_MSG_INST_FIELD_SIZE },
+	{ AbccMsgField::Command,			"CMD",		ABCC_MSG_CMD_FIELD_SIZE },
+	{ AbccMsgField::Reserved2,			"RES",		ABCC_MSG_RES2_FIELD_SIZE },
+	{ AbccMsgField::CommandExtension,	"EXT",		ABCC_MSG_CMDEXT_FIELD_SIZE },
+	{ AbccMsgField::Data,				"MD",		ABCC_MSG_DATA_FIELD_SIZE }
+};
+
+bool IsErrorPacketType(PacketType packet_type)
+{
+	switch (packet_type)
+	{
+	case PacketType::ProtocolError:
+	case PacketType::ChecksumError:
+	case PacketType::ErrorResponse:
+	case PacketType::MultiEventWithError:
+	case PacketType::Cancel:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsSameChecksum(const AbccCrc& checksum_a, const AbccCrc& checksum_b)
+{
+	AbccCrc crcA = checksum_a;
+	AbccCrc crcB = checksum_b;
+
+	return crcA.Crc32() == crcB.Crc32();
+}
+
+static bool IsSameMsgHeader(const MsgHeaderInfo_t& header_a, const MsgHeaderInfo_t& header_b)
+{
+	return (header_a.cmd == header_b.cmd) &&
+		(header_a.obj == header_b.obj) &&
+		(header_a.inst == header_b.inst) &&
+		(header_a.cmdExt == header_b.cmdExt);
+}
+
+static bool IsSameMosiVars(const MosiVars_t& vars_a, const MosiVars_t& vars_b)
+{
+	return (vars_a.lFramesFirstSample == vars_b.lFramesFirstSample) &&
+		(vars_a.lFrameData == vars_b.lFrameData) &&
+		(vars_a.ePacketType == vars_b.ePacketType) &&
+		(vars_a.eState == vars_b.eState) &&
+		(vars_a.eMsgSubState == vars_b.eMsgSubState) &&
+		IsSameMsgHeader(vars_a.sMsgHeader, vars_b.sMsgHeader) &&
+		IsSameChecksum(vars_a.oChecksum, vars_b.oChecksum) &&
+		(vars_a.dwPdLen == vars_b.dwPdLen) &&
+		(vars_a.dwPdCnt == vars_b.dwPdCnt) &&
+		(vars_a.dwMsgLen == vars_b.dwMsgLen) &&
+		(vars_a.dwMsgLenCnt == vars_b.dwMsgLenCnt) &&
+		(vars_a.dwByteCnt == vars_b.dwByteCnt) &&
+		(vars_a.bFrameSizeCnt == vars_b.bFrameSizeCnt) &&
+		(vars_a.wMdCnt == vars_b.wMdCnt) &&
+		(vars_a.wMdSize == vars_b.wMdSize) &&
+		(vars_a.bLastToggleState == vars_b.bLastToggleState) &&
+		(vars_a.bLastApplSts == vars_b.bLastApplSts) &&
+		(vars_a.fNewMsg == vars_b.fNewMsg) &&
+		(vars_a.fErrorRsp == vars_b.fErrorRsp) &&
+		(vars_a.fFragmentation == vars_b.fFragmentation) &&
+		(vars_a.fFirstFrag == vars_b.fFirstFrag) &&
+		(vars_a.fLastFrag == vars_b.fLastFrag) &&
+		(vars_a.fWrPdValid == vars_b.fWrPdValid) &&
+		(vars_a.fReadyForNewPacket == vars_b.fReadyForNewPacket);
+}
+
+static bool IsSameMisoVars(const MisoVars_t& vars_a, const MisoVars_t& vars_b)
+{
+	return (vars_a.lFramesFirstSample == vars_b.lFramesFirstSample) &&
+		(vars_a.lFrameData == vars_b.lFrameData) &&
+		(vars_a.ePacketType == vars_b.ePacketType) &&
+		(vars_a.eState == vars_b.eState) &&
+		(vars_a.eMsgSubState == vars_b.eMsgSubState) &&
+		IsSameMsgHeader(vars_a.sMsgHeader, vars_b.sMsgHeader) &&
+		IsSameChecksum(vars_a.oChecksum, vars_b.oChecksum) &&
+		(vars_a.dwLastTimestamp == vars_b.dwLastTimestamp) &&
+		(vars_a.dwPdLen == vars_b.dwPdLen) &&
+		(vars_a.dwPdCnt == vars_b.dwPdCnt) &&
+		(vars_a.dwMsgLen == vars_b.dwMsgLen) &&
+		(vars_a.dwMsgLenCnt == vars_b.dwMsgLenCnt) &&
+		(vars_a.dwByteCnt == vars_b.dwByteCnt) &&
+		(vars_a.bFrameSizeCnt == vars_b.bFrameSizeCnt) &&
+		(vars_a.wMdCnt == vars_b.wMdCnt) &&
+		(vars_a.wMdSize == vars_b.wMdSize) &&
+		(vars_a.bLastAnbSts == vars_b.bLastAnbSts) &&
+		(vars_a.fNewMsg == vars_b.fNewMsg) &&
+		(vars_a.fErrorRsp == vars_b.fErrorRsp) &&
+		(vars_a.fFragmentation == vars_b.fFragmentation) &&
+		(vars_a.fFirstFrag == vars_b.fFirstFrag) &&
+		(vars_a.fLastFrag == vars_b.fLastFrag) &&
+		(vars_a.fNewRdPd == vars_b.fNewRdPd) &&
+		(vars_a.fReadyForNewPacket == vars_b.fReadyForNewPacket);
+}
+
+bool IsSameDecoderState(const AbccDecoderState_t& state_a, const AbccDecoderState_t& state_b)
+{
+	// Compared field by field, the padding of the structures is undefined
+	return IsSameMosiVars(state_a.sMosiVars, state_b.sMosiVars) &&
+		IsSameMisoVars(state_a.sMisoVars, state_b.sMisoVars) &&
+		IsSameMosiVars(state_a.sPreviousMosiVars, state_b.sPreviousMosiVars) &&
+		IsSameMisoVars(state_a.sPreviousMisoVars, state_b.sPreviousMisoVars) &&
+		(state_a.fMosiReady == state_b.fMosiReady) &&
+		(state_a.fMisoReady == state_b.fMisoReady) &&
+		(state_a.bCsEvents == state_b.bCsEvents) &&
+		(state_a.lCsEventSample == state_b.lCsEventSample) &&
+		(state_a.lFrameEndSample == state_b.lFrameEndSample);
+}
+
+AbccDecoder::AbccDecoder()
+	: mSink(nullptr),
+	mMosiVars(),
+	mMisoVars(),
+	mPreviousMosiVars(),
+	mPreviousMisoVars(),
+	mMosiReady(true),
+	mMisoReady(true),
+	mCsEvents(0),
+	mCsEventSample(0),
+	mFrameEndSample(0),
+	mAggregateProcessData(false),
+	mAggregateMessageData(false)
+{
+}
+
+void AbccDecoder::SetSink(AbccDecoderSink* sink)
+{
+	mSink = sink;
+}
+
+void AbccDecoder::SetAggregateProcessData(bool aggregate)
+{
+	mAggregateProcessData = aggregate;
+}
+
+void AbccDecoder::SetAggregateMessageData(bool aggregate)
+{
+	mAggregateMessageData = aggregate;
+}
+
+void AbccDecoder::GetState(AbccDecoderState_t* state) const
+{
+	state->sMosiVars = mMosiVars;
+	state->sMisoVars = mMisoVars;
+	state->sPreviousMosiVars = mPreviousMosiVars;
+	state->sPreviousMisoVars = mPreviousMisoVars;
+	state->fMosiReady = mMosiReady;
+	state->fMisoReady = mMisoReady;
+	state->bCsEvents = mCsEvents;
+	state->lCsEventSample = mCsEventSample;
+	state->lFrameEndSample = mFrameEndSample;
+}
+
+void AbccDecoder::SetState(const AbccDecoderState_t* state)
+{
+	mMosiVars = state->sMosiVars;
+	mMisoVars = state->sMisoVars;
+	mPreviousMosiVars = state->sPreviousMosiVars;
+	mPreviousMisoVars = state->sPreviousMisoVars;
+	mMosiReady = state->fMosiReady;
+	mMisoReady = state->fMisoReady;
+	mCsEvents = state->bCsEvents;
+	mCsEventSample = state->lCsEventSample;
+	mFrameEndSample = state->lFrameEndSample;
+
+	// Snapshots are taken between packets, no process data is staged
+	mMosiStagedData.clear();
+	mMisoStagedData.clear();
+	mMosiPacketData.clear();
+	mMisoPacketData.clear();
+}
+
+const std::vector<U8>& AbccDecoder::GetPacketData(SpiChannel_t channel) const
+{
+	return (channel == SpiChannel::MOSI) ? mMosiPacketData : mMisoPacketData;
+}
+
+void AbccDecoder::AppendPacketData(std::vector<U8>* packet_data, U64 data, U32 byte_count)
+{
+	for (U32 i = 0; i < byte_count; i++)
+	{
+		packet_data->push_back((U8)(data >> (8 * i)));
+	}
+}
+
+void AbccDecoder::ComputePacketChecksum(AbccCrc* checksum, std::vector<U8>* packet_data)
+{
+	U8* data = packet_data->data();
+	size_t remaining = packet_data->size();
+
+	checksum->Init();
+
+	while (remaining > 0)
+	{
+		U16 length = (U16)((remaining > 0xFFFF) ? 0xFFFF : remaining);
+
+		checksum->Update(data, length);
+		data += length;
+		remaining -= length;
+	}
+}
+
+void AbccDecoder::Reset()
+{
+	mMosiVars.eState              = AbccMosiStates::Idle;
+	mMisoVars.eState              = AbccMisoStates::Idle;
+	mMisoVars.bLastAnbSts         = 0xFF;
+	mMosiVars.bLastApplSts        = 0xFF;
+	mMosiVars.bLastToggleState    = 0xFF;
+	mMosiVars.dwMsgLen            = 0;
+	mMosiVars.dwMsgLenCnt         = 0;
+	mMosiVars.dwPdLen             = 0;
+	mMisoVars.dwMsgLen            = 0;
+	mMisoVars.dwMsgLenCnt         = 0;
+	mMisoVars.dwPdLen             = 0;
+
+	mMisoVars.fNewMsg             = false;
+	mMisoVars.fErrorRsp           = true;
+	mMisoVars.fFragmentation      = false;
+	mMisoVars.fFirstFrag          = false;
+	mMisoVars.fLastFrag           = false;
+	mMisoVars.fNewRdPd            = false;
+	mMosiVars.fNewMsg             = false;
+	mMosiVars.fErrorRsp           = true;
+	mMosiVars.fFragmentation      = false;
+	mMosiVars.fFirstFrag          = false;
+	mMosiVars.fLastFrag           = false;
+	mMosiVars.fWrPdValid          = false;
+
+	mMisoVars.fReadyForNewPacket  = false;
+	mMosiVars.fReadyForNewPacket  = false;
+
+	mMisoVars.ePacketType         = PacketType::Empty;
+	mMosiVars.ePacketType         = PacketType::Empty;
+
+	memset(&mMisoVars.sMsgHeader, 0, sizeof(mMisoVars.sMsgHeader));
+	mMisoVars.dwPdCnt = 0;
+	mMisoVars.wMdCnt = 0;
+	mMisoVars.wMdSize = 0;
+
+	memset(&mMosiVars.sMsgHeader, 0, sizeof(mMosiVars.sMsgHeader));
+	mMosiVars.dwPdCnt = 0;
+	mMosiVars.wMdCnt = 0;
+	mMosiVars.wMdSize = 0;
+
+	mMisoVars.dwLastTimestamp = 0;
+
+	mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Size;
+	mMisoVars.dwByteCnt    = 0;
+	mMisoVars.lFrameData   = 0;
+
+	mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Size;
+	mMosiVars.dwByteCnt    = 0;
+	mMosiVars.lFrameData   = 0;
+
+	mMosiVars.bFrameSizeCnt = 0;
+	mMisoVars.bFrameSizeCnt = 0;
+
+	mMisoVars.oChecksum = AbccCrc();
+	mMosiVars.oChecksum = AbccCrc();
+
+	RunAbccMosiMsgSubStateMachine(StateOperation::Reset, nullptr, nullptr);
+	RunAbccMisoMsgSubStateMachine(StateOperation::Reset, nullptr, nullptr);
+
+	memcpy(&mPreviousMisoVars, &mMisoVars, sizeof(MisoVars_t));
+	memcpy(&mPreviousMosiVars, &mMosiVars, sizeof(MosiVars_t));
+
+	mMosiReady = true;
+	mMisoReady = true;
+
+	mCsEvents = 0;
+	mCsEventSample = 0;
+	mFrameEndSample = 0;
+
+	mMosiStagedData.clear();
+	mMisoStagedData.clear();
+	mMosiPacketData.clear();
+	mMisoPacketData.clear();
+}
+
+inline bool AbccDecoder::IsEnableActive()
+{
+	return ((mCsEvents & ABCC_CS_INACTIVE_EVENT) == 0);
+}
+
+inline bool AbccDecoder::IsEndOfTransaction()
+{
+	return ((mCsEvents & ABCC_CS_END_EVENT) != 0);
+}
+
+void AbccDecoder::ProcessTransfer(const AbccTransfer_t* transfer)
+{
+	AcquisitionStatus acquisitionStatus = transfer->eStatus;
+	U32 mosiByteIndex = 0;
+	U32 misoByteIndex = 0;
+
+	mCsEvents = transfer->bCsEvents;
+	mCsEventSample = transfer->lCsEventSample;
+
+	// The channels are advanced in the order the bytes are on the wire, so a
+	// transfer of several bytes is decoded as the same bytes one at a time.
+	// An aborted packet restores the state of both channels, which must not
+	// happen while one of them is ahead of the other within the transfer.
+	while ((mosiByteIndex < transfer->dwByteCount) || (misoByteIndex < transfer->dwByteCount))
+	{
+		if (mosiByteIndex <= misoByteIndex)
+		{
+			mosiByteIndex += ProcessMosiUnit(acquisitionStatus, transfer, mosiByteIndex);
+		}
+		else
+		{
+			misoByteIndex += ProcessMisoUnit(acquisitionStatus, transfer, misoByteIndex);
+		}
+	}
+
+	if ((mCsEvents & ABCC_CS_IDLE_TIMEOUT_EVENT) != 0)
+	{
+		if (!mMosiReady && !mMisoReady)
+		{
+			FlushMosiStagedData(mMosiVars.eState);
+			FlushMisoStagedData(mMisoVars.eState);
+
+			mMosiVars.eState = AbccMosiStates::SpiControl;
+			mMisoVars.eState = AbccMisoStates::Reserved1;
+			//mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Size;
+			//mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Size;
+			mMisoVars.oChecksum.Init();
+			mMosiVars.oChecksum.Init();
+			mMisoPacketData.clear();
+			mMosiPacketData.clear();
+			mMisoVars.lFrameData = 0;
+			mMosiVars.lFrameData = 0;
+			mMisoVars.dwByteCnt = 0;
+			mMosiVars.dwByteCnt = 0;
+			acquisitionStatus = AcquisitionStatus::Error;
+		}
+	}
+
+	if (acquisitionStatus == AcquisitionStatus::Error)
+	{
+		// Signal error, do not commit packet
+		SetMosiPacketType(PacketType::Cancel);
+		SignalReadyForNewPacket(SpiChannel::MOSI);
+	}
+}
+
+void AbccDecoder::SignalReadyForNewPacket(SpiChannel_t channel)
+{
+	if (channel == SpiChannel::MOSI)
+	{
+		mMosiVars.fReadyForNewPacket = true;
+	}
+	else
+	{
+		mMisoVars.fReadyForNewPacket = true;
+	}
+
+	if ((mMosiVars.ePacketType == PacketType::Cancel) ||
+		(mMisoVars.fReadyForNewPacket && mMosiVars.fReadyForNewPacket))
+	{
+		// The sink correlates the completed messages, see AbccTransactionIndex
+		mSink->OnPacketEnd(mMosiVars.ePacketType, mMisoVars.ePacketType);
+
+		mMosiVars.fReadyForNewPacket = false;
+		mMisoVars.fReadyForNewPacket = false;
+		mMosiVars.ePacketType = PacketType::Empty;
+		mMisoVars.ePacketType = PacketType::Empty;
+	}
+}
+
+void AbccDecoder::AddFragFrame(SpiChannel_t channel, U64 first_sample, U64 last_sample)
+{
+	AbccFrame_t errorFrame;
+
+	memset(&errorFrame, 0, sizeof(errorFrame));
+	errorFrame.lStartingSampleInclusive = first_sample;
+	errorFrame.lEndingSampleInclusive = last_sample;
+	errorFrame.lData1 = 0;
+	errorFrame.bType = AbccSpiError::Fragmentation;
+	errorFrame.bFlags = (SPI_ERROR_FLAG | DISPLAY_AS_ERROR_FLAG);
+
+	if (channel == SpiChannel::MOSI)
+	{
+		errorFrame.bFlags |= SPI_MOSI_FLAG;
+	}
+
+	mSink->OnFrame(errorFrame);
+
+	SignalReadyForNewPacket(channel);
+	RestorePreviousStateVars();
+}
+
+void AbccDecoder::ProcessMisoFrame(AbccMisoStates::Enum state, U64 frame_data, S64 frames_first_sample)
+{
+	AbccFrame_t resultFrame;
+
+	memset(&resultFrame, 0, sizeof(resultFrame));
+
+	resultFrame.bFlags = 0x00;
+	resultFrame.bType = (U8)state;
+	resultFrame.lStartingSampleInclusive = frames_first_sample;
+	resultFrame.lEndingSampleInclusive = (S64)mFrameEndSample;
+	resultFrame.lData1 = frame_data;
+
+
+	if (state == AbccMisoStates::MessageField_Object)
+	{
+		mMisoVars.sMsgHeader.obj = (U8)frame_data;
+		mMisoVars.wMdCnt = 0;
+	}
+	else if (state == AbccMisoStates::MessageField_Instance)
+	{
+		mMisoVars.sMsgHeader.inst = (U16)frame_data;
+
+		// Store the object code in frame data to handle object specific data
+		resultFrame.lData2 = mMisoVars.sMsgHeader.obj;
+	}
+	else if (state == AbccMisoStates::MessageField_Command)
+	{
+		mMisoVars.sMsgHeader.cmd = (U8)frame_data;
+
+		// Store the object code in frame data to handle object specific data
+		resultFrame.lData2 = mMisoVars.sMsgHeader.obj;
+
+		if ((frame_data & ABP_MSG_HEADER_E_BIT) == ABP_MSG_HEADER_E_BIT)
+		{
+			mMisoVars.fErrorRsp = true;
+		}
+		else
+		{
+			mMisoVars.fErrorRsp = false;
+		}
+	}
+	else if (state == AbccMisoStates::MessageField_CommandExtension)
+	{
+		// To better analyze the data in bubbletext
+		// store the object code, instance, and command
+		memcpy(&resultFrame.lData2, &mMisoVars.sMsgHeader, sizeof(mMisoVars.sMsgHeader));
+		mMisoVars.sMsgHeader.cmdExt = (U16)frame_data;
+	}
+	else if (state == AbccMisoStates::MessageField_Size)
+	{
+		if ((U16)frame_data > ABP_MAX_MSG_DATA_BYTES)
+		{
+			// Max message data size exceeded
+			resultFrame.bFlags |= (SPI_PROTO_EVENT_FLAG | DISPLAY_AS_ERROR_FLAG);
+			mMisoVars.wMdSize = 0;
+			mMisoVars.fFirstFrag = false;
+			mMisoVars.fLastFrag = false;
+			mMisoVars.fFragmentation = false;
+		}
+		else
+		{
+			mMisoVars.wMdSize = (U16)frame_data;
+		}
+	}
+	else if (state == AbccMisoStates::MessageField_Data)
+	{
+		MsgDataFrameData2_t* psFrameData2 = (MsgDataFrameData2_t*)&resultFrame.lData2;
+		const U8* data = (const U8*)&frame_data;
+		size_t count = 1;
+
+		if (!mMisoStagedData.empty())
+		{
+			// A run of message data is committed as a single frame
+			data = mMisoStagedData.data();
+			count = mMisoStagedData.size();
+		}
+
+		// Copy message header info to frame data so that the display of the
+		// data can be adapted based on the provided information.
+		memcpy(&psFrameData2->msgHeader,
+			&mMisoVars.sMsgHeader, sizeof(mMisoVars.sMsgHeader));
+
+		// Add a byte counter that can be displayed
+		// in the results for easy tracking of specific values
+		psFrameData2->msgDataCnt = mMisoVars.wMdCnt;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			if (mMisoVars.fErrorRsp)
+			{
+				resultFrame.bFlags |= SPI_PROTO_EVENT_FLAG;
+				// Check if data is 0xFF, if so delay de-assertion of fErrorRsp
+				// so that the object specific error response can be detected
+				if (((data[i] != (U8)0xFF) && (mMisoVars.wMdCnt == 0)) ||
+					(mMisoVars.wMdCnt > 1))
+				{
+					mMisoVars.fErrorRsp = false;
+				}
+			}
+
+			mMisoVars.wMdCnt++;
+		}
+
+		// Check if the message data counter has reached the end of valid data
+		if (mMisoVars.wMdCnt > mMisoVars.wMdSize)
+		{
+			// Override frame type
+			resultFrame.bType = (U8)AbccMisoStates::MessageField_DataNotValid;
+		}
+	}
+	else if (state == AbccMisoStates::AnybusStatus)
+	{
+		if (mMisoVars.bLastAnbSts != (U8)frame_data)
+		{
+			// Anybus status change event
+			mMisoVars.bLastAnbSts = (U8)frame_data;
+			resultFrame.bFlags |= SPI_PROTO_EVENT_FLAG;
+			SetMisoPacketType(PacketType::ProtocolEvent);
+		}
+	}
+	else if (state == AbccMisoStates::NetworkTime)
+	{
+		NetworkTimeInfo_t* networkTimeInfo = reinterpret_cast<NetworkTimeInfo_t*>(&resultFrame.lData2);
+		// Compute delta from last timestamp and save it
+		networkTimeInfo->deltaTime = (U32)resultFrame.lData1 - mMisoVars.dwLastTimestamp;
+		networkTimeInfo->newRdPd = mMisoVars.fNewRdPd;
+		networkTimeInfo->wrPdValid = mMosiVars.fWrPdValid;
+		mMisoVars.fNewRdPd = false;
+		mMosiVars.fWrPdValid = false;
+		mMisoVars.dwLastTimestamp = (U32)resultFrame.lData1;
+	}
+	else if (state == AbccMisoStates::SpiStatus)
+	{
+		if ((U8)(frame_data & ABP_SPI_STATUS_WRMSG_FULL))
+		{
+			// Write message buffer is full, possible overrun
+			resultFrame.bFlags |= (SPI_PROTO_EVENT_FLAG | DISPLAY_AS_WARNING_FLAG);
+			SetMisoPacketType(PacketType::ProtocolEvent);
+		}
+	}
+	else if (state == AbccMisoStates::Crc32)
+	{
+		// Save the computed CRC32 to the unused frame data
+		ComputePacketChecksum(&mMisoVars.oChecksum, &mMisoPacketData);
+		resultFrame.lData2 = mMisoVars.oChecksum.Crc32();
+
+		if (resultFrame.lData2 != resultFrame.lData1)
+		{
+			// CRC Error
+			resultFrame.bFlags |= (SPI_PROTO_EVENT_FLAG | DISPLAY_AS_ERROR_FLAG);
+		}
+	}
+
+	// Add a byte counter that can be displayed
+	// in the results for easy tracking of specific values
+	if (state == AbccMisoStates::ReadProcessData)
+	{
+		resultFrame.lData2 = (U64)mMisoVars.dwPdCnt;
+		mMisoVars.dwPdCnt += mMisoStagedData.empty() ? 1 : (U32)mMisoStagedData.size();
+	}
+	else
+	{
+		mMisoVars.dwPdCnt = 0;
+	}
+
+	if (!mMisoStagedData.empty())
+	{
+		// The frame refers to the bytes stored by the sink
+		U32 length = (U32)mMisoStagedData.size();
+
+		resultFrame.bFlags |= SPI_AGGREGATED_FRAME_FLAG;
+		resultFrame.lData1 = AGGREGATED_FRAME_DATA1(mSink->OnFrameData(mMisoStagedData.data(), length), length);
+		mMisoStagedData.clear();
+	}
+
+	// Handle indication of the SPI message fragmentation protocol
+	if (mMisoVars.fFragmentation)
+	{
+		resultFrame.bFlags |= (SPI_MSG_FRAG_FLAG);
+
+		if (mMisoVars.fFirstFrag)
+		{
+			resultFrame.bFlags |= (SPI_MSG_FIRST_FRAG_FLAG);
+		}
+
+		if (state == AbccMisoStates::Crc32)
+		{
+			mMisoVars.fFirstFrag = false;
+
+			if (mMisoVars.fLastFrag)
+			{
+				mMisoVars.fLastFrag = false;
+				mMisoVars.fFragmentation = false;
+			}
+		}
+	}
+
+	if (state == AbccMisoStates::Crc32)
+	{
+		if (((resultFrame.bFlags & DISPLAY_AS_ERROR_FLAG) != 0))
+		{
+			SetMisoPacketType(PacketType::ChecksumError);
+			RestorePreviousStateVars();
+		}
+		else
+		{
+			// Backup state variables for both MOSI and MISO
+			memcpy(&mPreviousMisoVars, &mMisoVars, sizeof(MisoVars_t));
+			memcpy(&mPreviousMosiVars, &mMosiVars, sizeof(MosiVars_t));
+		}
+
+		if (mMisoVars.fNewMsg)
+		{
+			if (((resultFrame.bFlags & SPI_MSG_FRAG_FLAG) != 0) &&
+				!((resultFrame.bFlags & SPI_MSG_FIRST_FRAG_FLAG) != 0))
+			{
+				SetMisoPacketType(PacketType::MessageFragment);
+			}
+			else
+			{
+				if (mMisoVars.sMsgHeader.cmd & ABP_MSG_HEADER_C_BIT)
+				{
+					SetMisoPacketType(PacketType::Command);
+				}
+				else if (mMisoVars.sMsgHeader.cmd & ABP_MSG_HEADER_E_BIT)
+				{
+					SetMisoPacketType(PacketType::ErrorResponse);
+				}
+				else
+				{
+					SetMisoPacketType(PacketType::Response);
+				}
+			}
+		}
+	}
+	else if (((resultFrame.bFlags & DISPLAY_AS_ERROR_FLAG) != 0))
+	{
+		SetMisoPacketType(PacketType::ProtocolError);
+	}
+
+	// Commit the processed frame
+	mSink->OnFrame(resultFrame);
+
+	if (state == AbccMisoStates::Crc32)
+	{
+		SignalReadyForNewPacket(SpiChannel::MISO);
+	}
+}
+
+void AbccDecoder::ProcessMosiFrame(AbccMosiStates::Enum state, U64 frame_data, S64 frames_first_sample)
+{
+	AbccFrame_t resultFrame;
+
+	memset(&resultFrame, 0, sizeof(resultFrame));
+
+	resultFrame.bFlags = SPI_MOSI_FLAG;
+	resultFrame.bType = (U8)state;
+	resultFrame.lStartingSampleInclusive = frames_first_sample;
+	resultFrame.lEndingSampleInclusive = (S64)mFrameEndSample;
+	resultFrame.lData1 = frame_data;
+
+
+	if (state == AbccMosiStates::MessageField_Object)
+	{
+		mMosiVars.sMsgHeader.obj = (U8)frame_data;
+		mMosiVars.wMdCnt = 0;
+	}
+	else if (state == AbccMosiStates::MessageField_Instance)
+	{
+		mMosiVars.sMsgHeader.inst = (U16)frame_data;
+
+		// Store the object code in frame data to handle object specific data
+		resultFrame.lData2 = mMosiVars.sMsgHeader.obj;
+	}
+	else if (state == AbccMosiStates::MessageField_Command)
+	{
+		mMosiVars.sMsgHeader.cmd = (U8)frame_data;
+
+		// Store the object code in frame data to handle object specific data
+		resultFrame.lData2 = mMosiVars.sMsgHeader.obj;
+
+		if ((frame_data & ABP_MSG_HEADER_E_BIT) == ABP_MSG_HEADER_E_BIT)
+		{
+			mMosiVars.fErrorRsp = true;
+		}
+		else
+		{
+			mMosiVars.fErrorRsp = false;
+		}
+	}
+	else if (state == AbccMosiStates::MessageField_CommandExtension)
+	{
+		// To better analyze the data in bubbletext
+		// store the object code, instance, and command
+		memcpy(&resultFrame.lData2, &mMosiVars.sMsgHeader, sizeof(mMosiVars.sMsgHeader));
+		mMosiVars.sMsgHeader.cmdExt = (U16)frame_data;
+	}
+	else if (state == AbccMosiStates::MessageField_Size)
+	{
+		if ((U16)frame_data > ABP_MAX_MSG_DATA_BYTES)
+		{
+			// Max message data size exceeded
+			resultFrame.bFlags |= (SPI_PROTO_EVENT_FLAG | DISPLAY_AS_ERROR_FLAG);
+			mMosiVars.wMdSize = 0;
+			mMosiVars.fFirstFrag = false;
+			mMosiVars.fLastFrag = false;
+			mMosiVars.fFragmentation = false;
+		}
+		else
+		{
+			mMosiVars.wMdSize = (U16)frame_data;
+		}
+	}
+	else if (state == AbccMosiStates::MessageField_Data)
+	{
+		MsgDataFrameData2_t* psFrameData2 = (MsgDataFrameData2_t*)&resultFrame.lData2;
+		const U8* data = (const U8*)&frame_data;
+		size_t count = 1;
+
+		if (!mMosiStagedData.empty())
+		{
+			// A run of message data is committed as a single frame
+			data = mMosiStagedData.data();
+			count = mMosiStagedData.size();
+		}
+
+		// Copy message header info to frame data so that the display of the
+		// data can be adapted based on the provided information.
+		memcpy(&psFrameData2->msgHeader,
+			&mMosiVars.sMsgHeader, sizeof(mMosiVars.sMsgHeader));
+
+		// Add a byte counter that can be displayed
+		// in the results for easy tracking of specific values
+		psFrameData2->msgDataCnt = mMosiVars.wMdCnt;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			if (mMosiVars.fErrorRsp)
+			{
+				resultFrame.bFlags |= SPI_PROTO_EVENT_FLAG;
+
+				// Check if data is 0xFF, if so delay de-assertion of fErrorRsp
+				// so that the object specific error response can be detected
+				if (((data[i] != (U8)0xFF) && (mMosiVars.wMdCnt == 0)) ||
+					(mMosiVars.wMdCnt > 1))
+				{
+					mMosiVars.fErrorRsp = false;
+				}
+			}
+
+			mMosiVars.wMdCnt++;
+		}
+
+		// Check if the message data counter has reached the end of valid data
+		if (mMosiVars.wMdCnt > mMosiVars.wMdSize)
+		{
+			// Override frame type
+			resultFrame.bType = (U8)AbccMosiStates::MessageField_DataNotValid;
+		}
+	}
+	else if (state == AbccMosiStates::ApplicationStatus)
+	{
+		if (mMosiVars.bLastApplSts != (U8)frame_data)
+		{
+			// Application status change event
+			mMosiVars.bLastApplSts = (U8)frame_data;
+			resultFrame.bFlags |= SPI_PROTO_EVENT_FLAG;
+			SetMosiPacketType(PacketType::ProtocolEvent);
+		}
+	}
+	else if (state == AbccMosiStates::SpiControl)
+	{
+		if (mMosiVars.bLastToggleState == (U8)(frame_data & ABP_SPI_CTRL_T))
+		{
+			// Retransmit event
+			resultFrame.bFlags |= SPI_PROTO_EVENT_FLAG;
+			SetMosiPacketType(PacketType::ProtocolEvent);
+		}
+		else
+		{
+			mMosiVars.bLastToggleState = (U8)(frame_data & ABP_SPI_CTRL_T);
+		}
+	}
+	else if (state == AbccMosiStates::Crc32)
+	{
+		// Save the computed CRC32 to the unused frame data
+		ComputePacketChecksum(&mMosiVars.oChecksum, &mMosiPacketData);
+		resultFrame.lData2 = mMosiVars.oChecksum.Crc32();
+
+		if (resultFrame.lData2 != resultFrame.lData1)
+		{
+			// CRC Error
+			resultFrame.bFlags |= (SPI_PROTO_EVENT_FLAG | DISPLAY_AS_ERROR_FLAG);
+		}
+	}
+
+	// Add a byte counter that can be displayed
+	// in the results for easy tracking of specific values
+	if (state == AbccMosiStates::WriteProcessData)
+	{
+		resultFrame.lData2 = (U64)mMosiVars.dwPdCnt;
+		mMosiVars.dwPdCnt += mMosiStagedData.empty() ? 1 : (U32)mMosiStagedData.size();
+	}
+	else
+	{
+		mMosiVars.dwPdCnt = 0;
+	}
+
+	if (!mMosiStagedData.empty())
+	{
+		// The frame refers to the bytes stored by the sink
+		U32 length = (U32)mMosiStagedData.size();
+
+		resultFrame.bFlags |= SPI_AGGREGATED_FRAME_FLAG;
+		resultFrame.lData1 = AGGREGATED_FRAME_DATA1(mSink->OnFrameData(mMosiStagedData.data(), length), length);
+		mMosiStagedData.clear();
+	}
+
+	// Handle indication of the SPI message fragmentation protocol
+	if (mMosiVars.fFragmentation)
+	{
+		resultFrame.bFlags |= (SPI_MSG_FRAG_FLAG);
+
+		if (mMosiVars.fFirstFrag)
+		{
+			resultFrame.bFlags |= SPI_MSG_FIRST_FRAG_FLAG;
+		}
+		if (state == AbccMosiStates::Pad)
+		{
+			mMosiVars.fFirstFrag = false;
+
+			if (mMosiVars.fLastFrag)
+			{
+				mMosiVars.fLastFrag = false;
+				mMosiVars.fFragmentation = false;
+			}
+		}
+	}
+
+	if (((resultFrame.bFlags & DISPLAY_AS_ERROR_FLAG) != 0))
+	{
+		if (state == AbccMosiStates::Crc32)
+		{
+			SetMosiPacketType(PacketType::ChecksumError);
+		}
+		else
+		{
+			SetMosiPacketType(PacketType::ProtocolError);
+		}
+	}
+
+	if (state == AbccMosiStates::Pad)
+	{
+		if (mMosiVars.fNewMsg)
+		{
+			if (((resultFrame.bFlags & SPI_MSG_FRAG_FLAG) != 0) &&
+				!((resultFrame.bFlags & SPI_MSG_FIRST_FRAG_FLAG) != 0))
+			{
+				SetMosiPacketType(PacketType::MessageFragment);
+			}
+			else
+			{
+				if (mMosiVars.sMsgHeader.cmd & ABP_MSG_HEADER_C_BIT)
+				{
+					SetMosiPacketType(PacketType::Command);
+				}
+				else if (mMosiVars.sMsgHeader.cmd & ABP_MSG_HEADER_E_BIT)
+				{
+					SetMosiPacketType(PacketType::ErrorResponse);
+				}
+				else
+				{
+					SetMosiPacketType(PacketType::Response);
+				}
+			}
+		}
+	}
+
+	// Commit the processed frame
+	mSink->OnFrame(resultFrame);
+
+	if (state == AbccMosiStates::Pad)
+	{
+		SignalReadyForNewPacket(SpiChannel::MOSI);
+	}
+}
+
+void AbccDecoder::SetMosiPacketType(PacketType packet_type)
+{
+	switch (packet_type)
+	{
+	case PacketType::Empty:
+	case PacketType::Cancel:
+		mMosiVars.ePacketType = packet_type;
+		break;
+	case PacketType::ProtocolError:
+	case PacketType::ChecksumError:
+	case PacketType::ErrorResponse:
+		if (mMosiVars.ePacketType == PacketType::Empty)
+		{
+			mMosiVars.ePacketType = packet_type;
+		}
+		else if (mMosiVars.ePacketType != packet_type)
+		{
+			mMosiVars.ePacketType = PacketType::MultiEventWithError;
+		}
+		break;
+	case PacketType::Response:
+	case PacketType::Command:
+	case PacketType::MessageFragment:
+	case PacketType::ProtocolEvent:
+		if (mMosiVars.ePacketType == PacketType::Empty)
+		{
+			mMosiVars.ePacketType = packet_type;
+		}
+		else if (IsErrorPacketType(mMosiVars.ePacketType))
+		{
+			mMosiVars.ePacketType = PacketType::MultiEventWithError;
+		}
+		else if (mMosiVars.ePacketType != packet_type)
+		{
+			mMosiVars.ePacketType = PacketType::MultiEvent;
+		}
+		break;
+	default:
+	case PacketType::MultiEvent:
+	case PacketType::MultiEventWithError:
+		break;
+	}
+}
+
+void AbccDecoder::SetMisoPacketType(PacketType packet_type)
+{
+	switch (packet_type)
+	{
+	case PacketType::Empty:
+	case PacketType::Cancel:
+		mMisoVars.ePacketType = packet_type;
+		break;
+	case PacketType::ProtocolError:
+	case PacketType::ChecksumError:
+	case PacketType::ErrorResponse:
+		if (mMisoVars.ePacketType == PacketType::Empty)
+		{
+			mMisoVars.ePacketType = packet_type;
+		}
+		else if (mMisoVars.ePacketType != packet_type)
+		{
+			mMisoVars.ePacketType = PacketType::MultiEventWithError;
+		}
+		break;
+	case PacketType::Response:
+	case PacketType::Command:
+	case PacketType::MessageFragment:
+	case PacketType::ProtocolEvent:
+		if (mMisoVars.ePacketType == PacketType::Empty)
+		{
+			mMisoVars.ePacketType = packet_type;
+		}
+		else if (IsErrorPacketType(mMisoVars.ePacketType))
+		{
+			mMisoVars.ePacketType = PacketType::MultiEventWithError;
+		}
+		else if (mMisoVars.ePacketType != packet_type)
+		{
+			mMisoVars.ePacketType = PacketType::MultiEvent;
+		}
+		break;
+	default:
+	case PacketType::MultiEvent:
+	case PacketType::MultiEventWithError:
+		break;
+	}
+}
+
+U32 AbccDecoder::GetMosiUnitSize(U32 bytes_available)
+{
+	// Multi-byte fields of the SPI header and trailer may be consumed in a
+	// single pass; the message and (unless aggregated) process data fields
+	// are processed bytewise.
+	switch (mMosiVars.eState)
+	{
+	case AbccMosiStates::WriteProcessData:
+		if (mAggregateProcessData)
+		{
+			// Aggregated process data is consumed up to the end of the block,
+			// or as much as the frame can hold
+			U32 blockBytesRemaining = AGGREGATED_FRAME_MAX_LENGTH - (U32)mMosiStagedData.size();
+
+			if (mMosiVars.dwPdLen < blockBytesRemaining)
+			{
+				blockBytesRemaining = mMosiVars.dwPdLen;
+			}
+
+			return (blockBytesRemaining < bytes_available) ? blockBytesRemaining : bytes_available;
+		}
+		return 1;
+	case AbccMosiStates::Idle:
+	case AbccMosiStates::MessageField:
+		return 1;
+	default:
+		if (GET_MOSI_FRAME_SIZE(mMosiVars.eState) > mMosiVars.dwByteCnt)
+		{
+			U32 fieldBytesRemaining = GET_MOSI_FRAME_SIZE(mMosiVars.eState) - mMosiVars.dwByteCnt;
+			return (fieldBytesRemaining < bytes_available) ? fieldBytesRemaining : bytes_available;
+		}
+		return 1;
+	}
+}
+
+U32 AbccDecoder::ProcessMosiUnit(AcquisitionStatus acquisition_status, const AbccTransfer_t* transfer, U32 byte_index)
+{
+	StateOperation operation = StateOperation::Run;
+	U32 unitSize = GetMosiUnitSize(transfer->dwByteCount - byte_index);
+	U64 unitMask = (1ULL << (unitSize * BITS_PER_BYTE)) - 1;
+	U64 unitData = (transfer->lMosiData >> (byte_index * BITS_PER_BYTE)) & unitMask;
+
+	if ((acquisition_status != AcquisitionStatus::OK) || mMosiReady)
+	{
+		// A ready statemachine is restarted by the next byte
+		operation = StateOperation::Reset;
+	}
+
+	mFrameEndSample = transfer->alLastSamples[byte_index + unitSize - 1];
+	mMosiReady = RunAbccMosiStateMachine(operation, acquisition_status, unitData, unitSize,
+		transfer->alFirstSamples[byte_index], (byte_index + unitSize) == transfer->dwByteCount);
+
+	return unitSize;
+}
+
+U32 AbccDecoder::GetMisoUnitSize(U32 bytes_available)
+{
+	// Multi-byte fields of the SPI header and trailer may be consumed in a
+	// single pass; the message and (unless aggregated) process data fields
+	// are processed bytewise.
+	switch (mMisoVars.eState)
+	{
+	case AbccMisoStates::ReadProcessData:
+		if (mAggregateProcessData)
+		{
+			// Aggregated process data is consumed up to the end of the block,
+			// or as much as the frame can hold
+			U32 blockBytesRemaining = AGGREGATED_FRAME_MAX_LENGTH - (U32)mMisoStagedData.size();
+
+			if (mMisoVars.dwPdLen < blockBytesRemaining)
+			{
+				blockBytesRemaining = mMisoVars.dwPdLen;
+			}
+
+			return (blockBytesRemaining < bytes_available) ? blockBytesRemaining : bytes_available;
+		}
+		return 1;
+	case AbccMisoStates::Idle:
+	case AbccMisoStates::MessageField:
+		return 1;
+	default:
+		if (GET_MISO_FRAME_SIZE(mMisoVars.eState) > mMisoVars.dwByteCnt)
+		{
+			U32 fieldBytesRemaining = GET_MISO_FRAME_SIZE(mMisoVars.eState) - mMisoVars.dwByteCnt;
+			return (fieldBytesRemaining < bytes_available) ? fieldBytesRemaining : bytes_available;
+		}
+		return 1;
+	}
+}
+
+U32 AbccDecoder::ProcessMisoUnit(AcquisitionStatus acquisition_status, const AbccTransfer_t* transfer, U32 byte_index)
+{
+	StateOperation operation = StateOperation::Run;
+	U32 unitSize = GetMisoUnitSize(transfer->dwByteCount - byte_index);
+	U64 unitMask = (1ULL << (unitSize * BITS_PER_BYTE)) - 1;
+	U64 unitData = (transfer->lMisoData >> (byte_index * BITS_PER_BYTE)) & unitMask;
+
+	if ((acquisition_status != AcquisitionStatus::OK) || mMisoReady)
+	{
+		// A ready statemachine is restarted by the next byte
+		operation = StateOperation::Reset;
+	}
+
+	mFrameEndSample = transfer->alLastSamples[byte_index + unitSize - 1];
+	mMisoReady = RunAbccMisoStateMachine(operation, acquisition_status, unitData, unitSize,
+		transfer->alFirstSamples[byte_index], (byte_index + unitSize) == transfer->dwByteCount);
+
+	return unitSize;
+}
+
+bool AbccDecoder::RunAbccMisoStateMachine(StateOperation operation, AcquisitionStatus acquisition_status, U64 miso_data, U32 byte_count, S64 first_sample, bool end_of_transfer)
+{
+	AbccMisoStates::Enum eMsgSubState = AbccMisoStates::MessageField_Size;
+	AbccMisoStates::Enum eMisoState_Current = AbccMisoStates::Idle;
+	bool addFrame = false;
+	bool dataStaged = false;
+
+	eMisoState_Current = mMisoVars.eState;
+
+	// If an error is signaled we jump into IDLE and wait to be reset.
+	// A reset should be logically signaled when CS# is brought HIGH.
+	// This would essentially indicate the begining of a new transaction.
+	if ((operation != StateOperation::Reset) && ((acquisition_status == AcquisitionStatus::Error) || !IsEnableActive()))
+	{
+		FlushMisoStagedData(mMisoVars.eState);
+		mMisoVars.eState = AbccMisoStates::Idle;
+
+		if (mMisoVars.dwByteCnt == 0)
+		{
+			mMisoVars.lFramesFirstSample = first_sample;
+		}
+
+		AddFragFrame(SpiChannel::MISO, mMisoVars.lFramesFirstSample, mCsEventSample);
+
+		return true;
+	}
+
+	if (mMisoVars.eState == AbccMisoStates::Idle)
+	{
+		mMisoVars.oChecksum.Init();
+		mMisoVars.lFrameData = 0;
+		mMisoVars.dwByteCnt = 0;
+		mMisoStagedData.clear();
+		mMisoPacketData.clear();
+
+		if (operation == StateOperation::Reset)
+		{
+			mMisoVars.eState = AbccMisoStates::Reserved1;
+			eMisoState_Current = mMisoVars.eState;
+		}
+	}
+
+	if (mMisoVars.dwByteCnt == 0)
+	{
+		mMisoVars.lFramesFirstSample = first_sample;
+	}
+
+	if (IsMisoDataAggregated())
+	{
+		// The block is staged, it does not fit into the frame data
+		StageData(&mMisoStagedData, miso_data, byte_count);
+		dataStaged = true;
+	}
+	else
+	{
+		mMisoVars.lFrameData |= (miso_data << (8 * mMisoVars.dwByteCnt));
+	}
+
+	mMisoVars.dwByteCnt += byte_count;
+
+	if (mMisoVars.eState != AbccMisoStates::Crc32)
+	{
+		AppendPacketData(&mMisoPacketData, miso_data, byte_count);
+	}
+
+	switch (mMisoVars.eState)
+	{
+	case AbccMisoStates::Idle:
+		// We wait here until a reset is signaled
+		break;
+	case AbccMisoStates::Reserved1:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			addFrame = true;
+			mMisoVars.eState = AbccMisoStates::Reserved2;
+		}
+		break;
+	case AbccMisoStates::Reserved2:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			addFrame = true;
+			mMisoVars.eState = AbccMisoStates::LedStatus;
+		}
+		break;
+	case AbccMisoStates::LedStatus:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			addFrame = true;
+			mMisoVars.eState = AbccMisoStates::AnybusStatus;
+		}
+		break;
+	case AbccMisoStates::AnybusStatus:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			addFrame = true;
+			mMisoVars.eState = AbccMisoStates::SpiStatus;
+		}
+		break;
+	case AbccMisoStates::SpiStatus:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			mMisoVars.fNewRdPd = ((mMisoVars.lFrameData & ABP_SPI_STATUS_NEW_PD) == ABP_SPI_STATUS_NEW_PD);
+
+			if ((mMisoVars.lFrameData & (ABP_SPI_STATUS_LAST_FRAG | ABP_SPI_STATUS_M)) == ABP_SPI_STATUS_M)
+			{
+				// New message but not the last
+				mMisoVars.fNewMsg = true;
+
+				if (!mMisoVars.fFragmentation)
+				{
+					// Message fragmentation starts
+					mMisoVars.fFragmentation = true;
+					mMisoVars.fFirstFrag = true;
+					mMisoVars.fLastFrag = false;
+				}
+			}
+			else if ((mMisoVars.lFrameData & (ABP_SPI_STATUS_LAST_FRAG | ABP_SPI_STATUS_M)) == (ABP_SPI_STATUS_LAST_FRAG | ABP_SPI_STATUS_M))
+			{
+				// New message and last
+				mMisoVars.fNewMsg = true;
+
+				// Message fragmentation ends
+				mMisoVars.fLastFrag = true;
+				mMisoVars.fFirstFrag = !mMisoVars.fFragmentation;
+			}
+			else
+			{
+				// No new message
+				mMisoVars.fNewMsg = false;
+				mMisoVars.eMsgSubState = AbccMisoStates::MessageField_DataNotValid;
+				mMisoVars.wMdCnt = 0;
+				mMisoVars.wMdSize = 0;
+			}
+
+			addFrame = true;
+			mMisoVars.eState = AbccMisoStates::NetworkTime;
+		}
+		break;
+	case AbccMisoStates::NetworkTime:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			addFrame = true;
+
+			if (mMisoVars.dwMsgLenCnt != 0)
+			{
+				mMisoVars.eState = AbccMisoStates::MessageField;
+
+				if (mMisoVars.fNewMsg && mMisoVars.fFirstFrag)
+				{
+					RunAbccMisoMsgSubStateMachine(StateOperation::Reset, nullptr, nullptr);
+				}
+			}
+			else if (mMisoVars.dwPdLen != 0)
+			{
+				mMisoVars.eState = AbccMisoStates::ReadProcessData;
+			}
+			else
+			{
+				mMisoVars.eState = AbccMisoStates::Crc32;
+			}
+		}
+		break;
+	case AbccMisoStates::MessageField:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			if (!RunAbccMisoMsgSubStateMachine(StateOperation::Run, &addFrame, &eMsgSubState))
+			{
+				// Error, transition to idle and wait for reset
+				mMisoVars.eState = AbccMisoStates::Idle;
+			}
+
+			if (addFrame && dataStaged && !IsEndOfMisoMessageRun())
+			{
+				// A single frame is added at the end of the run
+				addFrame = false;
+			}
+
+			if (mMisoVars.dwMsgLenCnt == 1)
+			{
+				if (mMisoVars.dwPdLen != 0)
+				{
+					mMisoVars.eState = AbccMisoStates::ReadProcessData;
+				}
+				else
+				{
+					mMisoVars.eState = AbccMisoStates::Crc32;
+				}
+			}
+
+			mMisoVars.dwMsgLenCnt--;
+		}
+		break;
+	case AbccMisoStates::ReadProcessData:
+		if (mAggregateProcessData)
+		{
+			// A single frame is added at the end of the block
+			mMisoVars.dwPdLen -= byte_count;
+
+			if (mMisoVars.dwPdLen == 0)
+			{
+				mMisoVars.eState = AbccMisoStates::Crc32;
+				addFrame = true;
+			}
+			else if (mMisoStagedData.size() >= AGGREGATED_FRAME_MAX_LENGTH)
+			{
+				addFrame = true;
+			}
+		}
+		else if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			if (mMisoVars.dwPdLen == 1)
+			{
+				mMisoVars.eState = AbccMisoStates::Crc32;
+			}
+
+			addFrame = true;
+			mMisoVars.dwPdLen--;
+		}
+		break;
+	case AbccMisoStates::Crc32:
+		if (mMisoVars.dwByteCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eState))
+		{
+			addFrame = true;
+			mMisoVars.eState = AbccMisoStates::Idle;
+		}
+		break;
+	case AbccMisoStates::MessageField_Size:
+	case AbccMisoStates::MessageField_Reserved1:
+	case AbccMisoStates::MessageField_SourceId:
+	case AbccMisoStates::MessageField_Object:
+	case AbccMisoStates::MessageField_Instance:
+	case AbccMisoStates::MessageField_Command:
+	case AbccMisoStates::MessageField_Reserved2:
+	case AbccMisoStates::MessageField_CommandExtension:
+	case AbccMisoStates::MessageField_Data:
+	default:
+		mMisoVars.eState = AbccMisoStates::Idle;
+		break;
+	}
+
+	if (end_of_transfer && IsEndOfTransaction())
+	{
+		if (mMisoVars.eState != AbccMisoStates::Idle)
+		{
+			// We have a fragmented message
+			if (dataStaged)
+			{
+				// As when processed bytewise, the byte ending the transfer is
+				// not part of the committed block
+				mMisoStagedData.pop_back();
+				FlushMisoStagedData(eMisoState_Current);
+				mMisoVars.lFramesFirstSample = first_sample;
+			}
+
+			AddFragFrame(SpiChannel::MISO, mMisoVars.lFramesFirstSample, mCsEventSample);
+
+			mMisoVars.eState = AbccMisoStates::Idle;
+			mMisoVars.lFrameData = 0;
+			mMisoVars.dwByteCnt = 0;
+			return true;
+		}
+	}
+
+	if (addFrame)
+	{
+		if (eMisoState_Current == AbccMisoStates::MessageField)
+		{
+			ProcessMisoFrame(eMsgSubState, mMisoVars.lFrameData, mMisoVars.lFramesFirstSample);
+		}
+		else
+		{
+			ProcessMisoFrame(eMisoState_Current, mMisoVars.lFrameData, mMisoVars.lFramesFirstSample);
+
+			if ((eMisoState_Current == AbccMisoStates::Crc32) && (mMisoVars.fLastFrag && (mMisoVars.dwMsgLenCnt == 0)))
+			{
+				RunAbccMisoMsgSubStateMachine(StateOperation::Reset, nullptr, nullptr);
+			}
+		}
+
+		// Reset the state variables
+		mMisoVars.lFrameData = 0;
+		mMisoVars.dwByteCnt = 0;
+	}
+
+	if (end_of_transfer && IsEndOfTransaction())
+	{
+		mMisoVars.eState = AbccMisoStates::Idle;
+		mMisoVars.lFrameData = 0;
+		mMisoVars.dwByteCnt = 0;
+	}
+
+	return (mMisoVars.eState == AbccMisoStates::Idle);
+}
+
+bool AbccDecoder::RunAbccMosiStateMachine(StateOperation operation, AcquisitionStatus acquisition_status, U64 mosi_data, U32 byte_count, S64 first_sample, bool end_of_transfer)
+{
+	AbccMosiStates::Enum eMsgSubState = AbccMosiStates::MessageField_Size;
+	AbccMosiStates::Enum eMosiState_Current;
+	bool addFrame = false;
+	bool dataStaged = false;
+
+	eMosiState_Current = mMosiVars.eState;
+
+	// If an error is signaled we jump into IDLE and wait to be reset.
+	// A reset should be logically signaled when CS# is brought HIGH.
+	// This would essentially indicate the begining of a new transaction.
+	if ((operation != StateOperation::Reset) && ((acquisition_status == AcquisitionStatus::Error) || !IsEnableActive()))
+	{
+		FlushMosiStagedData(mMosiVars.eState);
+
+		if (mMosiVars.dwByteCnt == 0)
+		{
+			mMosiVars.lFramesFirstSample = first_sample;
+		}
+
+		mMosiVars.eState = AbccMosiStates::Idle;
+
+		AddFragFrame(SpiChannel::MOSI, mMosiVars.lFramesFirstSample, mCsEventSample);
+
+		return true;
+	}
+
+	if (mMosiVars.eState == AbccMosiStates::Idle)
+	{
+		mMosiVars.oChecksum.Init();
+		mMosiVars.lFrameData = 0;
+		mMosiVars.dwByteCnt = 0;
+		mMosiStagedData.clear();
+		mMosiPacketData.clear();
+
+		if (operation == StateOperation::Reset)
+		{
+			mMosiVars.eState = AbccMosiStates::SpiControl;
+			eMosiState_Current = mMosiVars.eState;
+		}
+	}
+
+	if (mMosiVars.dwByteCnt == 0)
+	{
+		mMosiVars.lFramesFirstSample = first_sample;
+	}
+
+	if (IsMosiDataAggregated())
+	{
+		// The block is staged, it does not fit into the frame data
+		StageData(&mMosiStagedData, mosi_data, byte_count);
+		dataStaged = true;
+	}
+	else
+	{
+		mMosiVars.lFrameData |= (mosi_data << (8 * mMosiVars.dwByteCnt));
+	}
+
+	mMosiVars.dwByteCnt += byte_count;
+
+	if (mMosiVars.eState != AbccMosiStates::Crc32)
+	{
+		AppendPacketData(&mMosiPacketData, mosi_data, byte_count);
+	}
+
+	switch (mMosiVars.eState)
+	{
+	case AbccMosiStates::Idle:
+		// We wait here until a reset is signaled
+		break;
+	case AbccMosiStates::SpiControl:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			mMosiVars.fWrPdValid = ((mMosiVars.lFrameData & ABP_SPI_CTRL_WRPD_VALID) == ABP_SPI_CTRL_WRPD_VALID);
+
+			if ((mMosiVars.lFrameData & (ABP_SPI_CTRL_LAST_FRAG | ABP_SPI_CTRL_M)) == ABP_SPI_CTRL_M)
+			{
+				// New message but not the last
+				mMosiVars.fNewMsg = true;
+
+				if (!mMosiVars.fFragmentation)
+				{
+					// Message fragmentation starts
+					mMosiVars.fFragmentation = true;
+					mMosiVars.fFirstFrag = true;
+					mMosiVars.fLastFrag = false;
+				}
+			}
+			else if ((mMosiVars.lFrameData & (ABP_SPI_CTRL_LAST_FRAG | ABP_SPI_CTRL_M)) == (ABP_SPI_CTRL_LAST_FRAG | ABP_SPI_CTRL_M))
+			{
+				// New message and last
+				mMosiVars.fNewMsg = true;
+
+				// Message fragmentation ends
+				mMosiVars.fLastFrag = true;
+				mMosiVars.fFirstFrag = !mMosiVars.fFragmentation;
+			}
+			else
+			{
+				// No new message
+				mMosiVars.fNewMsg = false;
+				mMosiVars.eMsgSubState = AbccMosiStates::MessageField_DataNotValid;
+				mMosiVars.wMdCnt = 0;
+				mMosiVars.wMdSize = 0;
+			}
+
+			addFrame = true;
+			mMosiVars.eState = AbccMosiStates::Reserved1;
+		}
+		break;
+	case AbccMosiStates::Reserved1:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+			mMosiVars.eState = AbccMosiStates::MessageLength;
+		}
+		break;
+	case AbccMosiStates::MessageLength:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+			mMosiVars.dwMsgLen = (U32)mMosiVars.lFrameData * 2;
+			mMosiVars.dwMsgLenCnt = mMosiVars.dwMsgLen;
+			mMisoVars.dwMsgLen = mMosiVars.dwMsgLen;
+			mMisoVars.dwMsgLenCnt = mMosiVars.dwMsgLen;
+			mMosiVars.eState = AbccMosiStates::ProcessDataLength;
+		}
+		break;
+	case AbccMosiStates::ProcessDataLength:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+			mMosiVars.dwPdLen = (U32)mMosiVars.lFrameData * 2;
+			mMisoVars.dwPdLen = mMosiVars.dwPdLen;
+			mMosiVars.eState = AbccMosiStates::ApplicationStatus;
+		}
+		break;
+	case AbccMosiStates::ApplicationStatus:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+			mMosiVars.eState = AbccMosiStates::InterruptMask;
+		}
+		break;
+	case AbccMosiStates::InterruptMask:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+
+			if (mMosiVars.dwMsgLenCnt != 0)
+			{
+				mMosiVars.eState = AbccMosiStates::MessageField;
+
+				if (mMosiVars.fNewMsg && mMosiVars.fFirstFrag)
+				{
+					RunAbccMosiMsgSubStateMachine(StateOperation::Reset, nullptr, nullptr);
+				}
+			}
+			else if (mMosiVars.dwPdLen != 0)
+			{
+				mMosiVars.eState = AbccMosiStates::WriteProcessData;
+			}
+			else
+			{
+				mMosiVars.eState = AbccMosiStates::Crc32;
+			}
+		}
+		break;
+	case AbccMosiStates::MessageField:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			if (!RunAbccMosiMsgSubStateMachine(StateOperation::Run, &addFrame, &eMsgSubState))
+			{
+				// Error, transition to idle and wait for reset
+				mMosiVars.eState = AbccMosiStates::Idle;
+			}
+
+			if (addFrame && dataStaged && !IsEndOfMosiMessageRun())
+			{
+				// A single frame is added at the end of the run
+				addFrame = false;
+			}
+
+			if (mMosiVars.dwMsgLenCnt == 1)
+			{
+				if (mMosiVars.dwPdLen != 0)
+				{
+					mMosiVars.eState = AbccMosiStates::WriteProcessData;
+				}
+				else
+				{
+					mMosiVars.eState = AbccMosiStates::Crc32;
+				}
+			}
+
+			mMosiVars.dwMsgLenCnt--;
+		}
+		break;
+	case AbccMosiStates::WriteProcessData:
+		if (mAggregateProcessData)
+		{
+			// A single frame is added at the end of the block
+			mMosiVars.dwPdLen -= byte_count;
+
+			if (mMosiVars.dwPdLen == 0)
+			{
+				mMosiVars.eState = AbccMosiStates::Crc32;
+				addFrame = true;
+			}
+			else if (mMosiStagedData.size() >= AGGREGATED_FRAME_MAX_LENGTH)
+			{
+				addFrame = true;
+			}
+		}
+		else if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			if (mMosiVars.dwPdLen == 1)
+			{
+				mMosiVars.eState = AbccMosiStates::Crc32;
+			}
+
+			addFrame = true;
+			mMosiVars.dwPdLen--;
+		}
+		break;
+	case AbccMosiStates::Crc32:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+			mMosiVars.eState = AbccMosiStates::Pad;
+		}
+		break;
+	case AbccMosiStates::Pad:
+		if (mMosiVars.dwByteCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eState))
+		{
+			addFrame = true;
+			mMosiVars.eState = AbccMosiStates::Idle;
+		}
+		break;
+	case AbccMosiStates::MessageField_Size:
+	case AbccMosiStates::MessageField_Reserved1:
+	case AbccMosiStates::MessageField_SourceId:
+	case AbccMosiStates::MessageField_Object:
+	case AbccMosiStates::MessageField_Instance:
+	case AbccMosiStates::MessageField_Command:
+	case AbccMosiStates::MessageField_Reserved2:
+	case AbccMosiStates::MessageField_CommandExtension:
+	case AbccMosiStates::MessageField_Data:
+	default:
+		mMosiVars.eState = AbccMosiStates::Idle;
+		break;
+	}
+
+	if (end_of_transfer && IsEndOfTransaction())
+	{
+		if (mMosiVars.eState != AbccMosiStates::Idle)
+		{
+			// We have a fragmented message
+			if (dataStaged)
+			{
+				// As when processed bytewise, the byte ending the transfer is
+				// not part of the committed block
+				mMosiStagedData.pop_back();
+				FlushMosiStagedData(eMosiState_Current);
+				mMosiVars.lFramesFirstSample = first_sample;
+			}
+
+			AddFragFrame(SpiChannel::MOSI, mMosiVars.lFramesFirstSample, mCsEventSample);
+
+			mMosiVars.eState = AbccMosiStates::Idle;
+			mMosiVars.lFrameData = 0;
+			mMosiVars.dwByteCnt = 0;
+			return true;
+		}
+	}
+
+	if (addFrame)
+	{
+		if (eMosiState_Current == AbccMosiStates::MessageField)
+		{
+			ProcessMosiFrame(eMsgSubState, mMosiVars.lFrameData, mMosiVars.lFramesFirstSample);
+		}
+		else
+		{
+			ProcessMosiFrame(eMosiState_Current, mMosiVars.lFrameData, mMosiVars.lFramesFirstSample);
+
+			if ((eMosiState_Current == AbccMosiStates::Crc32) && (mMosiVars.fLastFrag && (mMosiVars.dwMsgLenCnt == 0)))
+			{
+				RunAbccMosiMsgSubStateMachine(StateOperation::Reset, nullptr, nullptr);
+			}
+		}
+
+		// Reset the state variables
+		mMosiVars.lFrameData = 0;
+		mMosiVars.dwByteCnt = 0;
+	}
+
+	if (end_of_transfer && IsEndOfTransaction())
+	{
+		mMosiVars.eState = AbccMosiStates::Idle;
+		mMosiVars.lFrameData = 0;
+		mMosiVars.dwByteCnt = 0;
+	}
+
+	return (mMosiVars.eState == AbccMosiStates::Idle);
+}
+
+bool AbccDecoder::RunAbccMisoMsgSubStateMachine(StateOperation operation, bool* add_frame_ptr, AbccMisoStates::Enum* substate_ptr)
+{
+	if (operation == StateOperation::Reset)
+	{
+		// Perform checks here that we were in the last state and that the
+		// number of bytes seen in this state matched the header's msg len specifier
+		// In such cases a "framing error" should be signaled
+		mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Size;
+		mMisoVars.bFrameSizeCnt = 0;
+		return true;
+	}
+
+	if ((add_frame_ptr == nullptr) || (substate_ptr == nullptr))
+	{
+		return false;
+	}
+
+	*substate_ptr = mMisoVars.eMsgSubState;
+	mMisoVars.bFrameSizeCnt++;
+
+	switch (mMisoVars.eMsgSubState)
+	{
+	case AbccMisoStates::MessageField_Size:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Reserved1;
+		}
+		break;
+	case AbccMisoStates::MessageField_Reserved1:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_SourceId;
+		}
+		break;
+	case AbccMisoStates::MessageField_SourceId:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Object;
+		}
+		break;
+	case AbccMisoStates::MessageField_Object:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Instance;
+		}
+		break;
+	case AbccMisoStates::MessageField_Instance:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Command;
+		}
+		break;
+	case AbccMisoStates::MessageField_Command:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Reserved2;
+		}
+		break;
+	case AbccMisoStates::MessageField_Reserved2:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_CommandExtension;
+		}
+		break;
+	case AbccMisoStates::MessageField_CommandExtension:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Data;
+		}
+		break;
+	case AbccMisoStates::MessageField_Data:
+	case AbccMisoStates::MessageField_DataNotValid:
+		if (mMisoVars.bFrameSizeCnt >= GET_MISO_FRAME_SIZE(mMisoVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+		}
+		break;
+	case AbccMisoStates::Idle:
+	case AbccMisoStates::Reserved1:
+	case AbccMisoStates::Reserved2:
+	case AbccMisoStates::LedStatus:
+	case AbccMisoStates::AnybusStatus:
+	case AbccMisoStates::SpiStatus:
+	case AbccMisoStates::NetworkTime:
+	case AbccMisoStates::MessageField:
+	case AbccMisoStates::ReadProcessData:
+	case AbccMisoStates::Crc32:
+	default:
+		mMisoVars.eMsgSubState = AbccMisoStates::MessageField_Data;
+		return false;
+	}
+
+	if (*add_frame_ptr == true)
+	{
+		mMisoVars.bFrameSizeCnt = 0;
+	}
+
+	return true;
+}
+
+bool AbccDecoder::RunAbccMosiMsgSubStateMachine(StateOperation operation, bool* add_frame_ptr, AbccMosiStates::Enum* substate_ptr)
+{
+	if (operation == StateOperation::Reset)
+	{
+		// Perform checks here that we were in the last state and that the
+		// number of bytes seen in this state matched the header's msg len specifier
+		// In such cases a "framing error" should be signaled
+		mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Size;
+		mMosiVars.bFrameSizeCnt = 0;
+		return true;
+	}
+
+	if ((add_frame_ptr == nullptr) || (substate_ptr == nullptr))
+	{
+		return false;
+	}
+
+	*substate_ptr = mMosiVars.eMsgSubState;
+	mMosiVars.bFrameSizeCnt++;
+
+	switch (mMosiVars.eMsgSubState)
+	{
+	case AbccMosiStates::MessageField_Size:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Reserved1;
+		}
+		break;
+	case AbccMosiStates::MessageField_Reserved1:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_SourceId;
+		}
+		break;
+	case AbccMosiStates::MessageField_SourceId:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Object;
+		}
+		break;
+	case AbccMosiStates::MessageField_Object:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Instance;
+		}
+		break;
+	case AbccMosiStates::MessageField_Instance:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Command;
+		}
+		break;
+	case AbccMosiStates::MessageField_Command:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Reserved2;
+		}
+		break;
+	case AbccMosiStates::MessageField_Reserved2:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_CommandExtension;
+		}
+		break;
+	case AbccMosiStates::MessageField_CommandExtension:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+			mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Data;
+		}
+		break;
+	case AbccMosiStates::MessageField_Data:
+	case AbccMosiStates::MessageField_DataNotValid:
+		if (mMosiVars.bFrameSizeCnt >= GET_MOSI_FRAME_SIZE(mMosiVars.eMsgSubState))
+		{
+			*add_frame_ptr = true;
+		}
+		break;
+	case AbccMosiStates::Pad:
+	case AbccMosiStates::Crc32:
+	case AbccMosiStates::WriteProcessData:
+	case AbccMosiStates::MessageField:
+	case AbccMosiStates::InterruptMask:
+	case AbccMosiStates::ApplicationStatus:
+	case AbccMosiStates::ProcessDataLength:
+	case AbccMosiStates::MessageLength:
+	case AbccMosiStates::Reserved1:
+	case AbccMosiStates::SpiControl:
+	case AbccMosiStates::Idle:
+	default:
+		mMosiVars.eMsgSubState = AbccMosiStates::MessageField_Data;
+		return false;
+	}
+
+	if (*add_frame_ptr == true)
+	{
+		mMosiVars.bFrameSizeCnt = 0;
+	}
+
+	return true;
+}
+
+bool AbccDecoder::IsMisoDataAggregated()
+{
+	if (mMisoVars.eState == AbccMisoStates::ReadProcessData)
+	{
+		return mAggregateProcessData;
+	}
+
+	return (mAggregateMessageData &&
+		(mMisoVars.eState == AbccMisoStates::MessageField) &&
+		((mMisoVars.eMsgSubState == AbccMisoStates::MessageField_Data) ||
+		 (mMisoVars.eMsgSubState == AbccMisoStates::MessageField_DataNotValid)));
+}
+
+bool AbccDecoder::IsMosiDataAggregated()
+{
+	if (mMosiVars.eState == AbccMosiStates::WriteProcessData)
+	{
+		return mAggregateProcessData;
+	}
+
+	return (mAggregateMessageData &&
+		(mMosiVars.eState == AbccMosiStates::MessageField) &&
+		((mMosiVars.eMsgSubState == AbccMosiStates::MessageField_Data) ||
+		 (mMosiVars.eMsgSubState == AbccMosiStates::MessageField_DataNotValid)));
+}
+
+bool AbccDecoder::IsEndOfMisoMessageRun()
+{
+	// A run ends with the message field of the packet, with the valid message
+	// data (the remaining bytes are not valid), or when the frame is full
+	U32 mdCnt = (U32)mMisoVars.wMdCnt + (U32)mMisoStagedData.size();
+
+	return ((mMisoVars.dwMsgLenCnt == 1) ||
+		((mMisoVars.eMsgSubState == AbccMisoStates::MessageField_Data) && (mdCnt == mMisoVars.wMdSize)) ||
+		(mMisoStagedData.size() >= AGGREGATED_FRAME_MAX_LENGTH));
+}
+
+bool AbccDecoder::IsEndOfMosiMessageRun()
+{
+	U32 mdCnt = (U32)mMosiVars.wMdCnt + (U32)mMosiStagedData.size();
+
+	return ((mMosiVars.dwMsgLenCnt == 1) ||
+		((mMosiVars.eMsgSubState == AbccMosiStates::MessageField_Data) && (mdCnt == mMosiVars.wMdSize)) ||
+		(mMosiStagedData.size() >= AGGREGATED_FRAME_MAX_LENGTH));
+}
+
+void AbccDecoder::StageData(std::vector<U8>* buffer, U64 data, U32 byte_count)
+{
+	for (U32 i = 0; i < byte_count; i++)
+	{
+		buffer->push_back((U8)(data >> (i * BITS_PER_BYTE)));
+	}
+}
+
+void AbccDecoder::FlushMisoStagedData(AbccMisoStates::Enum state)
+{
+	// A block cut short by the end of the packet is still committed, as the
+	// bytes received would have been when processed bytewise
+	if (!mMisoStagedData.empty())
+	{
+		if (state == AbccMisoStates::MessageField)
+		{
+			state = mMisoVars.eMsgSubState;
+		}
+
+		ProcessMisoFrame(state, 0, mMisoVars.lFramesFirstSample);
+		mMisoVars.lFrameData = 0;
+		mMisoVars.dwByteCnt = 0;
+	}
+}
+
+void AbccDecoder::FlushMosiStagedData(AbccMosiStates::Enum state)
+{
+	if (!mMosiStagedData.empty())
+	{
+		if (state == AbccMosiStates::MessageField)
+		{
+			state = mMosiVars.eMsgSubState;
+		}
+
+		ProcessMosiFrame(state, 0, mMosiVars.lFramesFirstSample);
+		mMosiVars.lFrameData = 0;
+		mMosiVars.dwByteCnt = 0;
+	}
+}
+
+void AbccDecoder::RestorePreviousStateVars()
+{
+	// In the event of an error packet that would otherwise result in a
+	// 'retransmit' event, this routine must be called to put the revelant
+	// state variable back to the last known 'good state'
+	mMisoVars.wMdCnt = mPreviousMisoVars.wMdCnt;
+	mMisoVars.fFirstFrag = mPreviousMisoVars.fFirstFrag;
+	mMisoVars.fLastFrag = mPreviousMisoVars.fLastFrag;
+	mMisoVars.fFragmentation = mPreviousMisoVars.fFragmentation;
+	mMisoVars.eMsgSubState = mPreviousMisoVars.eMsgSubState;
+
+	mMosiVars.wMdCnt = mPreviousMosiVars.wMdCnt;
+	mMosiVars.fFirstFrag = mPreviousMosiVars.fFirstFrag;
+	mMosiVars.fLastFrag = mPreviousMosiVars.fLastFrag;
+	mMosiVars.fFragmentation = mPreviousMosiVars.fFragmentation;
+	mMosiVars.eMsgSubState = mPreviousMosiVars.eMsgSubState;
+}
@@ -0,0 +1,347 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccDecoder.h
+**    Summary: SDK-independent ABCC SPI protocol decoder. Consumes acquired
+**             SPI transfers and emits frame and packet events to a sink.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_DECODER_H
+#define ABCC_DECODER_H
+
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AbccSpiAnalyzerTypes.h"
+#include "AbccCrc.h"
+
+/* Frame display flags, identical to the definitions of the Logic SDK */
+#ifndef DISPLAY_AS_ERROR_FLAG
+#define DISPLAY_AS_ERROR_FLAG ( 1 << 7 )
+#endif
+#ifndef DISPLAY_AS_WARNING_FLAG
+#define DISPLAY_AS_WARNING_FLAG ( 1 << 6 )
+#endif
+
+#define BITS_PER_BYTE						8
+#define MAX_BYTES_PER_TRANSFER				2
+
+/* Chip select (or 3-wire idle) events accompanying an acquired transfer */
+
+/* CS was not asserted while the transfer was clocked */
+#define ABCC_CS_INACTIVE_EVENT				( 1 << 0 )
+
+/* CS is deasserted after the transfer, the transaction ends */
+#define ABCC_CS_END_EVENT					( 1 << 1 )
+
+/* 3-wire: the clock idled too long within a transaction */
+#define ABCC_CS_IDLE_TIMEOUT_EVENT			( 1 << 2 )
+
+// Enum for indicating when to reset a statemachine
+enum class StateOperation : U32
+{
+	Run,
+	Reset,
+	SizeOfEnum
+};
+
+// Enum for indicating whether or not the analyzer succeeded in acquiring an SPI byte
+enum class AcquisitionStatus : U32
+{
+	OK,
+	Reset,
+	Error,
+	SizeOfEnum
+};
+
+enum class PacketType : U32
+{
+	Empty,
+	Command,
+	Response,
+	MessageFragment,
+	ErrorResponse,
+	ProtocolError,
+	ProtocolEvent,
+	ChecksumError,
+	MultiEvent,
+	MultiEventWithError,
+	Cancel,
+	SizeOfEnum
+};
+
+extern const AbccMosiInfo_t asMosiStates[];
+extern const AbccMisoInfo_t asMisoStates[];
+extern const AbccMsgInfo_t asMsgStates[];
+
+/* One SPI transfer (8 or 16 bits) as acquired from MOSI/MISO */
+typedef struct AbccTransfer
+{
+	U64 lMosiData;
+	U64 lMisoData;
+	U64 alFirstSamples[MAX_BYTES_PER_TRANSFER];
+	U64 alLastSamples[MAX_BYTES_PER_TRANSFER];
+	U32 dwByteCount;
+	AcquisitionStatus eStatus;
+	U8 bCsEvents;
+	U64 lCsEventSample;
+} AbccTransfer_t;
+
+/* A decoded field or error, laid out like the Logic SDK's Frame */
+typedef struct AbccFrame
+{
+	S64 lStartingSampleInclusive;
+	S64 lEndingSampleInclusive;
+	U64 lData1;
+	U64 lData2;
+	U8 bType;
+	U8 bFlags;
+} AbccFrame_t;
+
+typedef struct MosiVars
+{
+	S64 lFramesFirstSample;
+	U64 lFrameData;
+	PacketType ePacketType;
+	AbccMosiStates::Enum eState;
+	AbccMosiStates::Enum eMsgSubState;
+	MsgHeaderInfo_t sMsgHeader;
+	AbccCrc oChecksum;
+	U32 dwPdLen;
+	U32 dwPdCnt;
+	U32 dwMsgLen;
+	U32 dwMsgLenCnt;
+	U32 dwByteCnt;
+	U8 bFrameSizeCnt;
+	U16 wMdCnt;
+	U16 wMdSize;
+	U8 bLastToggleState;
+	U8 bLastApplSts;
+	bool fNewMsg;
+	bool fErrorRsp;
+	bool fFragmentation;
+	bool fFirstFrag;
+	bool fLastFrag;
+	bool fWrPdValid;
+	bool fReadyForNewPacket;
+} MosiVars_t;
+
+typedef struct MisoVars
+{
+	S64 lFramesFirstSample;
+	U64 lFrameData;
+	PacketType ePacketType;
+	AbccMisoStates::Enum eState;
+	AbccMisoStates::Enum eMsgSubState;
+	MsgHeaderInfo_t sMsgHeader;
+	AbccCrc oChecksum;
+	U32 dwLastTimestamp;
+	U32 dwPdLen;
+	U32 dwPdCnt;
+	U32 dwMsgLen;
+	U32 dwMsgLenCnt;
+	U32 dwByteCnt;
+	U8 bFrameSizeCnt;
+	U16 wMdCnt;
+	U16 wMdSize;
+	U8 bLastAnbSts;
+	bool fNewMsg;
+	bool fErrorRsp;
+	bool fFragmentation;
+	bool fFirstFrag;
+	bool fLastFrag;
+	bool fNewRdPd;
+	bool fReadyForNewPacket;
+} MisoVars_t;
+
+/*
+** @brief The state carried by the AbccDecoder from one transfer to the next.
+*/
+typedef struct AbccDecoderState
+{
+	MosiVars_t sMosiVars;
+	MisoVars_t sMisoVars;
+	MosiVars_t sPreviousMosiVars;
+	MisoVars_t sPreviousMisoVars;
+	bool fMosiReady;
+	bool fMisoReady;
+	U8 bCsEvents;
+	U64 lCsEventSample;
+	U64 lFrameEndSample;
+} AbccDecoderState_t;
+
+bool IsErrorPacketType(PacketType packet_type);
+
+/*
+** @brief Compare two decoder states. Decoders in the same state produce the
+**        same output for the same transfers.
+*/
+bool IsSameDecoderState(const AbccDecoderState_t& state_a, const AbccDecoderState_t& state_b);
+
+/*
+** @brief Receives the output of the AbccDecoder.
+*/
+class AbccDecoderSink
+{
+public:
+
+	virtual ~AbccDecoderSink() {}
+
+	/*******************************************************************************
+	** @brief Called for each decoded protocol field and for each error frame.
+	**
+	** @param frame - The decoded frame.
+	*/
+	virtual void OnFrame(const AbccFrame_t& frame) = 0;
+
+	/*******************************************************************************
+	** @brief Called to store the bytes of an aggregated frame, ahead of the
+	**        OnFrame() call for the frame.
+	**
+	** @param data - The bytes covered by the frame.
+	** @param length - The number of bytes.
+	**
+	** @return A reference to the stored bytes, kept in the frame's lData1
+	**         along with the length (see AGGREGATED_FRAME_DATA1()).
+	*/
+	virtual U64 OnFrameData(const U8* data, U32 length) = 0;
+
+	/*******************************************************************************
+	** @brief Called when a packet completed on both channels or was cancelled.
+	**
+	** @param mosi_packet_type - Summary of the MOSI events, Cancel if the packet
+	**                           was aborted.
+	** @param miso_packet_type - Summary of the MISO events.
+	*/
+	virtual void OnPacketEnd(PacketType mosi_packet_type, PacketType miso_packet_type) = 0;
+};
+
+/*
+** @brief The ABCC SPI protocol state machines, independent of the way the
+**        SPI transfers are acquired.
+*/
+class AbccDecoder
+{
+public:
+
+	AbccDecoder();
+
+	/*******************************************************************************
+	** @brief Set the sink which receives the decoded frames and packets.
+	*/
+	void SetSink(AbccDecoderSink* sink);
+
+	/*******************************************************************************
+	** @brief Emit one frame per process data block instead of one per byte.
+	**        The bytes are passed to the sink's OnFrameData().
+	*/
+	void SetAggregateProcessData(bool aggregate);
+
+	/*******************************************************************************
+	** @brief Emit one frame per run of message data within a packet instead of
+	**        one per byte. The bytes are passed to the sink's OnFrameData().
+	*/
+	void SetAggregateMessageData(bool aggregate);
+
+	/*******************************************************************************
+	** @brief Put the decoder into its initial state, waiting for a new packet.
+	*/
+	void Reset();
+
+	/*******************************************************************************
+	** @brief Run the MOSI and MISO state machines on an acquired transfer.
+	**
+	** @param transfer - The transfer, including any chip select events.
+	*/
+	void ProcessTransfer(const AbccTransfer_t* transfer);
+
+	/*******************************************************************************
+	** @brief Take a snapshot of the decoder state, e.g. at a packet boundary.
+	*/
+	void GetState(AbccDecoderState_t* state) const;
+
+	/*******************************************************************************
+	** @brief Continue decoding from a snapshot taken with GetState().
+	*/
+	void SetState(const AbccDecoderState_t* state);
+
+	/*******************************************************************************
+	** @brief The raw bytes of the current packet on a channel, up to but not
+	**        including the CRC32 field. Cleared when the next packet starts.
+	*/
+	const std::vector<U8>& GetPacketData(SpiChannel_t channel) const;
+
+protected: // Members
+
+	AbccDecoderSink* mSink;
+
+	MosiVars_t mMosiVars;
+	MisoVars_t mMisoVars;
+
+	// Backup variables to recover from error cases
+	// that require knowledge of the last valid state
+	MosiVars_t mPreviousMosiVars;
+	MisoVars_t mPreviousMisoVars;
+
+	bool mMosiReady;
+	bool mMisoReady;
+
+	U8 mCsEvents;
+	U64 mCsEventSample;
+	U64 mFrameEndSample;
+
+	// Process data or message data run of the current packet, when aggregated
+	bool mAggregateProcessData;
+	bool mAggregateMessageData;
+	std::vector<U8> mMosiStagedData;
+	std::vector<U8> mMisoStagedData;
+
+	// Raw bytes of the current packet, the CRC32 is computed over them in one
+	// call once the CRC32 field is reached
+	std::vector<U8> mMosiPacketData;
+	std::vector<U8> mMisoPacketData;
+
+protected: // Methods
+
+	inline bool IsEnableActive();
+	inline bool IsEndOfTransaction();
+
+	void AddFragFrame(SpiChannel_t channel, U64 first_sample, U64 last_sample);
+	void SignalReadyForNewPacket(SpiChannel_t channel);
+
+	void SetMosiPacketType(PacketType packet_type);
+	void SetMisoPacketType(PacketType packet_type);
+
+	void ProcessMosiFrame(AbccMosiStates::Enum state, U64 frame_data, S64 frames_first_sample);
+	void ProcessMisoFrame(AbccMisoStates::Enum state, U64 frame_data, S64 frames_first_sample);
+
+	U32 GetMosiUnitSize(U32 bytes_available);
+	U32 GetMisoUnitSize(U32 bytes_available);
+
+	U32 ProcessMosiUnit(AcquisitionStatus acquisition_status, const AbccTransfer_t* transfer, U32 byte_index);
+	U32 ProcessMisoUnit(AcquisitionStatus acquisition_status, const AbccTransfer_t* transfer, U32 byte_index);
+
+	bool RunAbccMosiStateMachine(StateOperation operation, AcquisitionStatus acquisition_status, U64 mosi_data, U32 byte_count, S64 first_sample, bool end_of_transfer);
+	bool RunAbccMisoStateMachine(StateOperation operation, AcquisitionStatus acquisition_status, U64 miso_data, U32 byte_count, S64 first_sample, bool end_of_transfer);
+
+	bool RunAbccMisoMsgSubStateMachine(StateOperation operation, bool* add_frame_ptr, AbccMisoStates::Enum* substate_ptr);
+	bool RunAbccMosiMsgSubStateMachine(StateOperation operation, bool* add_frame_ptr, AbccMosiStates::Enum* substate_ptr);
+
+	bool IsMosiDataAggregated();
+	bool IsMisoDataAggregated();
+	bool IsEndOfMosiMessageRun();
+	bool IsEndOfMisoMessageRun();
+
+	void StageData(std::vector<U8>* buffer, U64 data, U32 byte_count);
+	void FlushMisoStagedData(AbccMisoStates::Enum state);
+	void FlushMosiStagedData(AbccMosiStates::Enum state);
+	void AppendPacketData(std::vector<U8>* packet_data, U64 data, U32 byte_count);
+	void ComputePacketChecksum(AbccCrc* checksum, std::vector<U8>* packet_data);
+
+	void RestorePreviousStateVars();
+};
+
+#endif /* ABCC_DECODER_H */
@@ -0,0 +1,225 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccExportWriter.cpp
+**    Summary: Buffered writer of the export files.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <cfloat>
+#include <cstring>
+
+#include "AbccExportWriter.h"
+#include "AnalyzerHelpers.h"
+#include "AbccSpiAnalyzer.h"
+
+#define MAX_FIXED_DECIMALS		16
+
+AbccExportWriter::AbccExportWriter()
+	: mFile(nullptr),
+	mLength(0)
+{
+}
+
+AbccExportWriter::~AbccExportWriter()
+{
+	Close();
+}
+
+void AbccExportWriter::Open(const char* file)
+{
+	Close();
+
+	if (!mBuffer)
+	{
+		mBuffer.reset(new char[EXPORT_WRITER_BLOCK_SIZE]);
+	}
+
+	mFile = AnalyzerHelpers::StartFile(file);
+	mLength = 0;
+}
+
+void AbccExportWriter::Close()
+{
+	if (mFile != nullptr)
+	{
+		Flush();
+		AnalyzerHelpers::EndFile(mFile);
+		mFile = nullptr;
+	}
+}
+
+bool AbccExportWriter::IsOpen() const
+{
+	return (mFile != nullptr);
+}
+
+void AbccExportWriter::Flush()
+{
+	if ((mFile != nullptr) && (mLength > 0))
+	{
+		AnalyzerHelpers::AppendToFile((U8*)mBuffer.get(), (U32)mLength, mFile);
+	}
+
+	mLength = 0;
+}
+
+void AbccExportWriter::Write(const char* text, size_t length)
+{
+	if (mFile == nullptr)
+	{
+		return;
+	}
+
+	while (length > 0)
+	{
+		size_t count = EXPORT_WRITER_BLOCK_SIZE - mLength;
+
+		if (count > length)
+		{
+			count = length;
+		}
+
+		memcpy(&mBuffer[mLength], text, count);
+
+		text += count;
+		length -= count;
+		mLength += count;
+
+		if (mLength == EXPORT_WRITER_BLOCK_SIZE)
+		{
+			Flush();
+		}
+	}
+}
+
+void AbccExportWriter::Write(const char* text)
+{
+	Write(text, strlen(text));
+}
+
+void AbccExportWriter::Write(const std::string& text)
+{
+	Write(text.data(), text.length());
+}
+
+void AbccExportWriter::Write(char character)
+{
+	Write(&character, 1);
+}
+
+void AbccExportWriter::WriteUnsigned(U64 value)
+{
+	char text[EXPORT_WRITER_NUMBER_SIZE];
+
+	Write(text, FormatUnsigned(value, text));
+}
+
+void AbccExportWriter::WriteSigned(S64 value)
+{
+	char text[EXPORT_WRITER_NUMBER_SIZE];
+
+	Write(text, FormatSigned(value, text));
+}
+
+void AbccExportWriter::WriteHex(U64 value, U32 digits)
+{
+	char text[EXPORT_WRITER_NUMBER_SIZE];
+
+	Write(text, FormatHex(value, digits, text));
+}
+
+void AbccExportWriter::WriteFixed(double value, U32 decimals)
+{
+	// The integer part of the largest double, the point, and the decimals
+	char text[DBL_MAX_10_EXP + MAX_FIXED_DECIMALS + 4];
+	int length;
+
+	if (decimals > MAX_FIXED_DECIMALS)
+	{
+		decimals = MAX_FIXED_DECIMALS;
+	}
+
+	length = SNPRINTF(text, sizeof(text), "%.*f", (int)decimals, value);
+
+	if (length > 0)
+	{
+		Write(text, (size_t)length);
+	}
+}
+
+void AbccExportWriter::WriteTime(U64 sample, U64 trigger_sample, U32 sample_rate)
+{
+	char text[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+	AnalyzerHelpers::GetTimeString(sample, trigger_sample, sample_rate, text, sizeof(text));
+	Write(text);
+}
+
+size_t AbccExportWriter::FormatUnsigned(U64 value, char* text)
+{
+	char digits[EXPORT_WRITER_NUMBER_SIZE];
+	size_t count = 0;
+	size_t i;
+
+	// The digits are produced least significant first
+	do
+	{
+		digits[count++] = (char)('0' + (value % 10));
+		value /= 10;
+	} while (value != 0);
+
+	for (i = 0; i < count; i++)
+	{
+		text[i] = digits[count - 1 - i];
+	}
+
+	return count;
+}
+
+size_t AbccExportWriter::FormatSigned(S64 value, char* text)
+{
+	if (value < 0)
+	{
+		// Negated as unsigned, which also holds the magnitude of the minimum
+		text[0] = '-';
+		return FormatUnsigned(0 - (U64)value, &text[1]) + 1;
+	}
+
+	return FormatUnsigned((U64)value, text);
+}
+
+size_t AbccExportWriter::FormatHex(U64 value, U32 digits, char* text)
+{
+	const char hexDigits[] = "0123456789ABCDEF";
+	size_t count = 0;
+	size_t i;
+
+	if (digits > (EXPORT_WRITER_NUMBER_SIZE - 3))
+	{
+		digits = EXPORT_WRITER_NUMBER_SIZE - 3;
+	}
+
+	// Count the significant digits, then fill them in from the end
+	do
+	{
+		count++;
+	} while ((count < 16) && ((value >> (count * 4)) != 0));
+
+	if (count < digits)
+	{
+		count = digits;
+	}
+
+	text[0] = '0';
+	text[1] = 'x';
+
+	for (i = 0; i < count; i++)
+	{
+		text[2 + count - 1 - i] = (i < 16) ? hexDigits[(value >> (i * 4)) & 0xF] : '0';
+	}
+
+	return count + 2;
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccExportWriter.h
+**    Summary: Buffered writer of the export files.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_EXPORT_WRITER_H
+#define ABCC_EXPORT_WRITER_H
+
+#include <memory>
+#include <string>
+
+#include "LogicPublicTypes.h"
+
+/* Text is passed to the file in blocks of this size */
+#define EXPORT_WRITER_BLOCK_SIZE			( 1 << 20 )
+
+/* Large enough for any number formatted by the writer, including the
+** terminating null character */
+#define EXPORT_WRITER_NUMBER_SIZE			24
+
+/*
+** @brief Collects the text of an export file in a reusable buffer and passes
+**        it to the file one block at a time, instead of once per entry.
+**
+** Integers are formatted without going through a stream or allocating,
+** either directly into the buffer (Write*) or into a caller supplied
+** character array (Format*).
+*/
+class AbccExportWriter
+{
+public:
+
+	AbccExportWriter();
+	~AbccExportWriter();
+
+	/*******************************************************************************
+	** @brief Create the file, any previously opened file is closed first.
+	**
+	** @param file - Path of the file to create.
+	*/
+	void Open(const char* file);
+
+	/*******************************************************************************
+	** @brief Write the buffered text and close the file.
+	*/
+	void Close();
+
+	/*******************************************************************************
+	** @brief Whether a file is open.
+	*/
+	bool IsOpen() const;
+
+	/*******************************************************************************
+	** @brief Pass the buffered text to the file.
+	*/
+	void Flush();
+
+	void Write(const char* text, size_t length);
+	void Write(const char* text);
+	void Write(const std::string& text);
+	void Write(char character);
+
+	void WriteUnsigned(U64 value);
+	void WriteSigned(S64 value);
+
+	/*******************************************************************************
+	** @brief Write a number as "0x" followed by upper case hexadecimal digits.
+	**
+	** @param value - The number.
+	** @param digits - The minimum number of digits, padded with zeros.
+	*/
+	void WriteHex(U64 value, U32 digits);
+
+	/*******************************************************************************
+	** @brief Write a number in fixed point notation, as std::fixed would.
+	**
+	** @param value - The number.
+	** @param decimals - The number of decimals, at most 16.
+	*/
+	void WriteFixed(double value, U32 decimals);
+
+	/*******************************************************************************
+	** @brief Write the time of a sample, as AnalyzerHelpers::GetTimeString().
+	*/
+	void WriteTime(U64 sample, U64 trigger_sample, U32 sample_rate);
+
+	/*******************************************************************************
+	** @brief Format an integer into a character array.
+	**
+	** @param text - Receives the digits, at least EXPORT_WRITER_NUMBER_SIZE
+	**               characters. The text is not null terminated.
+	**
+	** @return The number of characters.
+	*/
+	static size_t FormatUnsigned(U64 value, char* text);
+	static size_t FormatSigned(S64 value, char* text);
+	static size_t FormatHex(U64 value, U32 digits, char* text);
+
+protected: // Members
+
+	void* mFile;
+	std::unique_ptr<char[]> mBuffer;	// EXPORT_WRITER_BLOCK_SIZE characters
+	size_t mLength;
+};
+
+#endif /* ABCC_EXPORT_WRITER_H */
@@ -0,0 +1,206 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccJitterAnalyzer.cpp
+**    Summary: Streaming analysis of the SPI packet period and the network
+**             time deltas against the nominal network cycle.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "AbccJitterAnalyzer.h"
+
+#define NANOSECONDS_PER_SECOND		1000000000.0
+
+AbccJitterAnalyzer::AbccJitterAnalyzer()
+{
+	Configure(0, 0, 0);
+}
+
+void AbccJitterAnalyzer::Configure(U32 sample_rate, U32 nominal_cycle_ns, U32 threshold_ns)
+{
+	mSampleRate = sample_rate;
+	mConfiguredThreshold = threshold_ns;
+	mFirstTimestamp = true;
+	mLastSample = 0;
+	mLastNetworkTime = 0;
+	mPending.clear();
+	mReady.clear();
+
+	memset(&mSummary, 0, sizeof(mSummary));
+	mSummary.dwNominalCycle = nominal_cycle_ns;
+
+	if (nominal_cycle_ns != 0)
+	{
+		mSummary.dwThreshold = (threshold_ns != 0) ? threshold_ns : (nominal_cycle_ns / JITTER_DEFAULT_THRESHOLD_DIVISOR);
+	}
+}
+
+void AbccJitterAnalyzer::AddTimestamp(U64 packet_id, S64 sample, U32 network_time)
+{
+	JitterInterval_t interval;
+
+	if (mFirstTimestamp)
+	{
+		mFirstTimestamp = false;
+		mLastSample = sample;
+		mLastNetworkTime = network_time;
+		return;
+	}
+
+	memset(&interval, 0, sizeof(interval));
+	interval.lPacketId = packet_id;
+	interval.lSample = sample;
+	interval.dwNetworkTime = network_time;
+	interval.dwNetworkDelta = network_time - mLastNetworkTime;
+
+	if (mSampleRate != 0)
+	{
+		interval.lSpiPeriod = (S64)((double)(sample - mLastSample) * NANOSECONDS_PER_SECOND / (double)mSampleRate + 0.5);
+	}
+
+	mLastSample = sample;
+	mLastNetworkTime = network_time;
+
+	if (mSummary.dwNominalCycle == 0)
+	{
+		mPending.push_back(interval);
+
+		if (mPending.size() >= JITTER_NOMINAL_ESTIMATE_INTERVALS)
+		{
+			EstimateNominalCycle();
+		}
+	}
+	else
+	{
+		AnalyzeInterval(interval);
+	}
+}
+
+void AbccJitterAnalyzer::Finish()
+{
+	if (!mPending.empty())
+	{
+		EstimateNominalCycle();
+	}
+}
+
+void AbccJitterAnalyzer::EstimateNominalCycle()
+{
+	std::vector<U32> deltas;
+
+	for (const JitterInterval_t& interval : mPending)
+	{
+		deltas.push_back(interval.dwNetworkDelta);
+	}
+
+	std::nth_element(deltas.begin(), deltas.begin() + deltas.size() / 2, deltas.end());
+	mSummary.dwNominalCycle = deltas[deltas.size() / 2];
+	mSummary.dwThreshold = (mConfiguredThreshold != 0) ? mConfiguredThreshold : (mSummary.dwNominalCycle / JITTER_DEFAULT_THRESHOLD_DIVISOR);
+
+	for (JitterInterval_t& interval : mPending)
+	{
+		AnalyzeInterval(interval);
+	}
+
+	mPending.clear();
+}
+
+void AbccJitterAnalyzer::AnalyzeInterval(JitterInterval_t& interval)
+{
+	S64 nominal = (S64)mSummary.dwNominalCycle;
+	S64 threshold = (S64)mSummary.dwThreshold;
+
+	interval.lNetworkDeviation = (S64)interval.dwNetworkDelta - nominal;
+	interval.lSpiDeviation = interval.lSpiPeriod - nominal;
+
+	if (std::llabs(interval.lNetworkDeviation) > threshold)
+	{
+		interval.bFlags |= JITTER_NETWORK_OUTLIER_FLAG;
+		mSummary.lNetworkOutliers++;
+	}
+
+	if (std::llabs(interval.lSpiDeviation) > threshold)
+	{
+		interval.bFlags |= JITTER_SPI_OUTLIER_FLAG;
+		mSummary.lSpiOutliers++;
+	}
+
+	AddDeviation(mSummary.sNetwork, interval.lNetworkDeviation);
+	AddDeviation(mSummary.sSpi, interval.lSpiDeviation);
+	mSummary.alHistogram[GetBin(interval.lNetworkDeviation)]++;
+
+	mReady.push_back(interval);
+}
+
+void AbccJitterAnalyzer::AddDeviation(JitterStatistics_t& statistics, S64 deviation)
+{
+	double delta = (double)deviation - statistics.rMean;
+
+	if ((statistics.lCount == 0) || (deviation < statistics.lMin))
+	{
+		statistics.lMin = deviation;
+	}
+
+	if ((statistics.lCount == 0) || (deviation > statistics.lMax))
+	{
+		statistics.lMax = deviation;
+	}
+
+	statistics.lCount++;
+	statistics.rMean += delta / (double)statistics.lCount;
+	statistics.rSumSquares += delta * ((double)deviation - statistics.rMean);
+}
+
+U32 AbccJitterAnalyzer::GetBin(S64 deviation)
+{
+	U64 magnitude = (U64)std::llabs(deviation);
+	U32 bin = 0;
+
+	while ((bin < (JITTER_HISTOGRAM_BINS - 1)) && (magnitude >= GetBinUpperBound(bin)))
+	{
+		bin++;
+	}
+
+	return bin;
+}
+
+U64 AbccJitterAnalyzer::GetBinUpperBound(U32 bin)
+{
+	return (U64)JITTER_HISTOGRAM_FIRST_BIN_NS << bin;
+}
+
+double AbccJitterAnalyzer::GetStandardDeviation(const JitterStatistics_t& statistics)
+{
+	if (statistics.lCount < 2)
+	{
+		return 0.0;
+	}
+
+	return sqrt(statistics.rSumSquares / (double)(statistics.lCount - 1));
+}
+
+bool AbccJitterAnalyzer::GetInterval(JitterInterval_t* interval)
+{
+	if (mReady.empty())
+	{
+		return false;
+	}
+
+	*interval = mReady.front();
+	mReady.pop_front();
+
+	return true;
+}
+
+const JitterSummary_t& AbccJitterAnalyzer::GetSummary() const
+{
+	return mSummary;
+}
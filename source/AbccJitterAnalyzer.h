@@ -0,0 +1,147 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccJitterAnalyzer.h
+**    Summary: Streaming analysis of the SPI packet period and the network
+**             time deltas against the nominal network cycle.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_JITTER_ANALYZER_H
+#define ABCC_JITTER_ANALYZER_H
+
+#include <deque>
+
+#include "LogicPublicTypes.h"
+
+/* The network time delta deviates from the nominal cycle by more than the threshold */
+#define JITTER_NETWORK_OUTLIER_FLAG			( 1 << 0 )
+
+/* The SPI packet period deviates from the nominal cycle by more than the threshold */
+#define JITTER_SPI_OUTLIER_FLAG				( 1 << 1 )
+
+/* Number of intervals used to estimate the nominal cycle, if not configured */
+#define JITTER_NOMINAL_ESTIMATE_INTERVALS	32
+
+/* The default outlier threshold is the nominal cycle divided by this value */
+#define JITTER_DEFAULT_THRESHOLD_DIVISOR	10
+
+/* Histogram of the absolute network time deviation. The first bin holds
+** deviations below JITTER_HISTOGRAM_FIRST_BIN_NS, each following bin doubles
+** the upper bound, and the last bin holds everything above */
+#define JITTER_HISTOGRAM_BINS				16
+#define JITTER_HISTOGRAM_FIRST_BIN_NS		64
+
+/* The interval between two consecutive timestamps */
+typedef struct JitterInterval
+{
+	U64 lPacketId;
+	S64 lSample;				// Sample of the second timestamp
+	U32 dwNetworkTime;			// The second timestamp
+	U32 dwNetworkDelta;			// Nanoseconds
+	S64 lSpiPeriod;				// Nanoseconds
+	S64 lNetworkDeviation;		// Nanoseconds from the nominal cycle
+	S64 lSpiDeviation;			// Nanoseconds from the nominal cycle
+	U8 bFlags;
+} JitterInterval_t;
+
+/* Running statistics of a deviation */
+typedef struct JitterStatistics
+{
+	U64 lCount;
+	S64 lMin;
+	S64 lMax;
+	double rMean;
+	double rSumSquares;			// Of the differences from the mean (Welford)
+} JitterStatistics_t;
+
+typedef struct JitterSummary
+{
+	U32 dwNominalCycle;			// Nanoseconds, 0 until known
+	U32 dwThreshold;			// Nanoseconds
+	JitterStatistics_t sNetwork;
+	JitterStatistics_t sSpi;
+	U64 lNetworkOutliers;
+	U64 lSpiOutliers;
+	U64 alHistogram[JITTER_HISTOGRAM_BINS];
+} JitterSummary_t;
+
+/*
+** @brief Computes the deviation of each interval between the network
+**        timestamps passed to it, in a single pass with constant memory.
+**
+** The network time of the ABCC counts nanoseconds and wraps at 32 bits, the
+** SPI period is measured between the samples of the timestamps. When the
+** nominal cycle is not configured, it is estimated as the median network time
+** delta of the first intervals, which are held back until it is known.
+*/
+class AbccJitterAnalyzer
+{
+public:
+
+	AbccJitterAnalyzer();
+
+	/*******************************************************************************
+	** @brief Set the parameters and discard any previous intervals.
+	**
+	** @param sample_rate - Sample rate of the capture in Hz.
+	** @param nominal_cycle_ns - The nominal network cycle, 0 to estimate it.
+	** @param threshold_ns - The outlier threshold, 0 for the default.
+	*/
+	void Configure(U32 sample_rate, U32 nominal_cycle_ns, U32 threshold_ns);
+
+	/*******************************************************************************
+	** @brief Add the network timestamp of a packet.
+	**
+	** @param packet_id - The ID of the packet.
+	** @param sample - The sample of the timestamp.
+	** @param network_time - The network time.
+	*/
+	void AddTimestamp(U64 packet_id, S64 sample, U32 network_time);
+
+	/*******************************************************************************
+	** @brief Signal that no more timestamps follow, releasing any intervals held
+	**        back to estimate the nominal cycle.
+	*/
+	void Finish();
+
+	/*******************************************************************************
+	** @brief Take the next analyzed interval.
+	**
+	** @param interval - Receives the interval.
+	**
+	** @return false if no interval is ready.
+	*/
+	bool GetInterval(JitterInterval_t* interval);
+
+	const JitterSummary_t& GetSummary() const;
+
+	/*******************************************************************************
+	** @brief The upper bound of a histogram bin in nanoseconds.
+	*/
+	static U64 GetBinUpperBound(U32 bin);
+
+	static double GetStandardDeviation(const JitterStatistics_t& statistics);
+
+protected: // Members
+
+	U32 mSampleRate;
+	U32 mConfiguredThreshold;
+	bool mFirstTimestamp;
+	S64 mLastSample;
+	U32 mLastNetworkTime;
+	JitterSummary_t mSummary;
+	std::deque<JitterInterval_t> mPending;
+	std::deque<JitterInterval_t> mReady;
+
+protected: // Methods
+
+	void EstimateNominalCycle();
+	void AnalyzeInterval(JitterInterval_t& interval);
+	static void AddDeviation(JitterStatistics_t& statistics, S64 deviation);
+	static U32 GetBin(S64 deviation);
+};
+
+#endif /* ABCC_JITTER_ANALYZER_H */
@@ -0,0 +1,181 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccLatencyStatistics.cpp
+**    Summary: Streaming command-to-response latency statistics, grouped by
+**             the object and command of the transaction.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "AbccLatencyStatistics.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+#define MICROSECONDS_PER_SECOND		1000000.0
+
+void AbccLatencyStatistics::Add(U8 obj, U8 cmd, double latency, bool error_response)
+{
+	U16 key = GetKey(obj, cmd);
+	auto it = mStatistics.find(key);
+
+	if (it == mStatistics.end())
+	{
+		LatencyStatistics_t statistics;
+
+		memset(&statistics, 0, sizeof(statistics));
+		statistics.rMin = latency;
+		statistics.rMax = latency;
+		it = mStatistics.insert(std::make_pair(key, statistics)).first;
+	}
+
+	LatencyStatistics_t* statistics = &it->second;
+
+	statistics->lCount++;
+	statistics->rSum += latency;
+	statistics->alHistogram[GetBin(latency)]++;
+	statistics->alPercentileHistogram[GetPercentileBin(latency)]++;
+
+	if (latency < statistics->rMin)
+	{
+		statistics->rMin = latency;
+	}
+
+	if (latency > statistics->rMax)
+	{
+		statistics->rMax = latency;
+	}
+
+	if (error_response)
+	{
+		statistics->lErrorResponses++;
+	}
+}
+
+void AbccLatencyStatistics::Clear()
+{
+	mStatistics.clear();
+}
+
+const std::map<U16, LatencyStatistics_t>& AbccLatencyStatistics::GetStatistics() const
+{
+	return mStatistics;
+}
+
+U16 AbccLatencyStatistics::GetKey(U8 obj, U8 cmd)
+{
+	return (U16)(((U16)obj << 8) | (cmd & ABP_MSG_HEADER_CMD_BITS));
+}
+
+U8 AbccLatencyStatistics::GetObject(U16 key)
+{
+	return (U8)(key >> 8);
+}
+
+U8 AbccLatencyStatistics::GetCommand(U16 key)
+{
+	return (U8)key;
+}
+
+U32 AbccLatencyStatistics::GetBin(double latency)
+{
+	double microseconds = latency * MICROSECONDS_PER_SECOND;
+	int exponent;
+
+	if (!(microseconds >= 1.0))
+	{
+		return 0;
+	}
+
+	// microseconds = mantissa * 2^exponent, with the mantissa in [0.5, 1)
+	frexp(microseconds, &exponent);
+
+	if (exponent >= LATENCY_HISTOGRAM_BINS)
+	{
+		return LATENCY_HISTOGRAM_BINS - 1;
+	}
+
+	return (U32)exponent;
+}
+
+double AbccLatencyStatistics::GetBinLowerBound(U32 bin)
+{
+	if (bin == 0)
+	{
+		return 0.0;
+	}
+
+	return ldexp(1.0, (int)bin - 1);
+}
+
+U32 AbccLatencyStatistics::GetPercentileBin(double latency)
+{
+	double microseconds = latency * MICROSECONDS_PER_SECOND;
+	U32 bin = GetBin(latency);
+	double width = (bin == 0) ? 1.0 : GetBinLowerBound(bin);
+	double subBin = floor(((microseconds - GetBinLowerBound(bin)) / width) * LATENCY_HISTOGRAM_SUB_BINS);
+
+	// The last bin is open ended, its last sub-bin also holds everything
+	// beyond the first octave of the bin
+	if (!(subBin > 0.0))
+	{
+		subBin = 0.0;
+	}
+	else if (subBin > (double)(LATENCY_HISTOGRAM_SUB_BINS - 1))
+	{
+		subBin = (double)(LATENCY_HISTOGRAM_SUB_BINS - 1);
+	}
+
+	return bin * LATENCY_HISTOGRAM_SUB_BINS + (U32)subBin;
+}
+
+double AbccLatencyStatistics::GetPercentileBinLowerBound(U32 percentile_bin)
+{
+	U32 bin = percentile_bin / LATENCY_HISTOGRAM_SUB_BINS;
+	U32 subBin = percentile_bin % LATENCY_HISTOGRAM_SUB_BINS;
+	double width = (bin == 0) ? 1.0 : GetBinLowerBound(bin);
+
+	return GetBinLowerBound(bin) + (width * subBin) / LATENCY_HISTOGRAM_SUB_BINS;
+}
+
+double AbccLatencyStatistics::GetPercentile(const LatencyStatistics_t& statistics, double fraction)
+{
+	double rank = ceil(fraction * (double)statistics.lCount);
+	U64 preceding = 0;
+
+	if (rank < 1.0)
+	{
+		rank = 1.0;
+	}
+
+	for (U32 bin = 0; bin < LATENCY_PERCENTILE_BINS; bin++)
+	{
+		U64 count = statistics.alPercentileHistogram[bin];
+
+		if ((double)(preceding + count) >= rank)
+		{
+			double lower = GetPercentileBinLowerBound(bin) / MICROSECONDS_PER_SECOND;
+			double upper = statistics.rMax;
+
+			if (bin < (LATENCY_PERCENTILE_BINS - 1))
+			{
+				upper = GetPercentileBinLowerBound(bin + 1) / MICROSECONDS_PER_SECOND;
+			}
+
+			// Only the part of the bin within the observed range holds samples
+			lower = (lower < statistics.rMin) ? statistics.rMin : lower;
+			upper = (upper > statistics.rMax) ? statistics.rMax : upper;
+
+			return lower + (upper - lower) * ((rank - (double)preceding) / (double)count);
+		}
+
+		preceding += count;
+	}
+
+	return statistics.rMax;
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccLatencyStatistics.h
+**    Summary: Streaming command-to-response latency statistics, grouped by
+**             the object and command of the transaction.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_LATENCY_STATISTICS_H
+#define ABCC_LATENCY_STATISTICS_H
+
+#include <map>
+
+#include "LogicPublicTypes.h"
+
+/* Number of histogram bins. The first bin holds latencies below 1 us, bin n
+** holds [2^(n-1), 2^n) us, and the last bin everything from 2^(BINS-2) us */
+#define LATENCY_HISTOGRAM_BINS				24
+
+/* Each histogram bin is split into this many linear sub-bins, from which the
+** percentiles are estimated. A percentile is off by at most 1/16 of the
+** lower bound of its bin, about 6%, except in the open ended last bin */
+#define LATENCY_HISTOGRAM_SUB_BINS			16
+#define LATENCY_PERCENTILE_BINS				( LATENCY_HISTOGRAM_BINS * LATENCY_HISTOGRAM_SUB_BINS )
+
+/* The statistics of one object and command */
+typedef struct LatencyStatistics
+{
+	U64 lCount;
+	U64 lErrorResponses;
+	double rMin;			// Seconds
+	double rMax;			// Seconds
+	double rSum;			// Seconds
+	U64 alHistogram[LATENCY_HISTOGRAM_BINS];
+	U64 alPercentileHistogram[LATENCY_PERCENTILE_BINS];	// The sub-bins of alHistogram
+} LatencyStatistics_t;
+
+/*
+** @brief Accumulates latencies in a single pass. Each (object, command) key
+**        holds a fixed size record, so the memory does not grow with the
+**        number of transactions. Percentiles are estimated from the linear
+**        sub-bins of the logarithmic histogram, interpolating linearly within
+**        a sub-bin. The histogram bins themselves are only for display.
+*/
+class AbccLatencyStatistics
+{
+public:
+
+	/*******************************************************************************
+	** @brief Add the latency of a transaction.
+	**
+	** @param obj - The object addressed by the command.
+	** @param cmd - The command, the C and E bits are ignored.
+	** @param latency - Seconds from the start of the command to the end of the response.
+	** @param error_response - The response is an error response.
+	*/
+	void Add(U8 obj, U8 cmd, double latency, bool error_response);
+
+	/*******************************************************************************
+	** @brief Discard all statistics.
+	*/
+	void Clear();
+
+	/*******************************************************************************
+	** @brief The statistics, keyed by GetKey(obj, cmd) in ascending order.
+	*/
+	const std::map<U16, LatencyStatistics_t>& GetStatistics() const;
+
+	static U16 GetKey(U8 obj, U8 cmd);
+	static U8 GetObject(U16 key);
+	static U8 GetCommand(U16 key);
+
+	/*******************************************************************************
+	** @brief Estimate a percentile from the histogram.
+	**
+	** @param statistics - The statistics of a key.
+	** @param fraction - The percentile as a fraction, e.g. 0.99.
+	**
+	** @return The estimated latency in seconds, within [rMin, rMax].
+	*/
+	static double GetPercentile(const LatencyStatistics_t& statistics, double fraction);
+
+	/*******************************************************************************
+	** @brief The lower bound of a histogram bin in microseconds.
+	*/
+	static double GetBinLowerBound(U32 bin);
+
+protected: // Members
+
+	std::map<U16, LatencyStatistics_t> mStatistics;
+
+protected: // Methods
+
+	static U32 GetBin(double latency);
+	static U32 GetPercentileBin(double latency);
+	static double GetPercentileBinLowerBound(U32 percentile_bin);
+};
+
+#endif /* ABCC_LATENCY_STATISTICS_H */
@@ -0,0 +1,121 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccMessageHeaderIndex.cpp
+**    Summary: Keeps the header fields of each message header, located by the
+**             last frame of the header.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "AbccMessageHeaderIndex.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+AbccMessageHeaderIndex::AbccMessageHeaderIndex()
+{
+	ResetPending();
+}
+
+void AbccMessageHeaderIndex::AddFrame(const AbccFrame_t& frame, U64 frame_index)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	bool mosi = ((frame.bFlags & SPI_MOSI_FLAG) != 0);
+	MsgHeaderFields_t* pending = &masPending[mosi ? SpiChannel::MOSI : SpiChannel::MISO];
+
+	if ((frame.bFlags & SPI_ERROR_FLAG) != 0)
+	{
+		return;
+	}
+
+	if ((mosi && (frame.bType == AbccMosiStates::SpiControl)) ||
+		(!mosi && (frame.bType == AbccMisoStates::SpiStatus)))
+	{
+		// ABP_SPI_CTRL_M and ABP_SPI_STATUS_M indicate a message in the packet
+		if ((frame.lData1 & (mosi ? ABP_SPI_CTRL_M : ABP_SPI_STATUS_M)) != 0)
+		{
+			pending->bFlags |= MSG_HEADER_VALID_FLAG;
+		}
+		else
+		{
+			pending->bFlags &= ~MSG_HEADER_VALID_FLAG;
+		}
+
+		return;
+	}
+
+	// NOTE: The MessageField values of AbccMosiStates and AbccMisoStates are aligned
+	switch (frame.bType)
+	{
+		case AbccMisoStates::MessageField_Size:
+			pending->wSize = (U16)frame.lData1;
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				pending->bFlags |= MSG_HEADER_SIZE_ERROR_FLAG;
+			}
+			else
+			{
+				pending->bFlags &= ~MSG_HEADER_SIZE_ERROR_FLAG;
+			}
+
+			break;
+
+		case AbccMisoStates::MessageField_SourceId:
+			pending->bSourceId = (U8)frame.lData1;
+			break;
+
+		case AbccMisoStates::MessageField_CommandExtension:
+			pending->lFrameIndex = frame_index;
+			masHeaders[mosi ? SpiChannel::MOSI : SpiChannel::MISO].push_back(*pending);
+			break;
+
+		default:
+			break;
+	}
+}
+
+void AbccMessageHeaderIndex::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		masHeaders[i].clear();
+	}
+
+	ResetPending();
+}
+
+bool AbccMessageHeaderIndex::Find(SpiChannel_t channel, U64 frame_index, MsgHeaderFields_t* fields) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (channel >= NUM_DATA_CHANNELS)
+	{
+		return false;
+	}
+
+	const std::vector<MsgHeaderFields_t>& headers = masHeaders[channel];
+	auto it = std::lower_bound(headers.begin(), headers.end(), frame_index,
+		[](const MsgHeaderFields_t& header, U64 frame) { return header.lFrameIndex < frame; });
+
+	if ((it == headers.end()) || (it->lFrameIndex != frame_index))
+	{
+		return false;
+	}
+
+	*fields = *it;
+
+	return true;
+}
+
+void AbccMessageHeaderIndex::ResetPending()
+{
+	memset(masPending, 0, sizeof(masPending));
+}
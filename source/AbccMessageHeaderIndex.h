@@ -0,0 +1,88 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccMessageHeaderIndex.h
+**    Summary: Keeps the header fields of each message header, located by the
+**             last frame of the header.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_MESSAGE_HEADER_INDEX_H
+#define ABCC_MESSAGE_HEADER_INDEX_H
+
+#include <mutex>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AbccDecoder.h"
+#include "AbccSpiAnalyzerTypes.h"
+
+/* The M bit of the channel's SPI_CTRL/SPI_STS was set, the header is valid */
+#define MSG_HEADER_VALID_FLAG				( 1 << 0 )
+
+/* The size field exceeded the maximum message data size */
+#define MSG_HEADER_SIZE_ERROR_FLAG			( 1 << 1 )
+
+/* The fields of a header not held by its command extension frame */
+typedef struct MsgHeaderFields
+{
+	U64 lFrameIndex;			// The command extension frame
+	U16 wSize;
+	U8 bSourceId;
+	U8 bFlags;
+} MsgHeaderFields_t;
+
+/*
+** @brief Records the fields of the message headers as their frames are
+**        decoded, so that the text of a header is generated from its
+**        command extension frame alone.
+**
+** The object, instance and command are kept by the command extension frame
+** itself; the size, source ID, and whether the packet carried a message are
+** kept here. Headers are recorded in frame order, whether or not the packet
+** is accepted, following the frames of the results.
+*/
+class AbccMessageHeaderIndex
+{
+public:
+
+	AbccMessageHeaderIndex();
+
+	/*******************************************************************************
+	** @brief Add a decoded frame.
+	**
+	** @param frame - The frame, as passed to AbccDecoderSink::OnFrame().
+	** @param frame_index - The index of the frame in the results.
+	*/
+	void AddFrame(const AbccFrame_t& frame, U64 frame_index);
+
+	/*******************************************************************************
+	** @brief Discard all headers.
+	*/
+	void Clear();
+
+	/*******************************************************************************
+	** @brief Find the header ending with a command extension frame.
+	**
+	** @param channel - The channel of the frame.
+	** @param frame_index - The index of the command extension frame.
+	** @param fields - Receives the fields of the header.
+	**
+	** @return false if no header ends with the frame.
+	*/
+	bool Find(SpiChannel_t channel, U64 frame_index, MsgHeaderFields_t* fields) const;
+
+protected: // Members
+
+	mutable std::mutex mMutex;
+	std::vector<MsgHeaderFields_t> masHeaders[NUM_DATA_CHANNELS];	// Ordered by frame
+	MsgHeaderFields_t masPending[NUM_DATA_CHANNELS];
+
+protected: // Methods
+
+	void ResetPending();
+};
+
+#endif /* ABCC_MESSAGE_HEADER_INDEX_H */
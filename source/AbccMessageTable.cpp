@@ -0,0 +1,405 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccMessageTable.cpp
+**    Summary: Reassembles the complete ABP messages from the decoded frames
+**             and keeps them in a table indexed by message number.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "AbccMessageTable.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+AbccMessageTable::AbccMessageTable()
+	: mFirstMessageIndex(0),
+	mFrameData(nullptr),
+	mPreviousPacketDiscarded(false)
+{
+	memset(masAssembly, 0, sizeof(masAssembly));
+	ResetPacket();
+}
+
+void AbccMessageTable::SetFrameData(const AbccByteArena* frame_data)
+{
+	mFrameData = frame_data;
+}
+
+void AbccMessageTable::AddFrame(const AbccFrame_t& frame, U64 frame_index)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	SpiChannel_t channel = ((frame.bFlags & SPI_MOSI_FLAG) != 0) ? SpiChannel::MOSI : SpiChannel::MISO;
+	PacketMessageInfo_t* packetInfo = &masPacketInfo[channel];
+
+	if (frame.bType == AbccSpiError::Fragmentation)
+	{
+		mPacketError = true;
+		return;
+	}
+
+	if (channel == SpiChannel::MOSI)
+	{
+		if (frame.bType == AbccMosiStates::SpiControl)
+		{
+			packetInfo->fMessage = ((frame.lData1 & ABP_SPI_CTRL_M) != 0);
+			packetInfo->fLastFragment = ((frame.lData1 & ABP_SPI_CTRL_LAST_FRAG) != 0);
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				mPacketRetransmit = true;
+			}
+
+			return;
+		}
+		else if (frame.bType == AbccMosiStates::Crc32)
+		{
+			mPacketError |= ((frame.bFlags & DISPLAY_AS_ERROR_FLAG) != 0);
+			return;
+		}
+	}
+	else
+	{
+		if (frame.bType == AbccMisoStates::SpiStatus)
+		{
+			packetInfo->fMessage = ((frame.lData1 & ABP_SPI_STATUS_M) != 0);
+			packetInfo->fLastFragment = ((frame.lData1 & ABP_SPI_STATUS_LAST_FRAG) != 0);
+			return;
+		}
+		else if (frame.bType == AbccMisoStates::Crc32)
+		{
+			mPacketError |= ((frame.bFlags & DISPLAY_AS_ERROR_FLAG) != 0);
+			return;
+		}
+	}
+
+	// NOTE: AbccMosiStates and AbccMisoStates are assumed to have aligned
+	// values for AbccMosiStates::MessageField* and AbccMisoStates::MessageField*.
+	// This means only one of the enums will be used for the cases defined below.
+
+	switch (frame.bType)
+	{
+	case AbccMisoStates::MessageField_Size:
+		StartMessage(channel, frame, frame_index);
+		break;
+
+	case AbccMisoStates::MessageField_SourceId:
+	case AbccMisoStates::MessageField_Object:
+	case AbccMisoStates::MessageField_Instance:
+	case AbccMisoStates::MessageField_Command:
+	case AbccMisoStates::MessageField_CommandExtension:
+	case AbccMisoStates::MessageField_Data:
+		AddMessageField(channel, frame, frame_index);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void AbccMessageTable::StartMessage(SpiChannel_t channel, const AbccFrame_t& frame, U64 frame_index)
+{
+	MessageAssembly_t* assembly = &masAssembly[channel];
+
+	// A message that did not complete is discarded
+	memset(&assembly->sMessage, 0, sizeof(assembly->sMessage));
+	mabPacketData[channel].clear();
+
+	if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+	{
+		// The message size exceeds the maximum, the decoder drops the message
+		assembly->fActive = false;
+		assembly->fStartedInPacket = false;
+		return;
+	}
+
+	assembly->fActive = true;
+	assembly->fStartedInPacket = true;
+	assembly->sMessage.wDataSize = (U16)frame.lData1;
+	assembly->sMessage.lFirstSample = frame.lStartingSampleInclusive;
+	assembly->sMessage.lLastSample = frame.lEndingSampleInclusive;
+	assembly->sMessage.lFirstFrameIndex = frame_index;
+	assembly->sMessage.lLastFrameIndex = frame_index;
+
+	if (channel == SpiChannel::MOSI)
+	{
+		assembly->sMessage.bFlags |= ABCC_MESSAGE_MOSI_FLAG;
+	}
+}
+
+void AbccMessageTable::AddMessageField(SpiChannel_t channel, const AbccFrame_t& frame, U64 frame_index)
+{
+	MessageAssembly_t* assembly = &masAssembly[channel];
+	AbccMessage_t* message = &assembly->sMessage;
+
+	if (!assembly->fActive || !masPacketInfo[channel].fMessage)
+	{
+		// The start of the message is not part of the capture
+		return;
+	}
+
+	switch (frame.bType)
+	{
+	case AbccMisoStates::MessageField_SourceId:
+		message->bSourceId = (U8)frame.lData1;
+		break;
+	case AbccMisoStates::MessageField_Object:
+		message->sHeader.obj = (U8)frame.lData1;
+		break;
+	case AbccMisoStates::MessageField_Instance:
+		message->sHeader.inst = (U16)frame.lData1;
+		break;
+	case AbccMisoStates::MessageField_Command:
+		message->sHeader.cmd = (U8)frame.lData1;
+		break;
+	case AbccMisoStates::MessageField_CommandExtension:
+		message->sHeader.cmdExt = (U16)frame.lData1;
+		break;
+	case AbccMisoStates::MessageField_Data:
+		AddMessageData(channel, frame);
+		break;
+	default:
+		break;
+	}
+
+	message->lLastSample = frame.lEndingSampleInclusive;
+	message->lLastFrameIndex = frame_index;
+}
+
+void AbccMessageTable::AddMessageData(SpiChannel_t channel, const AbccFrame_t& frame)
+{
+	std::vector<U8>* data = &mabPacketData[channel];
+
+	if ((frame.bFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+	{
+		U32 length = GET_AGGREGATED_FRAME_LENGTH(frame.lData1);
+		size_t size = data->size();
+
+		if (mFrameData == nullptr)
+		{
+			return;
+		}
+
+		data->resize(size + length);
+		length = mFrameData->Read(GET_AGGREGATED_FRAME_OFFSET(frame.lData1), &(*data)[size], length);
+		data->resize(size + length);
+		masAssembly[channel].sMessage.dwDataLength += length;
+	}
+	else
+	{
+		data->push_back((U8)frame.lData1);
+		masAssembly[channel].sMessage.dwDataLength++;
+	}
+}
+
+void AbccMessageTable::EndPacket(U64 packet_id, bool cancelled)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	bool discard = (cancelled || mPacketError);
+
+	// A retransmission following an accepted packet repeats its fields
+	bool duplicate = (!discard && mPacketRetransmit && !mPreviousPacketDiscarded);
+
+	if (discard || duplicate)
+	{
+		memcpy(masAssembly, masCommittedAssembly, sizeof(masAssembly));
+	}
+	else
+	{
+		CommitPacket(SpiChannel::MOSI, packet_id);
+		CommitPacket(SpiChannel::MISO, packet_id);
+	}
+
+	mPreviousPacketDiscarded = discard;
+	ResetPacket();
+}
+
+void AbccMessageTable::CommitPacket(SpiChannel_t channel, U64 packet_id)
+{
+	MessageAssembly_t* assembly = &masAssembly[channel];
+	AbccMessage_t* message = &assembly->sMessage;
+	const PacketMessageInfo_t* packetInfo = &masPacketInfo[channel];
+	std::vector<U8>* data = &mabAssemblyData[channel];
+
+	if (!assembly->fActive)
+	{
+		return;
+	}
+
+	if (assembly->fStartedInPacket)
+	{
+		message->lFirstPacketId = packet_id;
+		data->assign(mabPacketData[channel].begin(), mabPacketData[channel].end());
+	}
+	else
+	{
+		data->insert(data->end(), mabPacketData[channel].begin(), mabPacketData[channel].end());
+	}
+
+	message->lLastPacketId = packet_id;
+
+	if (!packetInfo->fMessage)
+	{
+		// The next fragment follows in a later packet
+		return;
+	}
+
+	if (!packetInfo->fLastFragment)
+	{
+		message->bFlags |= ABCC_MESSAGE_FRAGMENTED_FLAG;
+		return;
+	}
+
+	if (message->dwDataLength < message->wDataSize)
+	{
+		message->bFlags |= ABCC_MESSAGE_TRUNCATED_FLAG;
+	}
+
+	message->lDataOffset = mMessageData.Append(data->data(), (U32)data->size());
+
+	// The messages of both channels complete at the end of the same packet,
+	// keep the table ordered by the last frame of the messages
+	if (!mMessages.empty() && (mMessages.back().lLastFrameIndex > message->lLastFrameIndex))
+	{
+		mMessages.insert(mMessages.end() - 1, *message);
+	}
+	else
+	{
+		mMessages.push_back(*message);
+	}
+
+	assembly->fActive = false;
+	data->clear();
+}
+
+void AbccMessageTable::ResetPacket()
+{
+	mPacketError = false;
+	mPacketRetransmit = false;
+
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		masAssembly[i].fStartedInPacket = false;
+		masPacketInfo[i].fMessage = false;
+		masPacketInfo[i].fLastFragment = false;
+		mabPacketData[i].clear();
+	}
+
+	memcpy(masCommittedAssembly, masAssembly, sizeof(masCommittedAssembly));
+}
+
+void AbccMessageTable::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mMessages.clear();
+	mFirstMessageIndex = 0;
+	mMessageData.Clear();
+
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		mabAssemblyData[i].clear();
+	}
+
+	memset(masAssembly, 0, sizeof(masAssembly));
+	mPreviousPacketDiscarded = false;
+	ResetPacket();
+}
+
+void AbccMessageTable::DiscardMessages(U64 message_index)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (message_index <= mFirstMessageIndex)
+	{
+		return;
+	}
+
+	if ((message_index - mFirstMessageIndex) >= mMessages.size())
+	{
+		mFirstMessageIndex += mMessages.size();
+		mMessages.clear();
+
+		// The data of a message is only appended once it completed
+		mMessageData.Clear();
+	}
+	else
+	{
+		mMessages.erase(mMessages.begin(), mMessages.begin() + (size_t)(message_index - mFirstMessageIndex));
+		mFirstMessageIndex = message_index;
+	}
+}
+
+U64 AbccMessageTable::GetMessageCount() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	return mFirstMessageIndex + mMessages.size();
+}
+
+U64 AbccMessageTable::GetFirstMessageIndex() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	return mFirstMessageIndex;
+}
+
+bool AbccMessageTable::GetMessage(U64 message_index, AbccMessage_t* message) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if ((message_index < mFirstMessageIndex) || ((message_index - mFirstMessageIndex) >= mMessages.size()))
+	{
+		return false;
+	}
+
+	*message = mMessages[(size_t)(message_index - mFirstMessageIndex)];
+
+	return true;
+}
+
+U32 AbccMessageTable::ReadMessageData(const AbccMessage_t& message, U32 offset, U8* data, U32 length) const
+{
+	if (offset >= message.dwDataLength)
+	{
+		return 0;
+	}
+
+	if (length > (message.dwDataLength - offset))
+	{
+		length = message.dwDataLength - offset;
+	}
+
+	return mMessageData.Read(message.lDataOffset + offset, data, length);
+}
+
+U64 AbccMessageTable::FindMessage(SpiChannel_t channel, U64 frame_index) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	U8 channelFlag = (channel == SpiChannel::MOSI) ? ABCC_MESSAGE_MOSI_FLAG : 0;
+
+	auto it = std::lower_bound(mMessages.begin(), mMessages.end(), frame_index,
+		[](const AbccMessage_t& message, U64 index) { return message.lLastFrameIndex < index; });
+
+	// The messages of a channel do not overlap, the first one of the channel
+	// ending at or after the frame is the only candidate
+	for (; it != mMessages.end(); ++it)
+	{
+		if ((it->bFlags & ABCC_MESSAGE_MOSI_FLAG) == channelFlag)
+		{
+			if (it->lFirstFrameIndex <= frame_index)
+			{
+				return mFirstMessageIndex + (U64)(it - mMessages.begin());
+			}
+
+			break;
+		}
+	}
+
+	return INVALID_MESSAGE_INDEX;
+}
@@ -0,0 +1,199 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccMessageTable.h
+**    Summary: Reassembles the complete ABP messages from the decoded frames
+**             and keeps them in a table indexed by message number.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_MESSAGE_TABLE_H
+#define ABCC_MESSAGE_TABLE_H
+
+#include <mutex>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AbccByteArena.h"
+#include "AbccDecoder.h"
+#include "AbccSpiAnalyzerTypes.h"
+
+/* The message was sent on MOSI (from the host to the ABCC) */
+#define ABCC_MESSAGE_MOSI_FLAG				( 1 << 0 )
+
+/* The message was transferred in more than one fragment */
+#define ABCC_MESSAGE_FRAGMENTED_FLAG		( 1 << 1 )
+
+/* The message ended with less data than its size field specified */
+#define ABCC_MESSAGE_TRUNCATED_FLAG			( 1 << 2 )
+
+/* The index returned when no message matches */
+#define INVALID_MESSAGE_INDEX				0xFFFFFFFFFFFFFFFFull
+
+/* A complete message, its data is kept in the table's byte arena */
+typedef struct AbccMessage
+{
+	MsgHeaderInfo_t sHeader;
+	U8 bSourceId;
+	U8 bFlags;
+	U16 wDataSize;			// From the message size field
+	U32 dwDataLength;		// Bytes received, less than wDataSize if truncated
+	U64 lDataOffset;
+	S64 lFirstSample;
+	S64 lLastSample;
+	U64 lFirstPacketId;
+	U64 lLastPacketId;
+	U64 lFirstFrameIndex;
+	U64 lLastFrameIndex;
+} AbccMessage_t;
+
+/*
+** @brief Builds the complete messages of a capture as its frames are decoded.
+**
+** The frames are passed in capture order, followed by the end of the packet
+** containing them. The message fields of a packet are only taken over once
+** the packet ended without errors, following the decoder: a packet with a
+** CRC or fragmentation error is retransmitted, while a retransmission of a
+** packet that was accepted repeats fragments already taken over.
+**
+** The data of the message being reassembled on each channel is collected in
+** a buffer that is reused from one message to the next. Once complete, the
+** message data is appended to a byte arena, so the table does not allocate
+** memory per message.
+*/
+class AbccMessageTable
+{
+public:
+
+	AbccMessageTable();
+
+	/*******************************************************************************
+	** @brief Set the arena holding the bytes of aggregated frames.
+	**
+	** @param frame_data - The arena, the bytes are read while the frame is added.
+	*/
+	void SetFrameData(const AbccByteArena* frame_data);
+
+	/*******************************************************************************
+	** @brief Add a decoded frame.
+	**
+	** @param frame - The frame, as passed to AbccDecoderSink::OnFrame().
+	** @param frame_index - The index of the frame in the results.
+	*/
+	void AddFrame(const AbccFrame_t& frame, U64 frame_index);
+
+	/*******************************************************************************
+	** @brief End the packet containing the frames added since the last call.
+	**
+	** @param packet_id - The ID of the packet.
+	** @param cancelled - The packet was aborted, its message fields are discarded.
+	*/
+	void EndPacket(U64 packet_id, bool cancelled);
+
+	/*******************************************************************************
+	** @brief Discard all messages and any message being reassembled.
+	*/
+	void Clear();
+
+	/*******************************************************************************
+	** @brief Discard the messages before an index, when they are only needed
+	**        until exported. The remaining messages keep their index, and the
+	**        message data is freed once no message remains.
+	**
+	** @param message_index - Index of the first message to keep.
+	*/
+	void DiscardMessages(U64 message_index);
+
+	/*******************************************************************************
+	** @brief The number of complete messages, including the discarded ones.
+	*/
+	U64 GetMessageCount() const;
+
+	/*******************************************************************************
+	** @brief The index of the first message that was not discarded.
+	*/
+	U64 GetFirstMessageIndex() const;
+
+	/*******************************************************************************
+	** @brief Get a complete message. The messages are ordered by their last frame.
+	**
+	** @param message_index - Index of the message, less than GetMessageCount().
+	** @param message - Receives the message.
+	**
+	** @return false if the index is out of range.
+	*/
+	bool GetMessage(U64 message_index, AbccMessage_t* message) const;
+
+	/*******************************************************************************
+	** @brief Read (part of) the data of a message.
+	**
+	** @param message - The message.
+	** @param offset - Offset of the first byte within the message data.
+	** @param data - Receives the bytes.
+	** @param length - The number of bytes to read.
+	**
+	** @return The number of bytes read, less than length if reading past the end.
+	*/
+	U32 ReadMessageData(const AbccMessage_t& message, U32 offset, U8* data, U32 length) const;
+
+	/*******************************************************************************
+	** @brief Find the message a frame is part of.
+	**
+	** @param channel - The channel of the frame.
+	** @param frame_index - The index of the frame in the results.
+	**
+	** @return The index of the message, INVALID_MESSAGE_INDEX if the frame is
+	**         not part of a complete message.
+	*/
+	U64 FindMessage(SpiChannel_t channel, U64 frame_index) const;
+
+protected: // Types
+
+	/* The message being reassembled on a channel */
+	typedef struct MessageAssembly
+	{
+		AbccMessage_t sMessage;
+		bool fActive;
+		bool fStartedInPacket;
+	} MessageAssembly_t;
+
+	/* What a channel's packet indicated about the message field */
+	typedef struct PacketMessageInfo
+	{
+		bool fMessage;
+		bool fLastFragment;
+	} PacketMessageInfo_t;
+
+protected: // Members
+
+	mutable std::mutex mMutex;
+	std::vector<AbccMessage_t> mMessages;
+	U64 mFirstMessageIndex;		// Of mMessages[0]
+	AbccByteArena mMessageData;
+	const AbccByteArena* mFrameData;
+
+	// Indexed by SpiChannel_t. The message data of the current packet is kept
+	// apart, and the state at the start of the packet is kept, to discard the
+	// fields of a packet that is not accepted.
+	MessageAssembly_t masAssembly[NUM_DATA_CHANNELS];
+	MessageAssembly_t masCommittedAssembly[NUM_DATA_CHANNELS];
+	PacketMessageInfo_t masPacketInfo[NUM_DATA_CHANNELS];
+	std::vector<U8> mabAssemblyData[NUM_DATA_CHANNELS];
+	std::vector<U8> mabPacketData[NUM_DATA_CHANNELS];
+
+	bool mPacketError;
+	bool mPacketRetransmit;
+	bool mPreviousPacketDiscarded;
+
+protected: // Methods
+
+	void StartMessage(SpiChannel_t channel, const AbccFrame_t& frame, U64 frame_index);
+	void AddMessageField(SpiChannel_t channel, const AbccFrame_t& frame, U64 frame_index);
+	void AddMessageData(SpiChannel_t channel, const AbccFrame_t& frame);
+	void CommitPacket(SpiChannel_t channel, U64 packet_id);
+	void ResetPacket();
+};
+
+#endif /* ABCC_MESSAGE_TABLE_H */
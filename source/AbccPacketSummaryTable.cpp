@@ -0,0 +1,297 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccPacketSummaryTable.cpp
+**    Summary: Summarizes the states, message headers and events of the
+**             packets as their frames are decoded.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "AbccPacketSummaryTable.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+AbccPacketSummaryTable::AbccPacketSummaryTable()
+{
+	ResetPending();
+}
+
+void AbccPacketSummaryTable::AddFrame(const AbccFrame_t& frame, U64 frame_index)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (mPendingEmpty)
+	{
+		msPending.lFirstFrame = frame_index;
+		mPendingEmpty = false;
+	}
+
+	if ((frame.bFlags & SPI_ERROR_FLAG) != 0)
+	{
+		switch (frame.bType)
+		{
+			case AbccSpiError::Fragmentation:
+				msPending.wFlags |= PACKET_SUMMARY_FRAGMENTATION_ERROR;
+				break;
+			case AbccSpiError::EndOfTransfer:
+				msPending.wFlags |= PACKET_SUMMARY_CLOCKING_ERROR;
+				break;
+			case AbccSpiError::Generic:
+			default:
+				msPending.wFlags |= PACKET_SUMMARY_GENERIC_ERROR;
+				break;
+		}
+	}
+	else if ((frame.bFlags & SPI_MOSI_FLAG) != 0)
+	{
+		AddMosiFrame(frame);
+	}
+	else
+	{
+		AddMisoFrame(frame);
+	}
+}
+
+void AbccPacketSummaryTable::EndPacket(U64 packet_id, bool cancelled)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (!cancelled && (packet_id != INVALID_RESULT_INDEX))
+	{
+		if (mPendingEmpty)
+		{
+			// Nothing to summarize, the entry only keeps the frame order
+			msPending.lFirstFrame = masPackets.empty() ? 0 : masPackets.back().lFirstFrame;
+			msPending.fPresent = false;
+		}
+
+		if (packet_id >= masPackets.size())
+		{
+			PacketSummary_t missing;
+
+			// Kept in frame order for FindPacketStartingAt()
+			memset(&missing, 0, sizeof(missing));
+			missing.lFirstFrame = msPending.lFirstFrame;
+			missing.fPresent = false;
+			masPackets.resize((size_t)packet_id + 1, missing);
+		}
+
+		masPackets[(size_t)packet_id] = msPending;
+	}
+
+	ResetPending();
+}
+
+void AbccPacketSummaryTable::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	masPackets.clear();
+	ResetPending();
+}
+
+bool AbccPacketSummaryTable::GetSummary(U64 packet_id, PacketSummary_t* summary) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if ((packet_id >= masPackets.size()) || !masPackets[(size_t)packet_id].fPresent)
+	{
+		return false;
+	}
+
+	*summary = masPackets[(size_t)packet_id];
+
+	return true;
+}
+
+bool AbccPacketSummaryTable::FindPacketStartingAt(U64 frame_index, U64* packet_id) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	auto it = std::lower_bound(masPackets.begin(), masPackets.end(), frame_index,
+		[](const PacketSummary_t& packet, U64 frame) { return packet.lFirstFrame < frame; });
+
+	// Skip the IDs without a summary that share the first frame
+	while ((it != masPackets.end()) && (it->lFirstFrame == frame_index))
+	{
+		if (it->fPresent)
+		{
+			*packet_id = (U64)(it - masPackets.begin());
+			return true;
+		}
+
+		++it;
+	}
+
+	return false;
+}
+
+void AbccPacketSummaryTable::AddMisoFrame(const AbccFrame_t& frame)
+{
+	PacketMsgSummary_t* msg = &msPending.asMsg[SpiChannel::MISO];
+
+	switch (frame.bType)
+	{
+		case AbccMisoStates::AnybusStatus:
+			msPending.bAnbStatus = (U8)frame.lData1;
+			msPending.wFlags |= PACKET_SUMMARY_ANB_STATUS;
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msPending.wFlags |= PACKET_SUMMARY_ANB_STATUS_CHANGE;
+			}
+
+			break;
+
+		case AbccMisoStates::SpiStatus:
+			if ((frame.lData1 & ABP_SPI_STATUS_M) != 0)
+			{
+				msg->bFlags |= PACKET_MSG_VALID;
+
+				if ((frame.lData1 & ABP_SPI_STATUS_LAST_FRAG) != 0)
+				{
+					msg->bFlags |= PACKET_MSG_LAST_FRAG;
+				}
+			}
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msPending.wFlags |= PACKET_SUMMARY_WRMSG_FULL;
+			}
+
+			if ((frame.bFlags & SPI_MSG_FRAG_FLAG) != 0)
+			{
+				msg->bFlags |= ((frame.bFlags & SPI_MSG_FIRST_FRAG_FLAG) != 0) ? PACKET_MSG_FIRST_FRAG : PACKET_MSG_FRAG;
+			}
+
+			break;
+
+		case AbccMisoStates::NetworkTime:
+		{
+			const NetworkTimeInfo_t* info = reinterpret_cast<const NetworkTimeInfo_t*>(&frame.lData2);
+
+			msPending.dwNetworkTime = (U32)frame.lData1;
+			msPending.wFlags |= PACKET_SUMMARY_NETWORK_TIME;
+
+			if (info->wrPdValid)
+			{
+				msPending.wFlags |= PACKET_SUMMARY_WR_PD_VALID;
+			}
+
+			if (info->newRdPd)
+			{
+				msPending.wFlags |= PACKET_SUMMARY_NEW_RD_PD;
+			}
+
+			break;
+		}
+
+		case AbccMisoStates::Crc32:
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msg->bFlags |= PACKET_MSG_CRC_ERROR;
+			}
+
+			break;
+
+		default:
+			AddMessageFrame(msg, frame);
+			break;
+	}
+}
+
+void AbccPacketSummaryTable::AddMosiFrame(const AbccFrame_t& frame)
+{
+	PacketMsgSummary_t* msg = &msPending.asMsg[SpiChannel::MOSI];
+
+	switch (frame.bType)
+	{
+		case AbccMosiStates::ApplicationStatus:
+			msPending.bApplStatus = (U8)frame.lData1;
+			msPending.wFlags |= PACKET_SUMMARY_APPL_STATUS;
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msPending.wFlags |= PACKET_SUMMARY_APPL_STATUS_CHANGE;
+			}
+
+			break;
+
+		case AbccMosiStates::SpiControl:
+			if ((frame.lData1 & ABP_SPI_CTRL_M) != 0)
+			{
+				msg->bFlags |= PACKET_MSG_VALID;
+
+				if ((frame.lData1 & ABP_SPI_CTRL_LAST_FRAG) != 0)
+				{
+					msg->bFlags |= PACKET_MSG_LAST_FRAG;
+				}
+			}
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msPending.wFlags |= PACKET_SUMMARY_RETRANSMIT;
+			}
+			else if ((frame.bFlags & SPI_MSG_FRAG_FLAG) != 0)
+			{
+				msg->bFlags |= ((frame.bFlags & SPI_MSG_FIRST_FRAG_FLAG) != 0) ? PACKET_MSG_FIRST_FRAG : PACKET_MSG_FRAG;
+			}
+
+			break;
+
+		case AbccMosiStates::Crc32:
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msg->bFlags |= PACKET_MSG_CRC_ERROR;
+			}
+
+			break;
+
+		default:
+			AddMessageFrame(msg, frame);
+			break;
+	}
+}
+
+void AbccPacketSummaryTable::AddMessageFrame(PacketMsgSummary_t* msg, const AbccFrame_t& frame)
+{
+	// NOTE: The MessageField values of AbccMosiStates and AbccMisoStates are aligned
+	switch (frame.bType)
+	{
+		case AbccMisoStates::MessageField_Size:
+			msg->wSize = (U16)frame.lData1;
+
+			if ((frame.bFlags & SPI_PROTO_EVENT_FLAG) != 0)
+			{
+				msg->bFlags |= PACKET_MSG_SIZE_ERROR;
+			}
+
+			break;
+
+		case AbccMisoStates::MessageField_SourceId:
+			msg->bSourceId = (U8)frame.lData1;
+			break;
+
+		case AbccMisoStates::MessageField_CommandExtension:
+			// The frame carries the object, instance and command of the header
+			memcpy(&msg->sHeader, &frame.lData2, sizeof(msg->sHeader));
+			msg->sHeader.cmdExt = (U16)frame.lData1;
+			msg->bFlags |= PACKET_MSG_HEADER;
+			break;
+
+		default:
+			break;
+	}
+}
+
+void AbccPacketSummaryTable::ResetPending()
+{
+	memset(&msPending, 0, sizeof(msPending));
+	msPending.fPresent = true;
+	mPendingEmpty = true;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccPacketSummaryTable.h
+**    Summary: Summarizes the states, message headers and events of the
+**             packets as their frames are decoded.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_PACKET_SUMMARY_TABLE_H
+#define ABCC_PACKET_SUMMARY_TABLE_H
+
+#include <mutex>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AnalyzerResults.h"
+#include "AbccDecoder.h"
+#include "AbccSpiAnalyzerTypes.h"
+
+/* Packet events and contents, PacketSummary_t::wFlags */
+#define PACKET_SUMMARY_ANB_STATUS				( 1 << 0 )
+#define PACKET_SUMMARY_ANB_STATUS_CHANGE		( 1 << 1 )
+#define PACKET_SUMMARY_APPL_STATUS				( 1 << 2 )
+#define PACKET_SUMMARY_APPL_STATUS_CHANGE		( 1 << 3 )
+#define PACKET_SUMMARY_NETWORK_TIME				( 1 << 4 )
+#define PACKET_SUMMARY_WR_PD_VALID				( 1 << 5 )
+#define PACKET_SUMMARY_NEW_RD_PD				( 1 << 6 )
+#define PACKET_SUMMARY_RETRANSMIT				( 1 << 7 )
+#define PACKET_SUMMARY_WRMSG_FULL				( 1 << 8 )
+#define PACKET_SUMMARY_FRAGMENTATION_ERROR		( 1 << 9 )
+#define PACKET_SUMMARY_CLOCKING_ERROR			( 1 << 10 )
+#define PACKET_SUMMARY_GENERIC_ERROR			( 1 << 11 )
+
+/* Message of a channel, PacketMsgSummary_t::bFlags */
+#define PACKET_MSG_VALID						( 1 << 0 )	// The M bit of SPI_CTRL/SPI_STS is set
+#define PACKET_MSG_HEADER						( 1 << 1 )	// The header fields were decoded
+#define PACKET_MSG_FIRST_FRAG					( 1 << 2 )	// First fragment of a message
+#define PACKET_MSG_FRAG							( 1 << 3 )	// A following fragment of a message
+#define PACKET_MSG_LAST_FRAG					( 1 << 4 )
+#define PACKET_MSG_SIZE_ERROR					( 1 << 5 )
+#define PACKET_MSG_CRC_ERROR					( 1 << 6 )	// CRC32 error of the channel
+
+typedef struct PacketMsgSummary
+{
+	MsgHeaderInfo_t sHeader;
+	U16 wSize;
+	U8 bSourceId;
+	U8 bFlags;
+} PacketMsgSummary_t;
+
+typedef struct PacketSummary
+{
+	U64 lFirstFrame;
+	U32 dwNetworkTime;
+	U16 wFlags;
+	U8 bAnbStatus;
+	U8 bApplStatus;
+	PacketMsgSummary_t asMsg[NUM_DATA_CHANNELS];
+	bool fPresent;				// Cleared for packet IDs without a summary
+} PacketSummary_t;
+
+/*
+** @brief Keeps one summary per packet, built from the frames of the packet as
+**        they are decoded, so that the text of a packet is generated without
+**        reading its frames.
+*/
+class AbccPacketSummaryTable
+{
+public:
+
+	AbccPacketSummaryTable();
+
+	/*******************************************************************************
+	** @brief Add a decoded frame.
+	**
+	** @param frame - The frame, as passed to AbccDecoderSink::OnFrame().
+	** @param frame_index - The index of the frame in the results.
+	*/
+	void AddFrame(const AbccFrame_t& frame, U64 frame_index);
+
+	/*******************************************************************************
+	** @brief End the packet containing the frames added since the last call.
+	**
+	** @param packet_id - The ID of the packet, INVALID_RESULT_INDEX if none.
+	** @param cancelled - The packet was aborted, its summary is discarded.
+	*/
+	void EndPacket(U64 packet_id, bool cancelled);
+
+	/*******************************************************************************
+	** @brief Discard all packets.
+	*/
+	void Clear();
+
+	/*******************************************************************************
+	** @brief Copy the summary of a packet.
+	**
+	** @return false if the packet has no summary.
+	*/
+	bool GetSummary(U64 packet_id, PacketSummary_t* summary) const;
+
+	/*******************************************************************************
+	** @brief Find the packet starting with a frame.
+	**
+	** @param frame_index - The index of the frame.
+	** @param packet_id - Receives the ID of the packet.
+	**
+	** @return false if the frame is not the first frame of a packet.
+	*/
+	bool FindPacketStartingAt(U64 frame_index, U64* packet_id) const;
+
+protected: // Members
+
+	mutable std::mutex mMutex;
+	std::vector<PacketSummary_t> masPackets;	// Indexed by the packet ID
+	PacketSummary_t msPending;
+	bool mPendingEmpty;
+
+protected: // Methods
+
+	void AddMisoFrame(const AbccFrame_t& frame);
+	void AddMosiFrame(const AbccFrame_t& frame);
+	void AddMessageFrame(PacketMsgSummary_t* msg, const AbccFrame_t& frame);
+	void ResetPending();
+};
+
+#endif /* ABCC_PACKET_SUMMARY_TABLE_H */
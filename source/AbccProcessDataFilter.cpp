@@ -0,0 +1,263 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccProcessDataFilter.cpp
+**    Summary: Passes on only the process data that changed since the last
+**             image of each channel, with a full image at regular intervals.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include "AbccProcessDataFilter.h"
+
+AbccProcessDataFilter::AbccProcessDataFilter()
+	: mSink(nullptr),
+	mChangesOnly(false),
+	mKeyframeInterval(0)
+{
+	Reset();
+}
+
+void AbccProcessDataFilter::SetSink(AbccDecoderSink* sink)
+{
+	mSink = sink;
+}
+
+void AbccProcessDataFilter::Configure(bool changes_only, U32 keyframe_interval)
+{
+	mChangesOnly = changes_only;
+	mKeyframeInterval = keyframe_interval;
+	Reset();
+}
+
+void AbccProcessDataFilter::Reset()
+{
+	ClearPacket();
+
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		masImages[i].abData.clear();
+		masImages[i].dwImageCount = 0;
+		masImages[i].fValid = false;
+	}
+}
+
+void AbccProcessDataFilter::Flush()
+{
+	for (const AbccFrame_t& frame : mPacketFrames)
+	{
+		ForwardFrame(frame);
+	}
+
+	// The image of the packet is incomplete
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		masImages[i].fValid = false;
+	}
+
+	ClearPacket();
+}
+
+void AbccProcessDataFilter::OnFrame(const AbccFrame_t& frame)
+{
+	if (!mChangesOnly)
+	{
+		mSink->OnFrame(frame);
+		return;
+	}
+
+	mPacketFrames.push_back(frame);
+}
+
+U64 AbccProcessDataFilter::OnFrameData(const U8* data, U32 length)
+{
+	U64 offset = mPacketFrameData.size();
+
+	if (!mChangesOnly)
+	{
+		return mSink->OnFrameData(data, length);
+	}
+
+	// Passed on to the sink along with the frame
+	mPacketFrameData.insert(mPacketFrameData.end(), data, data + length);
+
+	return offset;
+}
+
+void AbccProcessDataFilter::OnPacketEnd(PacketType mosi_packet_type, PacketType miso_packet_type)
+{
+	bool filter[NUM_DATA_CHANNELS];
+	U32 imageSize[NUM_DATA_CHANNELS] = { 0, 0 };
+	SpiChannel_t channel;
+
+	if (!mChangesOnly)
+	{
+		mSink->OnPacketEnd(mosi_packet_type, miso_packet_type);
+		return;
+	}
+
+	filter[SpiChannel::MOSI] = IsTrustedPacketType(mosi_packet_type) && (mosi_packet_type != PacketType::Cancel);
+	filter[SpiChannel::MISO] = IsTrustedPacketType(miso_packet_type) && (mosi_packet_type != PacketType::Cancel);
+
+	for (const AbccFrame_t& frame : mPacketFrames)
+	{
+		if ((frame.bFlags & SPI_ERROR_FLAG) != 0)
+		{
+			// E.g. a fragmented packet, which may not be reflected by the packet type
+			filter[((frame.bFlags & SPI_MOSI_FLAG) != 0) ? SpiChannel::MOSI : SpiChannel::MISO] = false;
+		}
+		else if (IsProcessDataFrame(frame, &channel))
+		{
+			U32 frameEnd = (U32)frame.lData2 + GetFrameLength(frame);
+
+			if (frameEnd > imageSize[channel])
+			{
+				imageSize[channel] = frameEnd;
+			}
+		}
+	}
+
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		ProcessDataImage_t* image = &masImages[i];
+
+		if (imageSize[i] == 0)
+		{
+			// No process data on the channel
+			continue;
+		}
+
+		if (!filter[i])
+		{
+			// The image is passed on as is, the next one in full
+			image->fValid = false;
+			continue;
+		}
+
+		if (!image->fValid ||
+			(image->abData.size() != imageSize[i]) ||
+			((mKeyframeInterval != 0) && (image->dwImageCount >= mKeyframeInterval)))
+		{
+			// A full image, which also replaces the shadow copy
+			image->abData.assign(imageSize[i], 0);
+			image->dwImageCount = 0;
+			image->fValid = true;
+			filter[i] = false;
+		}
+
+		image->dwImageCount++;
+	}
+
+	for (const AbccFrame_t& frame : mPacketFrames)
+	{
+		if (IsProcessDataFrame(frame, &channel) && masImages[channel].fValid)
+		{
+			if (!UpdateImage(&masImages[channel], frame) && filter[channel])
+			{
+				// Unchanged since the last image
+				continue;
+			}
+		}
+
+		ForwardFrame(frame);
+	}
+
+	ClearPacket();
+	mSink->OnPacketEnd(mosi_packet_type, miso_packet_type);
+}
+
+bool AbccProcessDataFilter::IsProcessDataFrame(const AbccFrame_t& frame, SpiChannel_t* channel)
+{
+	if ((frame.bFlags & SPI_ERROR_FLAG) != 0)
+	{
+		return false;
+	}
+
+	if ((frame.bFlags & SPI_MOSI_FLAG) != 0)
+	{
+		*channel = SpiChannel::MOSI;
+		return (frame.bType == AbccMosiStates::WriteProcessData);
+	}
+
+	*channel = SpiChannel::MISO;
+	return (frame.bType == AbccMisoStates::ReadProcessData);
+}
+
+bool AbccProcessDataFilter::IsTrustedPacketType(PacketType packet_type)
+{
+	// Error responses do not affect the process data
+	switch (packet_type)
+	{
+	case PacketType::ProtocolError:
+	case PacketType::ChecksumError:
+	case PacketType::MultiEventWithError:
+	case PacketType::Cancel:
+		return false;
+	default:
+		return true;
+	}
+}
+
+U32 AbccProcessDataFilter::GetFrameLength(const AbccFrame_t& frame)
+{
+	if ((frame.bFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+	{
+		return GET_AGGREGATED_FRAME_LENGTH(frame.lData1);
+	}
+
+	return 1;
+}
+
+bool AbccProcessDataFilter::UpdateImage(ProcessDataImage_t* image, const AbccFrame_t& frame)
+{
+	U32 offset = (U32)frame.lData2;
+	U32 length = GetFrameLength(frame);
+	bool changed = false;
+
+	for (U32 i = 0; i < length; i++)
+	{
+		U8 data;
+
+		if ((frame.bFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+		{
+			data = mPacketFrameData[(size_t)GET_AGGREGATED_FRAME_OFFSET(frame.lData1) + i];
+		}
+		else
+		{
+			data = (U8)frame.lData1;
+		}
+
+		if (image->abData[offset + i] != data)
+		{
+			image->abData[offset + i] = data;
+			changed = true;
+		}
+	}
+
+	return changed;
+}
+
+void AbccProcessDataFilter::ForwardFrame(const AbccFrame_t& frame)
+{
+	if ((frame.bFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+	{
+		AbccFrame_t sinkFrame = frame;
+		U32 length = GET_AGGREGATED_FRAME_LENGTH(frame.lData1);
+		const U8* data = &mPacketFrameData[(size_t)GET_AGGREGATED_FRAME_OFFSET(frame.lData1)];
+
+		// Refer to the bytes as stored by the sink
+		sinkFrame.lData1 = AGGREGATED_FRAME_DATA1(mSink->OnFrameData(data, length), length);
+		mSink->OnFrame(sinkFrame);
+	}
+	else
+	{
+		mSink->OnFrame(frame);
+	}
+}
+
+void AbccProcessDataFilter::ClearPacket()
+{
+	mPacketFrames.clear();
+	mPacketFrameData.clear();
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccProcessDataFilter.h
+**    Summary: Passes on only the process data that changed since the last
+**             image of each channel, with a full image at regular intervals.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_PROCESS_DATA_FILTER_H
+#define ABCC_PROCESS_DATA_FILTER_H
+
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AbccDecoder.h"
+#include "AbccSpiAnalyzerTypes.h"
+
+/* The last process data image passed on for a channel */
+typedef struct ProcessDataImage
+{
+	std::vector<U8> abData;
+	U32 dwImageCount;			// Images since the last full image
+	bool fValid;				// Cleared when the image may be incomplete or corrupt
+} ProcessDataImage_t;
+
+/*
+** @brief A sink between the AbccDecoder and the sink storing the frames. The
+**        frames of a packet are held until the packet ends; the process data
+**        frames are then compared against a shadow copy of the channel's
+**        last image and only the changed ones are passed on.
+**
+** Per byte frames are dropped when the byte is unchanged, aggregated frames
+** when none of their bytes changed. The first image, an image of a new size,
+** and every keyframe interval'th image are passed on in full, so that the
+** image can be rebuilt from the frames of the nearest full image onward.
+** Images of packets with protocol or checksum errors are passed on in full
+** and the following image is a full image again.
+**
+** The filter follows the packets in capture order, so it is placed after the
+** parallel decoder merged the chunks.
+*/
+class AbccProcessDataFilter : public AbccDecoderSink
+{
+public:
+
+	AbccProcessDataFilter();
+
+	/*******************************************************************************
+	** @brief Set the sink which receives the filtered frames and packets.
+	*/
+	void SetSink(AbccDecoderSink* sink);
+
+	/*******************************************************************************
+	** @brief Enable or disable the filter, all frames pass when disabled.
+	**
+	** @param changes_only - Pass on only changed process data.
+	** @param keyframe_interval - Pass on every n'th image of a channel in full,
+	**                            0 for the first image only.
+	*/
+	void Configure(bool changes_only, U32 keyframe_interval);
+
+	/*******************************************************************************
+	** @brief Discard the held frames and the shadow images.
+	*/
+	void Reset();
+
+	/*******************************************************************************
+	** @brief Pass on the frames held for a packet that did not end, e.g. at the
+	**        end of the capture.
+	*/
+	void Flush();
+
+	virtual void OnFrame(const AbccFrame_t& frame);
+	virtual U64 OnFrameData(const U8* data, U32 length);
+	virtual void OnPacketEnd(PacketType mosi_packet_type, PacketType miso_packet_type);
+
+protected: // Members
+
+	AbccDecoderSink* mSink;
+	bool mChangesOnly;
+	U32 mKeyframeInterval;
+
+	// Frames of the current packet and the bytes of its aggregated frames
+	std::vector<AbccFrame_t> mPacketFrames;
+	std::vector<U8> mPacketFrameData;
+
+	ProcessDataImage_t masImages[NUM_DATA_CHANNELS];
+
+protected: // Methods
+
+	bool IsProcessDataFrame(const AbccFrame_t& frame, SpiChannel_t* channel);
+	bool IsTrustedPacketType(PacketType packet_type);
+	U32 GetFrameLength(const AbccFrame_t& frame);
+	bool UpdateImage(ProcessDataImage_t* image, const AbccFrame_t& frame);
+	void ForwardFrame(const AbccFrame_t& frame);
+	void ClearPacket();
+};
+
+#endif /* ABCC_PROCESS_DATA_FILTER_H */
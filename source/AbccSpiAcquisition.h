@@ -0,0 +1,739 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccSpiAcquisition.h
+**    Summary: Acquires SPI transfers from the MOSI, MISO, CLOCK, and ENABLE
+**             signals. The acquisition is a template on the channel data type
+**             so that both the Logic plugin and the offline decoder share it.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_SPI_ACQUISITION_H
+#define ABCC_SPI_ACQUISITION_H
+
+#include "LogicPublicTypes.h"
+#include "AbccSpiAnalyzerTypes.h"
+#include "AbccDecoder.h"
+
+enum class GetByteStatus : U32
+{
+	OK,		// BYTE was successfully read
+	Error,	// Reading BYTE resulted in a logical error (requires statemachine reset)
+	Reset,	// Reading BYTE resulted in a event that requires state machine reset
+	Skip,	// Enable line was toggle with no data clocked. It is an empty packet and can be skipped.
+	SizeOfEnum
+};
+
+// Markers the acquisition can place on the signals
+enum class AcquisitionMarker : U32
+{
+	Zero,	// Sampled data bit is LOW
+	One,	// Sampled data bit is HIGH
+	Sample,	// Clock edge at which the data bits were sampled
+	Error,	// Clocking error
+	SizeOfEnum
+};
+
+enum class AcquisitionChannel : U32
+{
+	Mosi,
+	Miso,
+	Clock,
+	Enable,
+	SizeOfEnum
+};
+
+typedef struct SpiAcquisitionConfig
+{
+	bool f3WireMode;			// No enable line is used to frame the transactions
+	bool fPure4WireMode;		// The enable line is used to frame the transactions
+	bool f4WireOn3Channels;		// 4-wire protocol, but the enable line is not captured
+	bool fWordMode;				// Acquire 16-bit transfers instead of bytes
+	bool fBitMarkers;			// Report per-bit data and sample markers
+	bool fExpandBitFrames;		// Expand narrow clocking error frames
+	S32 iClockingAlertLimit;	// Maximum clocking errors to report, negative for unlimited
+	U64 lPacketGapSamples;		// 3-wire idle gap between packets
+	U64 lMaxClockIdleSamples;	// 3-wire maximum clock idle time within a packet
+} SpiAcquisitionConfig_t;
+
+/*
+** @brief Receives the frames and markers generated by the SpiAcquisition.
+*/
+class AbccAcquisitionSink
+{
+public:
+
+	virtual ~AbccAcquisitionSink() {}
+
+	/*******************************************************************************
+	** @brief Called for each clocking error frame.
+	**
+	** @param frame - The error frame.
+	*/
+	virtual void OnFrame(const AbccFrame_t& frame) = 0;
+
+	/*******************************************************************************
+	** @brief Called for each marker to place on one of the signals.
+	**
+	** @param sample - The sample number of the marker.
+	** @param marker - The type of marker.
+	** @param channel - The signal the marker is placed on.
+	*/
+	virtual void OnMarker(U64 sample, AcquisitionMarker marker, AcquisitionChannel channel) = 0;
+};
+
+/*
+** @brief Acquires SPI transfers in the forward-only manner of the Logic SDK.
+**
+** TChannelData must provide the subset of the AnalyzerChannelData interface
+** used below: GetSampleNumber(), GetBitState(), AdvanceToNextEdge(),
+** AdvanceToAbsPosition(), GetSampleOfNextEdge(),
+** WouldAdvancingToAbsPositionCauseTransition(), and
+** DoMoreTransitionsExistInCurrentData().
+*/
+template <class TChannelData>
+class SpiAcquisition
+{
+public:
+
+	SpiAcquisition();
+
+	/*******************************************************************************
+	** @brief Set the sink which receives the error frames and markers.
+	*/
+	void SetSink(AbccAcquisitionSink* sink);
+
+	/*******************************************************************************
+	** @brief Configure the acquisition for a new run.
+	**
+	** @param config - The acquisition options.
+	** @param mosi, miso, clock, enable - The channel data of the signals, enable
+	**                                    is nullptr if not captured.
+	*/
+	void Setup(const SpiAcquisitionConfig_t& config, TChannelData* mosi, TChannelData* miso, TChannelData* clock, TChannelData* enable);
+
+	/*******************************************************************************
+	** @brief Read one SPI transfer (8 or 16 bits) from the capture.
+	**
+	** @param transfer - Receives the data, sample positions, and chip select
+	**                   events of the transfer.
+	**
+	** @return Skip if no data was clocked, otherwise the status of the transfer.
+	*/
+	GetByteStatus GetTransfer(AbccTransfer_t* transfer);
+
+	/*******************************************************************************
+	** @brief Advance to the start of the next transaction.
+	*/
+	void AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+
+	/*******************************************************************************
+	** @brief Check for clocks after a packet until the enable line goes inactive,
+	**        then advance to the start of the next transaction.
+	*/
+	void CheckForIdleAfterPacket();
+
+	/*******************************************************************************
+	** @brief The sample of the last acquired bit.
+	*/
+	U64 GetCurrentSample() const
+	{
+		return mCurrentSample;
+	}
+
+protected: // Members
+
+	AbccAcquisitionSink* mSink;
+	SpiAcquisitionConfig_t mConfig;
+
+	TChannelData* mMosi;
+	TChannelData* mMiso;
+	TChannelData* mClock;
+	TChannelData* mEnable;
+
+	U64 mCurrentSample;
+	S32 mClockingErrorCount;
+	bool mIdleCheckPending;
+
+protected: // Methods
+
+	inline void ProcessSamples(TChannelData* chn_data, const U64* sample_points, U32 sample_count, U32 bits_per_transfer, U64* data_ptr, AcquisitionChannel chn);
+
+	void AdvanceToActiveEnableEdge();
+
+	bool IsEnableActive();
+	bool IsInitialClockPolarityCorrect();
+
+	bool WouldAdvancingTheClockToggleEnable();
+	bool WouldAdvancingTheClockToggleEnable(U64 enable_edge, bool enable_edge_valid);
+
+	bool Is3WireIdleCondition(U64 idle_samples);
+};
+
+template <class TChannelData>
+SpiAcquisition<TChannelData>::SpiAcquisition()
+	: mSink(nullptr),
+	mConfig(),
+	mMosi(nullptr),
+	mMiso(nullptr),
+	mClock(nullptr),
+	mEnable(nullptr),
+	mCurrentSample(0),
+	mClockingErrorCount(0),
+	mIdleCheckPending(false)
+{
+}
+
+template <class TChannelData>
+void SpiAcquisition<TChannelData>::SetSink(AbccAcquisitionSink* sink)
+{
+	mSink = sink;
+}
+
+template <class TChannelData>
+void SpiAcquisition<TChannelData>::Setup(const SpiAcquisitionConfig_t& config, TChannelData* mosi, TChannelData* miso, TChannelData* clock, TChannelData* enable)
+{
+	mConfig = config;
+	mMosi = mosi;
+	mMiso = miso;
+	mClock = clock;
+	mEnable = enable;
+	mCurrentSample = 0;
+	mClockingErrorCount = 0;
+	mIdleCheckPending = false;
+}
+
+template <class TChannelData>
+inline void SpiAcquisition<TChannelData>::ProcessSamples(TChannelData* chn_data, const U64* sample_points, U32 sample_count, U32 bits_per_transfer, U64* data_ptr, AcquisitionChannel chn)
+{
+	U64 data = 0;
+	BitState bitState;
+
+	*data_ptr = 0;
+
+	if ((chn_data == nullptr) || (sample_count == 0))
+	{
+		return;
+	}
+
+	// The state is only queried once; afterwards it is tracked from the
+	// number of transitions crossed while sweeping forward to each sample.
+	chn_data->AdvanceToAbsPosition(sample_points[0]);
+	bitState = chn_data->GetBitState();
+
+	for (U32 sampleIndex = 0; sampleIndex < sample_count; sampleIndex++)
+	{
+		if ((sampleIndex > 0) &&
+			((chn_data->AdvanceToAbsPosition(sample_points[sampleIndex]) & 1) != 0))
+		{
+			bitState = (bitState == BitState::BIT_HIGH) ? BitState::BIT_LOW : BitState::BIT_HIGH;
+		}
+
+		// Data is shifted in MSB first
+		data = (data << 1) | ((bitState == BitState::BIT_HIGH) ? 1 : 0);
+
+		if (mConfig.fBitMarkers)
+		{
+			mSink->OnMarker(sample_points[sampleIndex], (bitState == BitState::BIT_HIGH) ? AcquisitionMarker::One : AcquisitionMarker::Zero, chn);
+		}
+	}
+
+	// A partial transfer is left aligned, as if the missing bits were zero
+	*data_ptr = data << (bits_per_transfer - sample_count);
+}
+
+template <class TChannelData>
+void SpiAcquisition<TChannelData>::AdvanceToActiveEnableEdgeWithCorrectClockPolarity()
+{
+	// NOTE: 3-wire requires correct clock polarity (IDLE HI),
+	// in 4-wire mode, the polarity does not matter.
+
+	AdvanceToActiveEnableEdge();
+
+	if (mConfig.f3WireMode)
+	{
+		// With no enable line an idle gap of at least >=10us is required
+		for (;;)
+		{
+			// First find idle gap
+			while (!Is3WireIdleCondition(mConfig.lPacketGapSamples))
+			{
+				mClock->AdvanceToNextEdge();
+			}
+
+			// If false, this function moves to the next enable-active edge.
+			if (IsInitialClockPolarityCorrect())
+			{
+				break;
+			}
+			else
+			{
+				mClock->AdvanceToNextEdge();
+			}
+		}
+
+		mCurrentSample = mClock->GetSampleNumber();
+	}
+}
+
+template <class TChannelData>
+void SpiAcquisition<TChannelData>::AdvanceToActiveEnableEdge()
+{
+	if (mConfig.fPure4WireMode)
+	{
+		if (mEnable->GetBitState() == BitState::BIT_HIGH)
+		{
+			mEnable->AdvanceToNextEdge();
+		}
+		else
+		{
+			mEnable->AdvanceToNextEdge();
+			mEnable->AdvanceToNextEdge();
+		}
+
+		mClock->AdvanceToAbsPosition(mEnable->GetSampleNumber());
+	}
+
+	mCurrentSample = mClock->GetSampleNumber();
+}
+
+template <class TChannelData>
+bool SpiAcquisition<TChannelData>::IsInitialClockPolarityCorrect()
+{
+	bool correctPolarity = true;
+
+	if (mConfig.f3WireMode)
+	{
+		// In 3-wire, clock must idle HIGH
+		if (mClock->GetBitState() == BitState::BIT_LOW)
+		{
+			mSink->OnMarker(mCurrentSample, AcquisitionMarker::Error, AcquisitionChannel::Clock);
+			correctPolarity = false;
+		}
+	}
+
+	return correctPolarity;
+}
+
+template <class TChannelData>
+bool SpiAcquisition<TChannelData>::WouldAdvancingTheClockToggleEnable(U64 enable_edge, bool enable_edge_valid)
+{
+	if (enable_edge_valid && mClock->DoMoreTransitionsExistInCurrentData())
+	{
+		// The clock toggles enable if its next edge is not before the enable edge
+		return (enable_edge == 0) ||
+			!mClock->WouldAdvancingToAbsPositionCauseTransition(enable_edge - 1);
+	}
+
+	return WouldAdvancingTheClockToggleEnable();
+}
+
+template <class TChannelData>
+bool SpiAcquisition<TChannelData>::WouldAdvancingTheClockToggleEnable()
+{
+	if (mConfig.f3WireMode)
+	{
+		return false;
+	}
+
+	if (mEnable != nullptr)
+	{
+		if (mClock->DoMoreTransitionsExistInCurrentData())
+		{
+			U64 nextEdge = mClock->GetSampleOfNextEdge();
+
+			return mEnable->WouldAdvancingToAbsPositionCauseTransition(nextEdge);
+		}
+		else
+		{
+			return mEnable->DoMoreTransitionsExistInCurrentData();
+		}
+	}
+	else
+	{
+		return false;
+	}
+}
+
+template <class TChannelData>
+bool SpiAcquisition<TChannelData>::Is3WireIdleCondition(U64 idle_samples)
+{
+	if (mConfig.f4WireOn3Channels)
+	{
+		return false;
+	}
+
+	U64 sampleDistance = mClock->GetSampleOfNextEdge() - mClock->GetSampleNumber();
+	return (sampleDistance >= idle_samples);
+}
+
+template <class TChannelData>
+bool SpiAcquisition<TChannelData>::IsEnableActive()
+{
+	if (mConfig.fPure4WireMode)
+	{
+		return (mEnable->GetBitState() == BitState::BIT_LOW);
+	}
+	else
+	{
+		return true;
+	}
+}
+
+template <class TChannelData>
+GetByteStatus SpiAcquisition<TChannelData>::GetTransfer(AbccTransfer_t* transfer)
+{
+	// Clock is assumed to be in the idle state when entering this function
+	const U32 bytesPerTransfer = mConfig.fWordMode ? MAX_BYTES_PER_TRANSFER : 1;
+	const U32 bitsPerTransfer = bytesPerTransfer * BITS_PER_BYTE;
+	U64 samplePoints[MAX_BYTES_PER_TRANSFER * BITS_PER_BYTE];
+	U32 sampleCount = 0;
+	U64 enableEdge = 0;
+	bool enableEdgeValid = false;
+	GetByteStatus byteStatus = GetByteStatus::OK;
+	bool clkIdleHigh = false;
+
+	if (mIdleCheckPending)
+	{
+		mIdleCheckPending = false;
+
+		if (Is3WireIdleCondition(mConfig.lMaxClockIdleSamples))
+		{
+			// The idle condition after the previous transfer, signaled without data
+			transfer->lMosiData = 0;
+			transfer->lMisoData = 0;
+			transfer->dwByteCount = 0;
+			transfer->eStatus = AcquisitionStatus::OK;
+			transfer->bCsEvents = ABCC_CS_IDLE_TIMEOUT_EVENT;
+			transfer->lCsEventSample = mClock->GetSampleOfNextEdge();
+			return GetByteStatus::OK;
+		}
+	}
+
+	transfer->dwByteCount = 1;
+	transfer->alFirstSamples[0] = mClock->GetSampleNumber();
+
+	// Resolve the enable line's next edge once per byte; each clock edge is then
+	// checked against this position instead of querying the enable channel.
+	if (!mConfig.f3WireMode && (mEnable != nullptr))
+	{
+		if (mEnable->DoMoreTransitionsExistInCurrentData())
+		{
+			enableEdge = mEnable->GetSampleOfNextEdge();
+			enableEdgeValid = true;
+		}
+	}
+
+	for (U32 bitIndex = 0; bitIndex < bitsPerTransfer; bitIndex++)
+	{
+		// On every logic transition, check that "enable" doesn't change state.
+		// Note: Advancing the enable line to the next edge is not appropriate here since there may not be another edge
+
+		if (WouldAdvancingTheClockToggleEnable(enableEdge, enableEdgeValid))
+		{
+			if (bitIndex == 0)
+			{
+				// Advance forward to next transaction
+				AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+				byteStatus = GetByteStatus::Skip;
+			}
+			else
+			{
+				// The enable state changed in the middle of acquiring a byte;
+				// this suggests we are not byte-synchronized.
+				byteStatus = GetByteStatus::Reset;
+			}
+
+			break;
+		}
+
+		if (bitIndex == 0)
+		{
+			// Determine the clock polarity to be used for the acquisition of this byte
+			clkIdleHigh = (mClock->GetBitState() == BitState::BIT_HIGH);
+		}
+
+		// For CLOCK IDLE LOW configurations, skip advancing the clock when sampling the first bit.
+		if (mConfig.f3WireMode)
+		{
+			// In 3-wire mode, idle condition is >=5us (during a transaction).
+			// On every advancement on clock, check for idle condition.
+			// If detected, a reset of the statemachines are need to re-sync
+			// If an idle condition is detected in the middle of receiving a
+			// byte an error status is signaled otherwise the routine can
+			// advance in the capture silently.
+			if (Is3WireIdleCondition(mConfig.lMaxClockIdleSamples))
+			{
+				if (bitIndex == 0)
+				{
+					AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+				}
+				else
+				{
+					byteStatus = GetByteStatus::Error;
+					break;
+				}
+			}
+		}
+
+		// Jump to the next clock phase
+		mClock->AdvanceToNextEdge();
+
+		if (!clkIdleHigh)
+		{
+			// Sample on leading edge
+			samplePoints[sampleCount++] = mClock->GetSampleNumber();
+		}
+
+		if (mConfig.f3WireMode)
+		{
+			// In 3-wire mode idle condition is >=5us (during a transaction).
+			// On every advancement on clock, check for idle condition.
+			// If detected, a reset of the statemachines are need to re-sync
+			if (Is3WireIdleCondition(mConfig.lMaxClockIdleSamples))
+			{
+				// Error: reset everything and return.
+				byteStatus = GetByteStatus::Error;
+				break;
+			}
+		}
+		else if (WouldAdvancingTheClockToggleEnable(enableEdge, enableEdgeValid))
+		{
+			// There are two potential error cases to check for here.
+			// If in clock idle high mode, and processing the first bit, just
+			// skip the acquisition, these are treated as glitches or aborted
+			// SPI packet transmissions and will be filtered.
+			// The second case is if the processing any bit other than
+			// the last bit in the byte. This indicates some communication
+			// interruption or logical error.
+			if (clkIdleHigh && (bitIndex == 0))
+			{
+				AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+				byteStatus = GetByteStatus::Skip;
+				break;
+			}
+			else if (bitIndex < (bitsPerTransfer - 1))
+			{
+				byteStatus = GetByteStatus::Error;
+				break;
+			}
+		}
+
+		// Jump to the next clock phase
+		mClock->AdvanceToNextEdge();
+
+		if (clkIdleHigh)
+		{
+			// Sample on tailing edge
+			samplePoints[sampleCount++] = mClock->GetSampleNumber();
+		}
+
+		if ((bitIndex % BITS_PER_BYTE) == (BITS_PER_BYTE - 1))
+		{
+			// Latch the last clock edge of each byte in the transfer
+			transfer->alLastSamples[bitIndex / BITS_PER_BYTE] = mClock->GetSampleNumber();
+		}
+	}
+
+	if (sampleCount > 0)
+	{
+		// Latch the first sample point in the byte
+		transfer->alFirstSamples[0] = samplePoints[0];
+		mCurrentSample = samplePoints[sampleCount - 1];
+	}
+
+	if ((byteStatus == GetByteStatus::OK) && (bytesPerTransfer > 1))
+	{
+		for (U32 byteIndex = 1; byteIndex < bytesPerTransfer; byteIndex++)
+		{
+			transfer->alFirstSamples[byteIndex] = samplePoints[byteIndex * BITS_PER_BYTE];
+		}
+
+		transfer->dwByteCount = bytesPerTransfer;
+	}
+	else
+	{
+		// A single byte, or a partial transfer signaling an error, ends at the current clock position
+		transfer->alLastSamples[0] = mClock->GetSampleNumber();
+	}
+
+	// Resolve the data bits of both channels in a single forward sweep
+	ProcessSamples(mMosi, samplePoints, sampleCount, bitsPerTransfer, &transfer->lMosiData, AcquisitionChannel::Mosi);
+	ProcessSamples(mMiso, samplePoints, sampleCount, bitsPerTransfer, &transfer->lMisoData, AcquisitionChannel::Miso);
+
+	if (bytesPerTransfer > 1)
+	{
+		// Words are shifted out MSB first; swap so that the first byte
+		// on the wire is in the least significant byte as in 8-bit mode.
+		transfer->lMosiData = ((transfer->lMosiData >> BITS_PER_BYTE) & 0xFF) | ((transfer->lMosiData & 0xFF) << BITS_PER_BYTE);
+		transfer->lMisoData = ((transfer->lMisoData >> BITS_PER_BYTE) & 0xFF) | ((transfer->lMisoData & 0xFF) << BITS_PER_BYTE);
+	}
+
+	if ((byteStatus == GetByteStatus::OK) && mConfig.fBitMarkers)
+	{
+		// Add sample markers to the results
+		for (U32 bitIndex = 0; bitIndex < sampleCount; bitIndex++)
+		{
+			mSink->OnMarker(samplePoints[bitIndex], AcquisitionMarker::Sample, AcquisitionChannel::Clock);
+		}
+	}
+
+	if (byteStatus == GetByteStatus::Skip)
+	{
+		return byteStatus;
+	}
+
+	switch (byteStatus)
+	{
+	case GetByteStatus::OK:
+		transfer->eStatus = AcquisitionStatus::OK;
+		break;
+	case GetByteStatus::Reset:
+		transfer->eStatus = AcquisitionStatus::Reset;
+		break;
+	default:
+	case GetByteStatus::Error:
+		transfer->eStatus = AcquisitionStatus::Error;
+		break;
+	}
+
+	// Translate the state of the enable line (or the 3-wire idle condition)
+	// into the chip select events consumed by the decoder.
+	transfer->bCsEvents = 0;
+	transfer->lCsEventSample = 0;
+
+	if (!IsEnableActive())
+	{
+		transfer->bCsEvents |= ABCC_CS_INACTIVE_EVENT;
+	}
+
+	if (WouldAdvancingTheClockToggleEnable(enableEdge, enableEdgeValid))
+	{
+		transfer->bCsEvents |= ABCC_CS_END_EVENT;
+	}
+
+	if (mConfig.f3WireMode)
+	{
+		if (byteStatus == GetByteStatus::Error)
+		{
+			// Only the idle condition ends a 3-wire transfer early
+			transfer->bCsEvents |= ABCC_CS_IDLE_TIMEOUT_EVENT;
+		}
+		else
+		{
+			// Finding the idle condition needs the next clock edge, which may
+			// not be captured yet. It is checked when reading the next
+			// transfer, so this one is decoded first.
+			mIdleCheckPending = true;
+		}
+	}
+
+	if ((transfer->bCsEvents != 0) || (byteStatus == GetByteStatus::Error))
+	{
+		// The end of the transaction, used as the end of fragmented frames
+		if (mEnable == nullptr)
+		{
+			// 3-wire mode fragments exist only when idle gaps are detected too soon.
+			transfer->lCsEventSample = mClock->GetSampleOfNextEdge();
+		}
+		else if (enableEdgeValid)
+		{
+			transfer->lCsEventSample = enableEdge;
+		}
+		else
+		{
+			transfer->lCsEventSample = mEnable->GetSampleOfNextEdge();
+		}
+	}
+
+	return byteStatus;
+}
+
+template <class TChannelData>
+void SpiAcquisition<TChannelData>::CheckForIdleAfterPacket()
+{
+	AbccFrame_t errorFrame = {};
+	U64 markerSample = 0;
+	AcquisitionChannel chn = AcquisitionChannel::Clock;
+	bool addError = false;
+
+	if (mConfig.fPure4WireMode)
+	{
+		U64 nextSample = mEnable->GetSampleOfNextEdge();
+
+		if (nextSample <= mClock->GetSampleNumber())
+		{
+			mEnable->AdvanceToAbsPosition(mClock->GetSampleNumber());
+			nextSample = mEnable->GetSampleOfNextEdge();
+		}
+
+		if (mClock->WouldAdvancingToAbsPositionCauseTransition(nextSample))
+		{
+			U32 maxAllowedTransitions = 0;
+			U32 transitionCount;
+
+			if (mClock->GetBitState() == BitState::BIT_HIGH)
+			{
+				maxAllowedTransitions = 1;
+			}
+
+			errorFrame.lStartingSampleInclusive = mClock->GetSampleOfNextEdge();
+			transitionCount = mClock->AdvanceToAbsPosition(nextSample);
+
+			if (transitionCount > maxAllowedTransitions)
+			{
+				chn = AcquisitionChannel::Enable;
+				errorFrame.lEndingSampleInclusive = mEnable->GetSampleOfNextEdge();
+				markerSample = errorFrame.lEndingSampleInclusive;
+				addError = true;
+			}
+		}
+
+		AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+	}
+	else
+	{
+		// Skip idle check when 4-wire on 3 channels is being used, since it
+		// is impossible to infer if the enable line had toggled or not
+		if (!mConfig.f4WireOn3Channels)
+		{
+			if (!Is3WireIdleCondition(mConfig.lPacketGapSamples))
+			{
+				chn = AcquisitionChannel::Clock;
+				errorFrame.lStartingSampleInclusive = mClock->GetSampleOfNextEdge();
+				AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+				errorFrame.lEndingSampleInclusive = mClock->GetSampleOfNextEdge();
+				markerSample = errorFrame.lStartingSampleInclusive + (errorFrame.lEndingSampleInclusive - errorFrame.lStartingSampleInclusive) / 2;
+				addError = true;
+			}
+		}
+	}
+
+	if (addError)
+	{
+		if ((mConfig.iClockingAlertLimit < 0) ||
+			(mClockingErrorCount < mConfig.iClockingAlertLimit))
+		{
+			mClockingErrorCount++;
+			errorFrame.bFlags = (SPI_ERROR_FLAG | DISPLAY_AS_ERROR_FLAG);
+			errorFrame.bType = AbccSpiError::EndOfTransfer;
+
+			if (mConfig.fExpandBitFrames)
+			{
+				const int minFrameSpan = 8;
+
+				if (errorFrame.lEndingSampleInclusive - errorFrame.lStartingSampleInclusive < minFrameSpan)
+				{
+					errorFrame.lEndingSampleInclusive = errorFrame.lStartingSampleInclusive + minFrameSpan;
+				}
+			}
+
+			mSink->OnFrame(errorFrame);
+			mSink->OnMarker(markerSample, AcquisitionMarker::Error, chn);
+		}
+	}
+}
+
+#endif /* ABCC_SPI_ACQUISITION_H */
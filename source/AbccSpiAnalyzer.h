@@ -13,12 +13,15 @@
 #define ABCC_SPI_ANALYZER_H
 
 #include <stdio.h>
+#include <chrono>
 
 #include "Analyzer.h"
 #include "AbccSpiAnalyzerTypes.h"
+#include "AbccDecoder.h"
+#include "AbccProcessDataFilter.h"
+#include "AbccSpiAcquisition.h"
 #include "AbccSpiAnalyzerResults.h"
 #include "AbccSpiSimulationDataGenerator.h"
-#include "AbccCrc.h"
 
 #ifdef _WIN32
 #define SNPRINTF sprintf_s
@@ -31,64 +34,26 @@
 #define FORMATTED_STRING_BUFFER_SIZE		256
 #define DISPLAY_NUMERIC_STRING_BUFFER_SIZE	128
 
+// ABCC 3-wire timing specification, used by the simulation. The analyzer
+// uses the equivalent (configurable) thresholds from the advanced settings.
 #define MIN_IDLE_GAP_TIME					10.0e-6f
 #define MAX_CLOCK_IDLE_HI_TIME				5.0e-6f
 
+// Limits for deferring the commit of results to Logic; packet boundaries
+// always commit, otherwise whichever limit is reached first commits.
+#define COMMIT_FRAME_LIMIT					256
+#define COMMIT_INTERVAL_MS					100
+
 #define ABCC_STATUS_RESERVED_MASK			0xF0
 #define ABCC_STATUS_SUP_MASK				0x08
 #define ABCC_STATUS_CODE_MASK				0x07
 
-enum class GetByteStatus : U32
-{
-	OK,		// BYTE was successfully read
-	Error,	// Reading BYTE resulted in a logical error (requires statemachine reset)
-	Reset,	// Reading BYTE resulted in a event that requires state machine reset
-	Skip,	// Enable line was toggle with no data clocked. It is an empty packet and can be skipped.
-	SizeOfEnum
-};
-
-// Enum for indicating when to reset a statemachine
-enum class StateOperation : U32
-{
-	Run,
-	Reset,
-	SizeOfEnum
-};
-
-// Enum for indicating whether or not the analyzer succeeded in acquiring an SPI byte
-enum class AcquisitionStatus : U32
-{
-	OK,
-	Reset,
-	Error,
-	SizeOfEnum
-};
-
-enum class PacketType : U32
-{
-	Empty,
-	Command,
-	Response,
-	MessageFragment,
-	ErrorResponse,
-	ProtocolError,
-	ProtocolEvent,
-	ChecksumError,
-	MultiEvent,
-	MultiEventWithError,
-	Cancel,
-	SizeOfEnum
-};
-
-extern const AbccMosiInfo_t asMosiStates[];
-extern const AbccMisoInfo_t asMisoStates[];
-extern const AbccMsgInfo_t asMsgStates[];
-
 class SpiAnalyzerSettings;
+enum class MarkerDensity : U32;
 #ifdef _DEBUG
-class SpiAnalyzer : public Analyzer2
+class SpiAnalyzer : public Analyzer2, public AbccDecoderSink, public AbccAcquisitionSink
 #else
-class ANALYZER_EXPORT SpiAnalyzer : public Analyzer2
+class ANALYZER_EXPORT SpiAnalyzer : public Analyzer2, public AbccDecoderSink, public AbccAcquisitionSink
 #endif
 {
 public:
@@ -104,63 +69,10 @@ public:
 	virtual const char* GetAnalyzerName() const;
 	virtual bool NeedsRerun();
 
-protected: /* Enums, Classes, Types */
-
-	typedef struct MosiVars
-	{
-		S64 lFramesFirstSample;
-		U64 lFrameData;
-		PacketType ePacketType;
-		AbccMosiStates::Enum eState;
-		AbccMosiStates::Enum eMsgSubState;
-		MsgHeaderInfo_t sMsgHeader;
-		AbccCrc oChecksum;
-		U32 dwPdLen;
-		U32 dwPdCnt;
-		U32 dwMsgLen;
-		U32 dwMsgLenCnt;
-		U32 dwByteCnt;
-		U8 bFrameSizeCnt;
-		U16 wMdCnt;
-		U16 wMdSize;
-		U8 bLastToggleState;
-		U8 bLastApplSts;
-		bool fNewMsg;
-		bool fErrorRsp;
-		bool fFragmentation;
-		bool fFirstFrag;
-		bool fLastFrag;
-		bool fWrPdValid;
-		bool fReadyForNewPacket;
-	} MosiVars_t;
-
-	typedef struct MisoVars
-	{
-		S64 lFramesFirstSample;
-		U64 lFrameData;
-		PacketType ePacketType;
-		AbccMisoStates::Enum eState;
-		AbccMisoStates::Enum eMsgSubState;
-		MsgHeaderInfo_t sMsgHeader;
-		AbccCrc oChecksum;
-		U32 dwLastTimestamp;
-		U32 dwPdLen;
-		U32 dwPdCnt;
-		U32 dwMsgLen;
-		U32 dwMsgLenCnt;
-		U32 dwByteCnt;
-		U8 bFrameSizeCnt;
-		U16 wMdCnt;
-		U16 wMdSize;
-		U8 bLastAnbSts;
-		bool fNewMsg;
-		bool fErrorRsp;
-		bool fFragmentation;
-		bool fFirstFrag;
-		bool fLastFrag;
-		bool fNewRdPd;
-		bool fReadyForNewPacket;
-	} MisoVars_t;
+	virtual void OnFrame(const AbccFrame_t& frame);
+	virtual U64 OnFrameData(const U8* data, U32 length);
+	virtual void OnPacketEnd(PacketType mosi_packet_type, PacketType miso_packet_type);
+	virtual void OnMarker(U64 sample, AcquisitionMarker marker, AcquisitionChannel channel);
 
 #pragma warning( push )
 #pragma warning( disable : 4251 ) //warning C4251: 'SpiAnalyzer::<...>' : class <...> needs to have dll-interface to be used by clients of class
@@ -177,18 +89,16 @@ protected: // Members
 	AnalyzerChannelData* mClock;
 	AnalyzerChannelData* mEnable;
 
-	U64 mCurrentSample;
-	S32 mClockingErrorCount;
-	std::vector<U64> mArrowLocations;
-	U8 mSettingsChangeID;
+	U32 mUncommittedFrameCount;
+	std::chrono::steady_clock::time_point mLastCommitTime;
+	U64 mNextProgressSample;
+	bool mProgressDue;
+	U8 mDecodeChangeID;
+	U8 mPresentationChangeID;
 
-	MosiVars_t mMosiVars;
-	MisoVars_t mMisoVars;
-
-	// Backup variables to recover from error cases
-	// that require knowledge of the last valid state
-	MosiVars_t mPreviousMosiVars;
-	MisoVars_t mPreviousMisoVars;
+	AbccDecoder mDecoder;
+	AbccProcessDataFilter mProcessDataFilter;
+	SpiAcquisition<AnalyzerChannelData> mAcquisition;
 
 	bool mSimulationInitialized;
 
@@ -196,38 +106,18 @@ protected: // Members
 
 protected: // Methods
 
-	inline void ProcessSample(AnalyzerChannelData* chn_data, DataBuilder& data, Channel& chn);
+	inline bool IsMarkerEnabled(MarkerDensity density);
 
 	void Setup();
-	void AdvanceToActiveEnableEdge();
-	void AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
-
-	bool IsEnableActive();
-	bool IsInitialClockPolarityCorrect();
-
-	bool WouldAdvancingTheClockToggleEnable();
-
-	GetByteStatus GetByte(U64* mosi_data_ptr, U64* miso_data_ptr, U64* first_sample_ptr);
-
-	void CheckForIdleAfterPacket();
-	void AddFragFrame(SpiChannel_t channel, U64 first_sample, U64 last_sample);
-	void SignalReadyForNewPacket(SpiChannel_t channel);
-
-	void SetMosiPacketType(PacketType packet_type);
-	void SetMisoPacketType(PacketType packet_type);
-	AnalyzerResults::MarkerType GetPacketMarkerType();
-
-	void ProcessMosiFrame(AbccMosiStates::Enum state, U64 frame_data, S64 frames_first_sample);
-	void ProcessMisoFrame(AbccMisoStates::Enum state, U64 frame_data, S64 frames_first_sample);
 
-	bool RunAbccMosiStateMachine(StateOperation operation, AcquisitionStatus acquisition_status, U64 mosi_data, S64 first_sample);
-	bool RunAbccMisoStateMachine(StateOperation operation, AcquisitionStatus acquisition_status, U64 miso_data, S64 first_sample);
+	void CommitResults();
+	void ScheduleCommit(U32 added_frames);
+	void UpdateProgress(bool force);
 
-	bool RunAbccMisoMsgSubStateMachine(StateOperation operation, bool* add_frame_ptr, AbccMisoStates::Enum* substate_ptr);
-	bool RunAbccMosiMsgSubStateMachine(StateOperation operation, bool* add_frame_ptr, AbccMosiStates::Enum* substate_ptr);
+	AnalyzerResults::MarkerType GetPacketMarkerType(PacketType mosi_packet_type, PacketType miso_packet_type);
 
-	bool Is3WireIdleCondition(float idle_time_condition);
-	void RestorePreviousStateVars();
+	void SetupAcquisition();
+	U64 GetSamplesFromNs(S32 time_ns);
 };
 
 extern "C" ANALYZER_EXPORT const char* __cdecl GetAnalyzerName();
@@ -0,0 +1,1672 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccSpiAnalyzerExport.cpp
+**    Summary: Streams decoded frames, one packet at a time, into the exported
+**             CSV files. Shared by the plugin and the offline decoder.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "AbccSpiAnalyzerExport.h"
+#include "AnalyzerHelpers.h"
+#include "AbccSpiAnalyzer.h"
+#include "AbccSpiAnalyzerLookup.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+#define IS_MISO_FRAME(frame)  (!frame.HasFlag(SPI_MOSI_FLAG))
+#define IS_MOSI_FRAME(frame)  (frame.HasFlag(SPI_MOSI_FLAG))
+
+#define MOSI_STR              "MOSI"
+#define MISO_STR              "MISO"
+
+#define FIRST_FRAG_STR        "FIRST_FRAGMENT"
+#define FRAGMENT_STR          "FRAGMENT"
+#define LAST_FRAG_STR         "LAST_FRAGMENT"
+
+#define ERROR_RESPONSE_STR    " (ERR_RSP)"
+#define RESPONSE_STR          " (RSP)"
+#define COMMAND_STR           " (CMD)"
+
+#define CSV_DELIMITER         mDelimiter
+
+/* Decimals of the latencies, in seconds, and of the jitter summary, in ns */
+#define LATENCY_EXPORT_DECIMALS   9
+#define JITTER_EXPORT_DECIMALS    1
+
+static void AppendUnsigned(std::string& text, U64 value)
+{
+	char digits[EXPORT_WRITER_NUMBER_SIZE];
+
+	text.append(digits, AbccExportWriter::FormatUnsigned(value, digits));
+}
+
+SpiAnalyzerExport::SpiAnalyzerExport(ExportType export_type, DisplayBase display_base, const std::string& delimiter, U32 network_type, U32 sample_rate, U64 trigger_sample)
+	: mExportType(export_type),
+	mDisplayBase(display_base),
+	mDelimiter(delimiter),
+	mNetworkType(network_type),
+	mSampleRate(sample_rate),
+	mTriggerSample(trigger_sample),
+	mFrameData(nullptr),
+	mMessages(nullptr),
+	mTransactions(nullptr),
+	mMessageIndex(0),
+	mMosiFragmentation(false),
+	mMisoFragmentation(false),
+	mMosiPreviousFragState(false),
+	mMisoPreviousFragState(false),
+	mAddCsvHeader(true)
+{
+	char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+	SetJitterOptions(TimestampIndexing::AllPackets, 0, 0);
+	SetProcessDataChangesOnly(false);
+
+	/* Most of the exported numbers are bytes, their text is looked up */
+	mByteText.resize(1 << BITS_PER_BYTE);
+	mFrameByteText.resize(1 << BITS_PER_BYTE);
+
+	for (U32 data = 0; data < (1 << BITS_PER_BYTE); data++)
+	{
+		GetNumberString(data, mDisplayBase, BITS_PER_BYTE, dataStr, sizeof(dataStr), BaseType::Numeric);
+		mByteText[data].assign(dataStr);
+		AnalyzerHelpers::GetNumberString(data, mDisplayBase, BITS_PER_BYTE, dataStr, sizeof(dataStr));
+		mFrameByteText[data].assign(dataStr);
+	}
+}
+
+SpiAnalyzerExport::~SpiAnalyzerExport()
+{
+	End();
+}
+
+void SpiAnalyzerExport::Start(const char* file)
+{
+	mWriter.Open(file);
+
+	switch (mExportType)
+	{
+	case ExportType::Frames:
+		mWriter.Write("Channel" + CSV_DELIMITER +
+					  "Time [s]" + CSV_DELIMITER +
+					  "Packet ID" + CSV_DELIMITER +
+					  "Frame Type" + CSV_DELIMITER +
+					  "Frame Data\n");
+		break;
+	case ExportType::MessageData:
+		mWriter.Write("Channel" + CSV_DELIMITER +
+					  "Time [s]" + CSV_DELIMITER +
+					  "Packet ID" + CSV_DELIMITER +
+					  "Error Event" + CSV_DELIMITER +
+					  "Anybus State" + CSV_DELIMITER +
+					  "Application State" + CSV_DELIMITER +
+					  "Message Fragmentation" + CSV_DELIMITER +
+					  "Message Size [bytes]" + CSV_DELIMITER +
+					  "Source ID" + CSV_DELIMITER +
+					  "Object" + CSV_DELIMITER +
+					  "Instance" + CSV_DELIMITER +
+					  "Command" + CSV_DELIMITER +
+					  "CmdExt" + CSV_DELIMITER +
+					  "Message Data");
+		break;
+	case ExportType::Latency:
+		mWriter.Write("Object" + CSV_DELIMITER +
+					  "Command" + CSV_DELIMITER +
+					  "Count" + CSV_DELIMITER +
+					  "Error Responses" + CSV_DELIMITER +
+					  "Min [s]" + CSV_DELIMITER +
+					  "Mean [s]" + CSV_DELIMITER +
+					  "P50 [s]" + CSV_DELIMITER +
+					  "P99 [s]" + CSV_DELIMITER +
+					  "Max [s]");
+
+		for (U32 bin = 1; bin < LATENCY_HISTOGRAM_BINS; bin++)
+		{
+			mWriter.Write(CSV_DELIMITER);
+			mWriter.Write("<");
+			mWriter.WriteUnsigned((U64)AbccLatencyStatistics::GetBinLowerBound(bin));
+			mWriter.Write(" us");
+		}
+
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.Write(">=");
+		mWriter.WriteUnsigned((U64)AbccLatencyStatistics::GetBinLowerBound(LATENCY_HISTOGRAM_BINS - 1));
+		mWriter.Write(" us\n");
+		break;
+	case ExportType::Jitter:
+		mWriter.Write("Time [s]" + CSV_DELIMITER +
+					  "Packet ID" + CSV_DELIMITER +
+					  "Network Time" + CSV_DELIMITER +
+					  "Network Delta [ns]" + CSV_DELIMITER +
+					  "Network Deviation [ns]" + CSV_DELIMITER +
+					  "SPI Period [ns]" + CSV_DELIMITER +
+					  "SPI Deviation [ns]" + CSV_DELIMITER +
+					  "Outlier\n");
+		break;
+	case ExportType::ProcessData:
+	default:
+		/* The header depends on the process data size and is added with the first entry */
+		break;
+	}
+}
+
+void SpiAnalyzerExport::SetFrameData(const AbccByteArena* frame_data)
+{
+	mFrameData = frame_data;
+}
+
+void SpiAnalyzerExport::SetJitterOptions(TimestampIndexing filter, U32 nominal_cycle_ns, U32 threshold_ns)
+{
+	mJitterFilter = filter;
+	mJitter.Configure(mSampleRate, nominal_cycle_ns, threshold_ns);
+}
+
+void SpiAnalyzerExport::SetProcessDataChangesOnly(bool changes_only)
+{
+	mProcessDataChangesOnly = changes_only;
+	mMosiImage.clear();
+	mMisoImage.clear();
+}
+
+void SpiAnalyzerExport::SetTransactions(const AbccMessageTable* messages, const AbccTransactionIndex* transactions)
+{
+	mMessages = messages;
+	mTransactions = transactions;
+	mMessageIndex = 0;
+}
+
+void SpiAnalyzerExport::End()
+{
+	if (mWriter.IsOpen())
+	{
+		if (mExportType == ExportType::Latency)
+		{
+			WriteLatencyEntries();
+		}
+		else if (mExportType == ExportType::Jitter)
+		{
+			mJitter.Finish();
+			WriteJitterEntries();
+			WriteJitterSummary();
+		}
+
+		mWriter.Close();
+	}
+}
+
+void SpiAnalyzerExport::AddPacket(U64 packet_id, const Frame* frames, U64 frame_count)
+{
+	switch (mExportType)
+	{
+	case ExportType::Frames:
+		/* Export all frame data */
+		AddFrameEntries(packet_id, frames, frame_count);
+		break;
+	case ExportType::MessageData:
+		/* Export 'valid' message data */
+		if (packet_id != INVALID_RESULT_INDEX)
+		{
+			AddMessageDataEntries(packet_id, frames, frame_count);
+		}
+		break;
+	case ExportType::ProcessData:
+		/* Export 'valid' process data */
+		if (packet_id != INVALID_RESULT_INDEX)
+		{
+			AddProcessDataEntries(packet_id, frames, frame_count);
+		}
+		break;
+	case ExportType::Jitter:
+		/* Export the network time of 'valid' packets */
+		if (packet_id != INVALID_RESULT_INDEX)
+		{
+			AddJitterEntries(packet_id, frames, frame_count);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+void SpiAnalyzerExport::AddTransaction(const AbccTransaction_t& transaction)
+{
+	const U8 excludedFlags = ABCC_TRANSACTION_DUPLICATED_FLAG | ABCC_TRANSACTION_MISMATCH_FLAG;
+
+	if ((mExportType != ExportType::Latency) ||
+		(transaction.lCommandMessage == INVALID_MESSAGE_INDEX) ||
+		(transaction.lResponseMessage == INVALID_MESSAGE_INDEX) ||
+		((transaction.bFlags & excludedFlags) != 0) ||
+		(mSampleRate == 0))
+	{
+		return;
+	}
+
+	mLatency.Add(
+		transaction.sHeader.obj,
+		transaction.sHeader.cmd,
+		(double)(transaction.lResponseEndSample - transaction.lCommandStartSample) / (double)mSampleRate,
+		((transaction.bFlags & ABCC_TRANSACTION_ERROR_RESPONSE_FLAG) != 0));
+}
+
+void SpiAnalyzerExport::WriteLatencyEntries()
+{
+	char objStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+	char cmdStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+	for (const auto& entry : mLatency.GetStatistics())
+	{
+		const LatencyStatistics_t& statistics = entry.second;
+		U8 obj = AbccLatencyStatistics::GetObject(entry.first);
+
+		GetObjectString(obj, objStr, sizeof(objStr), mDisplayBase);
+		GetCmdString(AbccLatencyStatistics::GetCommand(entry.first), obj, cmdStr, sizeof(cmdStr), mDisplayBase);
+
+		mWriter.Write(objStr);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.Write(cmdStr);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteUnsigned(statistics.lCount);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteUnsigned(statistics.lErrorResponses);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(statistics.rMin, LATENCY_EXPORT_DECIMALS);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(statistics.rSum / (double)statistics.lCount, LATENCY_EXPORT_DECIMALS);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(AbccLatencyStatistics::GetPercentile(statistics, 0.50), LATENCY_EXPORT_DECIMALS);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(AbccLatencyStatistics::GetPercentile(statistics, 0.99), LATENCY_EXPORT_DECIMALS);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(statistics.rMax, LATENCY_EXPORT_DECIMALS);
+
+		for (U32 bin = 0; bin < LATENCY_HISTOGRAM_BINS; bin++)
+		{
+			mWriter.Write(CSV_DELIMITER);
+			mWriter.WriteUnsigned(statistics.alHistogram[bin]);
+		}
+
+		mWriter.Write('\n');
+	}
+
+	mLatency.Clear();
+}
+
+void SpiAnalyzerExport::AddJitterEntries(U64 packet_id, const Frame* frames, U64 frame_count)
+{
+	for (U64 i = 0; i < frame_count; i++)
+	{
+		Frame frame = frames[i];
+
+		if (IS_MISO_FRAME(frame) && !frame.HasFlag(SPI_ERROR_FLAG) && (frame.mType == AbccMisoStates::NetworkTime))
+		{
+			const NetworkTimeInfo_t* networkTimeInfo = (const NetworkTimeInfo_t*)&frame.mData2;
+			bool addEntry;
+
+			switch (mJitterFilter)
+			{
+			case TimestampIndexing::WriteProcessDataValid:
+				addEntry = networkTimeInfo->wrPdValid;
+				break;
+			case TimestampIndexing::NewReadProcessData:
+				addEntry = networkTimeInfo->newRdPd;
+				break;
+			case TimestampIndexing::AllPackets:
+			case TimestampIndexing::Disabled:
+			default:
+				addEntry = true;
+				break;
+			}
+
+			if (addEntry)
+			{
+				mJitter.AddTimestamp(packet_id, (S64)frame.mStartingSampleInclusive, (U32)frame.mData1);
+				WriteJitterEntries();
+			}
+
+			break;
+		}
+	}
+}
+
+void SpiAnalyzerExport::WriteJitterEntries()
+{
+	JitterInterval_t interval;
+
+	while (mJitter.GetInterval(&interval))
+	{
+		mWriter.WriteTime((U64)interval.lSample, mTriggerSample, mSampleRate);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteUnsigned(interval.lPacketId);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteHex(interval.dwNetworkTime, 8);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteUnsigned(interval.dwNetworkDelta);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteSigned(interval.lNetworkDeviation);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteSigned(interval.lSpiPeriod);
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteSigned(interval.lSpiDeviation);
+		mWriter.Write(CSV_DELIMITER);
+
+		if ((interval.bFlags & JITTER_NETWORK_OUTLIER_FLAG) != 0)
+		{
+			mWriter.Write("NETWORK");
+		}
+
+		if ((interval.bFlags & (JITTER_NETWORK_OUTLIER_FLAG | JITTER_SPI_OUTLIER_FLAG)) == (JITTER_NETWORK_OUTLIER_FLAG | JITTER_SPI_OUTLIER_FLAG))
+		{
+			mWriter.Write('|');
+		}
+
+		if ((interval.bFlags & JITTER_SPI_OUTLIER_FLAG) != 0)
+		{
+			mWriter.Write("SPI");
+		}
+
+		mWriter.Write('\n');
+	}
+}
+
+void SpiAnalyzerExport::WriteJitterSummary()
+{
+	const JitterSummary_t& summary = mJitter.GetSummary();
+	const JitterStatistics_t* statistics[] = { &summary.sNetwork, &summary.sSpi };
+	const char* names[] = { "Network Deviation", "SPI Deviation" };
+
+	/* The summary follows the intervals, separated by an empty row */
+	mWriter.Write("\nSummary\n");
+	mWriter.Write("Intervals");
+	mWriter.Write(CSV_DELIMITER);
+	mWriter.WriteUnsigned(summary.sNetwork.lCount);
+	mWriter.Write("\nNominal Cycle [ns]");
+	mWriter.Write(CSV_DELIMITER);
+	mWriter.WriteUnsigned(summary.dwNominalCycle);
+	mWriter.Write("\nOutlier Threshold [ns]");
+	mWriter.Write(CSV_DELIMITER);
+	mWriter.WriteUnsigned(summary.dwThreshold);
+	mWriter.Write("\nNetwork Outliers");
+	mWriter.Write(CSV_DELIMITER);
+	mWriter.WriteUnsigned(summary.lNetworkOutliers);
+	mWriter.Write("\nSPI Outliers");
+	mWriter.Write(CSV_DELIMITER);
+	mWriter.WriteUnsigned(summary.lSpiOutliers);
+	mWriter.Write('\n');
+
+	for (U32 i = 0; i < 2; i++)
+	{
+		mWriter.Write(names[i]);
+		mWriter.Write(" Min [ns]");
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteSigned(statistics[i]->lMin);
+		mWriter.Write('\n');
+		mWriter.Write(names[i]);
+		mWriter.Write(" Mean [ns]");
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(statistics[i]->rMean, JITTER_EXPORT_DECIMALS);
+		mWriter.Write('\n');
+		mWriter.Write(names[i]);
+		mWriter.Write(" Max [ns]");
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteSigned(statistics[i]->lMax);
+		mWriter.Write('\n');
+		mWriter.Write(names[i]);
+		mWriter.Write(" Std Dev [ns]");
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteFixed(AbccJitterAnalyzer::GetStandardDeviation(*statistics[i]), JITTER_EXPORT_DECIMALS);
+		mWriter.Write('\n');
+	}
+
+	for (U32 bin = 0; bin < JITTER_HISTOGRAM_BINS; bin++)
+	{
+		if (bin < (JITTER_HISTOGRAM_BINS - 1))
+		{
+			mWriter.Write("|Network Deviation| <");
+			mWriter.WriteUnsigned(AbccJitterAnalyzer::GetBinUpperBound(bin));
+		}
+		else
+		{
+			mWriter.Write("|Network Deviation| >=");
+			mWriter.WriteUnsigned(AbccJitterAnalyzer::GetBinUpperBound(bin - 1));
+		}
+
+		mWriter.Write(" ns");
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteUnsigned(summary.alHistogram[bin]);
+		mWriter.Write('\n');
+	}
+}
+
+void SpiAnalyzerExport::ClearEntryBuffers()
+{
+	// The capacity is kept for the following packets
+	mMisoHead.clear();
+	mMosiHead.clear();
+	mMisoTail.clear();
+	mMosiTail.clear();
+	mSharedBody.clear();
+	mMosiFrameText.clear();
+	mMisoFrameText.clear();
+}
+
+const std::vector<U8>& SpiAnalyzerExport::GetFrameBytes(const Frame& frame)
+{
+	mFrameBytes.resize((size_t)GET_AGGREGATED_FRAME_LENGTH(frame.mData1));
+
+	if ((mFrameData == nullptr) || mFrameBytes.empty())
+	{
+		mFrameBytes.clear();
+	}
+	else
+	{
+		mFrameBytes.resize(mFrameData->Read(GET_AGGREGATED_FRAME_OFFSET(frame.mData1), mFrameBytes.data(), (U32)mFrameBytes.size()));
+	}
+
+	return mFrameBytes;
+}
+
+void SpiAnalyzerExport::AppendNumberString(std::string& csv_data, U64 number, U32 num_data_bits)
+{
+	if ((num_data_bits == BITS_PER_BYTE) && (number <= 0xFF))
+	{
+		csv_data.append(mByteText[number]);
+	}
+	else
+	{
+		char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+		GetNumberString(number, mDisplayBase, num_data_bits, dataStr, sizeof(dataStr), BaseType::Numeric);
+		csv_data.append(dataStr);
+	}
+}
+
+void SpiAnalyzerExport::AppendFrameBytes(std::string& csv_data, const Frame& frame, const char* separator)
+{
+	bool first = true;
+
+	for (U8 data : GetFrameBytes(frame))
+	{
+		if (!first)
+		{
+			csv_data.append(separator);
+		}
+
+		csv_data.append(mByteText[data]);
+		first = false;
+	}
+}
+
+void SpiAnalyzerExport::UpdateImage(std::vector<U8>& image, const Frame& frame)
+{
+	size_t offset = (size_t)frame.mData2;
+
+	if ((frame.mFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+	{
+		const std::vector<U8>& data = GetFrameBytes(frame);
+
+		if (image.size() < offset + data.size())
+		{
+			image.resize(offset + data.size());
+		}
+
+		std::copy(data.begin(), data.end(), image.begin() + offset);
+	}
+	else
+	{
+		if (image.size() <= offset)
+		{
+			image.resize(offset + 1);
+		}
+
+		image[offset] = (U8)frame.mData1;
+	}
+}
+
+void SpiAnalyzerExport::AppendImageBytes(std::string& csv_data, const std::vector<U8>& image)
+{
+	for (U8 data : image)
+	{
+		csv_data.append(CSV_DELIMITER).append(mByteText[data]);
+	}
+}
+
+void SpiAnalyzerExport::AddFrameEntries(U64 packet_id, const Frame* frames, U64 frame_count)
+{
+	/* The entries are written straight to the (buffered) file */
+	for (U64 i = 0; i < frame_count; i++)
+	{
+		Frame frame = frames[i];
+
+		if (frame.HasFlag(SPI_ERROR_FLAG))
+		{
+			mWriter.Write("ERROR");
+		}
+		else
+		{
+			if (IS_MOSI_FRAME(frame))
+			{
+				mWriter.Write(MOSI_STR);
+			}
+			else
+			{
+				mWriter.Write(MISO_STR);
+			}
+		}
+
+		mWriter.Write(CSV_DELIMITER);
+		mWriter.WriteTime(frame.mStartingSampleInclusive, mTriggerSample, mSampleRate);
+		mWriter.Write(CSV_DELIMITER);
+
+		if (packet_id != INVALID_RESULT_INDEX)
+		{
+			mWriter.WriteUnsigned(packet_id);
+		}
+
+		mWriter.Write(CSV_DELIMITER);
+
+		if (frame.HasFlag(SPI_ERROR_FLAG))
+		{
+			switch (frame.mType)
+			{
+			case AbccSpiError::Fragmentation:
+				mWriter.Write("FRAGMENT");
+				break;
+			case AbccSpiError::EndOfTransfer:
+				mWriter.Write("CLOCKING");
+				break;
+			case AbccSpiError::Generic:
+			default:
+				mWriter.Write("GENERIC");
+				break;
+			}
+		}
+		else
+		{
+			if (IS_MOSI_FRAME(frame))
+			{
+				mWriter.Write(GET_MOSI_FRAME_TAG(frame.mType));
+			}
+			else
+			{
+				mWriter.Write(GET_MISO_FRAME_TAG(frame.mType));
+			}
+		}
+
+		mWriter.Write(CSV_DELIMITER);
+
+		if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+		{
+			/* All bytes of the block, separated by spaces */
+			mFrameText.clear();
+			AppendFrameBytes(mFrameText, frame, " ");
+			mWriter.Write(mFrameText);
+		}
+		else if (!frame.HasFlag(SPI_ERROR_FLAG))
+		{
+			U32 bits = GET_MOSI_FRAME_BITSIZE(frame.mType);
+
+			// The size is that of the MOSI frame, wider values are written in full
+			if ((bits == BITS_PER_BYTE) && (frame.mData1 <= 0xFF))
+			{
+				mWriter.Write(mFrameByteText[frame.mData1]);
+			}
+			else
+			{
+				char frameDataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+				AnalyzerHelpers::GetNumberString(frame.mData1, mDisplayBase, bits, frameDataStr, sizeof(frameDataStr));
+				mWriter.Write(frameDataStr);
+			}
+		}
+
+		mWriter.Write('\n');
+	}
+}
+
+void SpiAnalyzerExport::AppendCsvHeaderDelimeters(std::string& csv_data, U8 count, bool& add_header_delims)
+{
+	if (add_header_delims)
+	{
+		for (U8 i = 0U; i < count; i++)
+		{
+			csv_data.append(CSV_DELIMITER);
+		}
+
+		add_header_delims = false;
+	}
+}
+
+void SpiAnalyzerExport::AppendCsvMessageEntry(std::string& csv_head, const std::string& csv_body, const std::string& csv_tail, ErrorEvent event)
+{
+	csv_head.append(CSV_DELIMITER);
+
+	switch (event)
+	{
+	case ErrorEvent::SpiFragmentationError:
+		csv_head.append("SPI_ERROR");
+		break;
+	case ErrorEvent::RetransmitWarning:
+		csv_head.append("RETRANSMIT");
+		break;
+	case ErrorEvent::CrcError:
+		csv_head.append("CRC_ERROR");
+		break;
+	case ErrorEvent::OrphanedResponse:
+		csv_head.append("ORPHANED_RSP");
+		break;
+	case ErrorEvent::DuplicatedResponse:
+		csv_head.append("DUPLICATED_RSP");
+		break;
+	case ErrorEvent::MismatchedResponse:
+		csv_head.append("MISMATCHED_RSP");
+		break;
+	case ErrorEvent::ReusedSourceId:
+		csv_head.append("SRC_ID_REUSED");
+		break;
+	case ErrorEvent::None:
+	default:
+		break;
+	}
+
+	mWriter.Write(csv_head);
+	mWriter.Write(csv_body);
+	mWriter.Write(csv_tail);
+}
+
+void SpiAnalyzerExport::AppendCsvSafeString(std::string& csv_data, char* input_data_str, DisplayBase display_base)
+{
+	const char doubleQuote[] = "\"";
+	std::string csvStr;
+	bool isStringData = (
+		(display_base == DisplayBase::ASCII) ||
+		(display_base == DisplayBase::AsciiHex));
+
+	if (!isStringData)
+	{
+		csv_data.append(CSV_DELIMITER).append(input_data_str);
+		return;
+	}
+
+	csvStr.assign(input_data_str);
+
+	csv_data.append(CSV_DELIMITER);
+
+	// The first two cases below are to reverse the Saleae Logic SDK's handling
+	// of the 'space' and 'comma' ASCII characters. In this case the plugin will
+	// escape the characters only if necessary based on the state of the
+	// CSV delimiter.
+
+	if (csvStr.find("COMMA") != std::string::npos)
+	{
+		std::string comma = ",";
+
+		if (CSV_DELIMITER.compare(comma) == 0)
+		{
+			/* Replace with comma-character and surround with double quotes */
+			csv_data.append(doubleQuote).append(comma).append(doubleQuote);
+		}
+		else
+		{
+			/* Replace with space-character */
+			csv_data.append(comma);
+		}
+	}
+	else if (csvStr.find("' '") != std::string::npos)
+	{
+		std::string space = " ";
+
+		if (CSV_DELIMITER.compare(space) == 0)
+		{
+			/* Replace with space-character and surround with double quotes */
+			csv_data.append(doubleQuote).append(space).append(doubleQuote);
+		}
+		else
+		{
+			/* Replace with space-character */
+			csv_data.append(space);
+		}
+	}
+	else
+	{
+		if (csvStr.find('"') != std::string::npos)
+		{
+			/* Escape double-quotes */
+			for (std::string::size_type n = 0;
+				(n = csvStr.find(doubleQuote, n)) != std::string::npos;
+				n += 2)
+			{
+				csvStr.replace(n, 1, "\"\"");
+			}
+
+			/* Wrap element in double quotes */
+			csvStr.insert(0, doubleQuote);
+			csvStr.append(doubleQuote);
+		}
+
+		if (csvStr.find(CSV_DELIMITER) != std::string::npos)
+		{
+			/* Wrap element in double quotes */
+			csvStr.insert(0, doubleQuote);
+			csvStr.append(doubleQuote);
+		}
+
+		/* No escaping needed */
+		csv_data.append(csvStr);
+	}
+}
+
+void SpiAnalyzerExport::BufferCsvMessageMsgEntry(
+	Frame& frame,
+	std::string& csv_data,
+	bool& align_msg_fields,
+	DisplayBase display_base)
+{
+	char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+	// NOTE: AbccMosiStates and AbccMisoStates are assumed to have aligned
+	// values for AbccMosiStates::MessageField* and AbccMisoStates::MessageField*.
+	// This means only one of the enums will be used for the cases defined below.
+
+	switch (frame.mType)
+	{
+	case AbccMisoStates::MessageField_Size:
+	{
+		GetNumberString(frame.mData1, DisplayBase::Decimal, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
+		csv_data.append(CSV_DELIMITER).append(dataStr);
+		align_msg_fields = false;
+		break;
+	}
+
+	case AbccMisoStates::MessageField_SourceId:
+	{
+		GetNumberString(frame.mData1, DisplayBase::Decimal, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
+		AppendCsvHeaderDelimeters(csv_data, 1, align_msg_fields);
+		csv_data.append(CSV_DELIMITER).append(dataStr);
+		break;
+	}
+
+	case AbccMisoStates::MessageField_Object:
+	{
+		GetObjectString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
+		AppendCsvHeaderDelimeters(csv_data, 2, align_msg_fields);
+		csv_data.append(CSV_DELIMITER).append(dataStr);
+		break;
+	}
+
+	case AbccMisoStates::MessageField_Instance:
+	{
+		NotifEvent_t notification = NotifEvent::None;
+		bool found = GetInstString((U8)mNetworkType, (U8)frame.mData2, (U16)frame.mData1, dataStr, sizeof(dataStr), &notification, display_base);
+
+		if (!found)
+		{
+			SNPRINTF(dataStr, sizeof(dataStr), "0x%04X", (U16)frame.mData1);
+		}
+
+		AppendCsvHeaderDelimeters(csv_data, 3, align_msg_fields);
+		csv_data.append(CSV_DELIMITER).append(dataStr);
+
+		break;
+	}
+
+	case AbccMisoStates::MessageField_Command:
+	{
+		GetCmdString((U8)frame.mData1, (U8)frame.mData2, dataStr, sizeof(dataStr), display_base);
+		AppendCsvHeaderDelimeters(csv_data, 4, align_msg_fields);
+
+		if (((U8)frame.mData1 & ABP_MSG_HEADER_E_BIT) == ABP_MSG_HEADER_E_BIT)
+		{
+			csv_data.append(CSV_DELIMITER).append(dataStr).append(ERROR_RESPONSE_STR);
+		}
+		else
+		{
+			if (((U8)frame.mData1 & ABP_MSG_HEADER_C_BIT) == ABP_MSG_HEADER_C_BIT)
+			{
+				csv_data.append(CSV_DELIMITER).append(dataStr).append(COMMAND_STR);
+			}
+			else
+			{
+				csv_data.append(CSV_DELIMITER).append(dataStr).append(RESPONSE_STR);
+			}
+		}
+
+		break;
+	}
+
+	case AbccMisoStates::MessageField_CommandExtension:
+	{
+		NotifEvent_t notification = NotifEvent::None;
+		DisplayBase displayBase = DisplayBase::Hexadecimal;
+		U16 cmdExt = static_cast<U16>(frame.mData1);
+		MsgHeaderInfo_t* psMsgHdr = reinterpret_cast<MsgHeaderInfo_t*>(&frame.mData2);
+
+		if (IsNonIndexedAttributeCmd(psMsgHdr->cmd))
+		{
+			GetAttrString(psMsgHdr->obj, psMsgHdr->inst, cmdExt, dataStr, sizeof(dataStr), AttributeAccessMode::Normal, &notification, displayBase);
+		}
+		else if (IsIndexedAttributeCmd(psMsgHdr->cmd))
+		{
+			GetAttrString(psMsgHdr->obj, psMsgHdr->inst, cmdExt, dataStr, sizeof(dataStr), AttributeAccessMode::Indexed, &notification, displayBase);
+		}
+		else
+		{
+			SegmentationType segmentation = GetMessageSegmentationType(psMsgHdr);
+
+			if (segmentation != SegmentationType::None)
+			{
+				bool commandMsg = IsCommandMessage(psMsgHdr);
+				bool segmentationMsg = IsSegmentedMessage(commandMsg, segmentation);
+				U8 cmdExt0 = (cmdExt >> 0) & 0xFF;
+				U8 cmdExt1 = (cmdExt >> 8) & 0xFF;
+				U8 validFlags = 0;
+
+				notification = NotifEvent::None;
+
+				if (commandMsg)
+				{
+					validFlags |= ABP_MSG_CMDEXT1_SEG_ABORT;
+				}
+
+				if (segmentationMsg)
+				{
+					validFlags |= ABP_MSG_CMDEXT1_SEG_FIRST | ABP_MSG_CMDEXT1_SEG_LAST;
+				}
+
+				if (cmdExt1 & ~validFlags)
+				{
+					notification = NotifEvent::Alert;
+					SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | Segmentation Unknown (0x%02X)", cmdExt0, cmdExt1);
+				}
+				else if (cmdExt1 & ABP_MSG_CMDEXT1_SEG_ABORT)
+				{
+					notification = NotifEvent::Alert;
+					SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | Segmentation Aborted", cmdExt0);
+				}
+				else if (segmentationMsg)
+				{
+					cmdExt1 &= (ABP_MSG_CMDEXT1_SEG_FIRST | ABP_MSG_CMDEXT1_SEG_LAST);
+
+					switch (cmdExt1)
+					{
+					case 0:
+						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | SEGMENT", cmdExt0);
+						break;
+					case ABP_MSG_CMDEXT1_SEG_FIRST:
+						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | FIRST_SEGMENT", cmdExt0);
+						break;
+					case ABP_MSG_CMDEXT1_SEG_LAST:
+						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | LAST_SEGMENT", cmdExt0);
+						break;
+					case (ABP_MSG_CMDEXT1_SEG_FIRST | ABP_MSG_CMDEXT1_SEG_LAST):
+					default:
+						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | FIRST_SEGMENT | LAST_SEGMENT", cmdExt0);
+						break;
+					}
+				}
+				else
+				{
+					// Message relates to segmentation but is either a command for
+					// "segmented response" or a response to a "segmented command".
+					GetNumberString(cmdExt, displayBase, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
+				}
+			}
+			else
+			{
+				GetNumberString(cmdExt, displayBase, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
+			}
+		}
+
+		AppendCsvHeaderDelimeters(csv_data, 5, align_msg_fields);
+		csv_data.append(CSV_DELIMITER).append(dataStr);
+
+		break;
+	}
+
+	case AbccMisoStates::MessageField_Data:
+	case AbccMisoStates::MessageField:
+	{
+		MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
+
+		if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+		{
+			BufferCsvMessageDataRun(frame, csv_data, align_msg_fields, display_base);
+			break;
+		}
+
+		if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
+		{
+			const U16 nwSpecErrCodeOffset = 2;
+
+			/* The error response may be composed of one to three bytes.
+			** This payload can represent a common error response,
+			** an object specific error response, or a network specific
+			** error response. */
+
+			if (info->msgDataCnt == 0)
+			{
+				GetErrorRspString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
+			}
+			else if (info->msgDataCnt <= nwSpecErrCodeOffset)
+			{
+				U8 nwTypeIdx = 0;
+				bool nwSpecificError = (info->msgDataCnt == nwSpecErrCodeOffset);
+
+				if (nwSpecificError)
+				{
+					nwTypeIdx = static_cast<U8>(mNetworkType);
+				}
+
+				GetErrorRspString(nwSpecificError, nwTypeIdx, info->msgHeader.obj, (U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
+
+				// Explicitly set display_base to ASCII to ensure proper escaping
+				// is performed when calling AppendCsvSafeString().
+				display_base = DisplayBase::ASCII;
+			}
+		}
+		else
+		{
+			BaseType type;
+			bool exception = false;
+			bool attribute = IsAttributeCmd(info->msgHeader.cmd);
+			bool firstAttributeByte = (attribute && (info->msgDataCnt == 0));
+
+			if (attribute)
+			{
+				type = GetAttrBaseType(info->msgHeader.obj, info->msgHeader.inst, (U8)info->msgHeader.cmdExt);
+			}
+			else
+			{
+				type = GetCmdBaseType(info->msgHeader.obj, info->msgHeader.cmd);
+			}
+
+			if (IS_MISO_FRAME(frame) && firstAttributeByte)
+			{
+				bool nwObject = (info->msgHeader.obj == ABP_OBJ_NUM_NW);
+				U16 tableIndex;
+
+				if (GetExceptionTableIndex(nwObject, (U8)mNetworkType, &info->msgHeader, &tableIndex))
+				{
+					GetExceptionString(nwObject, tableIndex, (U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
+
+					// Explicitly set display_base to ASCII to ensure proper escaping
+					// is performed when calling AppendCsvSafeString().
+					display_base = DisplayBase::ASCII;
+					exception = true;
+				}
+			}
+
+			if (!exception)
+			{
+				GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), type);
+			}
+		}
+
+		AppendCsvHeaderDelimeters(csv_data, 6, align_msg_fields);
+
+		AppendCsvSafeString(csv_data, dataStr, display_base);
+
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+void SpiAnalyzerExport::BufferCsvMessageDataRun(
+	Frame& frame,
+	std::string& csv_data,
+	bool& align_msg_fields,
+	DisplayBase display_base)
+{
+	// The bytes of the run are exported as the frames of the individual
+	// bytes would have been
+	MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
+	std::vector<U8> data = GetFrameBytes(frame);
+	Frame byteFrame = frame;
+	MsgDataFrameData2_t* byteInfo = (MsgDataFrameData2_t*)&byteFrame.mData2;
+
+	for (size_t i = 0; i < data.size(); i++)
+	{
+		byteFrame.mData1 = data[i];
+		byteInfo->msgDataCnt = (U16)(info->msgDataCnt + i);
+		byteFrame.mFlags = frame.mFlags & ~(SPI_AGGREGATED_FRAME_FLAG | SPI_PROTO_EVENT_FLAG);
+
+		if (frame.HasFlag(SPI_PROTO_EVENT_FLAG) && IsErrorRspByte(info->msgDataCnt, data[0], byteInfo->msgDataCnt))
+		{
+			byteFrame.mFlags |= SPI_PROTO_EVENT_FLAG;
+		}
+
+		BufferCsvMessageMsgEntry(byteFrame, csv_data, align_msg_fields, display_base);
+	}
+}
+
+void SpiAnalyzerExport::BufferCsvMessageMisoEntry(
+	U32 sample_rate,
+	U64 trigger_sample,
+	U64 packet_id,
+	Frame& frame,
+	std::string& csv_head,
+	std::string& csv_body,
+	std::string& csv_tail,
+	ErrorEvent& mosi_event,
+	ErrorEvent& miso_event,
+	bool& fragmentation,
+	bool& anb_stat_reached,
+	bool& align_msg_fields,
+	bool& add_entry,
+	DisplayBase display_base)
+{
+	switch (frame.mType)
+	{
+	case AbccSpiError::Fragmentation:
+		miso_event = ErrorEvent::SpiFragmentationError;
+		break;
+
+	case AbccMisoStates::AnybusStatus:
+	{
+		char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+		anb_stat_reached = true;
+		GetAbccStatusString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
+		csv_body.append(CSV_DELIMITER).append(dataStr);
+
+		break;
+	}
+
+	case AbccMisoStates::SpiStatus:
+	{
+		bool message = ((frame.mData1 & ABP_SPI_STATUS_M) != 0);
+
+		if (message)
+		{
+			char timeStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+			/* Add in the timestamp, packet ID, and Anybus state */
+			AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, trigger_sample, sample_rate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
+			csv_head.append("\n").append(MISO_STR).append(CSV_DELIMITER).append(timeStr).append(CSV_DELIMITER);
+			AppendUnsigned(csv_head, packet_id);
+			add_entry = true;
+		}
+
+		csv_tail.append(CSV_DELIMITER);
+
+		if (message)
+		{
+			if (frame.mData1 & ABP_SPI_STATUS_LAST_FRAG)
+			{
+				if (fragmentation)
+				{
+					csv_tail.append(LAST_FRAG_STR);
+					fragmentation = false;
+				}
+			}
+			else
+			{
+				if (!fragmentation)
+				{
+					fragmentation = true;
+					csv_tail.append(FIRST_FRAG_STR);
+				}
+				else
+				{
+					csv_tail.append(FRAGMENT_STR);
+				}
+			}
+		}
+
+		break;
+	}
+
+	case AbccMisoStates::MessageField_Size:
+	case AbccMisoStates::MessageField_SourceId:
+	case AbccMisoStates::MessageField_Object:
+	case AbccMisoStates::MessageField_Instance:
+	case AbccMisoStates::MessageField_Command:
+	case AbccMisoStates::MessageField_CommandExtension:
+	case AbccMisoStates::MessageField_Data:
+	case AbccMisoStates::MessageField:
+		BufferCsvMessageMsgEntry(
+			frame,
+			csv_tail,
+			align_msg_fields,
+			display_base);
+
+		break;
+
+	case AbccMisoStates::Crc32:
+	{
+		if ((U32)frame.mData1 != (U32)frame.mData2)
+		{
+			miso_event = ErrorEvent::CrcError;
+			mosi_event = ErrorEvent::CrcError;
+		}
+
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+void SpiAnalyzerExport::BufferCsvMessageMosiEntry(
+	U32 sample_rate,
+	U64 trigger_sample,
+	U64 packet_id,
+	Frame &frame,
+	std::string& csv_head,
+	std::string& csv_body,
+	std::string& csv_tail,
+	ErrorEvent &mosi_event,
+	ErrorEvent &miso_event,
+	bool &fragmentation,
+	bool &app_stat_reached,
+	bool &align_msg_fields,
+	bool &add_entry,
+	DisplayBase display_base)
+{
+	switch (frame.mType)
+	{
+		case AbccSpiError::Fragmentation:
+			mosi_event = ErrorEvent::SpiFragmentationError;
+			break;
+
+		case AbccMosiStates::SpiControl:
+		{
+			char timeStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+			bool message = ((frame.mData1 & ABP_SPI_CTRL_M) != 0);
+
+			if (message)
+			{
+				/* Add in the timestamp, packet ID */
+				AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, trigger_sample, sample_rate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
+				csv_head.append("\n").append(MOSI_STR).append(CSV_DELIMITER).append(timeStr).append(CSV_DELIMITER);
+				AppendUnsigned(csv_head, packet_id);
+				add_entry = true;
+			}
+
+			if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
+			{
+				mosi_event = ErrorEvent::RetransmitWarning;
+				miso_event = ErrorEvent::RetransmitWarning;
+			}
+
+			csv_tail.append(CSV_DELIMITER);
+
+			if (message)
+			{
+				if (frame.mData1 & ABP_SPI_CTRL_LAST_FRAG)
+				{
+					if (fragmentation)
+					{
+						csv_tail.append(LAST_FRAG_STR);
+						fragmentation = false;
+					}
+				}
+				else
+				{
+					if (!fragmentation)
+					{
+						fragmentation = true;
+						csv_tail.append(FIRST_FRAG_STR);
+					}
+					else
+					{
+						csv_tail.append(FRAGMENT_STR);
+					}
+				}
+			}
+
+			break;
+		}
+
+		case AbccMosiStates::ApplicationStatus:
+		{
+			char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+
+			app_stat_reached = true;
+			GetApplStsString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
+			csv_body.append(CSV_DELIMITER).append(dataStr);
+
+			break;
+		}
+
+		case AbccMosiStates::MessageField_Size:
+		case AbccMosiStates::MessageField_SourceId:
+		case AbccMosiStates::MessageField_Object:
+		case AbccMosiStates::MessageField_Instance:
+		case AbccMosiStates::MessageField_Command:
+		case AbccMosiStates::MessageField_CommandExtension:
+		case AbccMosiStates::MessageField_Data:
+		case AbccMosiStates::MessageField:
+			BufferCsvMessageMsgEntry(
+				frame,
+				csv_tail,
+				align_msg_fields,
+				display_base);
+
+			break;
+
+		case AbccMosiStates::Crc32:
+		{
+			if ((U32)frame.mData1 != (U32)frame.mData2)
+			{
+				mosi_event = ErrorEvent::CrcError;
+			}
+
+			break;
+		}
+
+		default:
+			break;
+	}
+}
+
+void SpiAnalyzerExport::AddMessageDataEntries(U64 packet_id, const Frame* frames, U64 frame_count)
+{
+	ErrorEvent mosiEvent = ErrorEvent::None;
+	ErrorEvent misoEvent = ErrorEvent::None;
+	bool mosiAppStatReached = false;
+	bool misoAnbStatReached = false;
+	bool alignMosiMsgFields = true;
+	bool alignMisoMsgFields = true;
+	bool addMosiEntry = false;
+	bool addMisoEntry = false;
+
+	/* Iterate through packet and extract message header and data
+	** stream is written only on receipt of "last fragment". */
+	for (U64 i = 0; i < frame_count; i++)
+	{
+		Frame frame = frames[i];
+
+		if (IS_MOSI_FRAME(frame))
+		{
+			BufferCsvMessageMosiEntry(
+				mSampleRate,
+				mTriggerSample,
+				packet_id,
+				frame,
+				mMosiHead,
+				mSharedBody,
+				mMosiTail,
+				mosiEvent,
+				misoEvent,
+				mMosiFragmentation,
+				mosiAppStatReached,
+				alignMosiMsgFields,
+				addMosiEntry,
+				mDisplayBase);
+		}
+		else
+		{
+			BufferCsvMessageMisoEntry(
+				mSampleRate,
+				mTriggerSample,
+				packet_id,
+				frame,
+				mMisoHead,
+				mSharedBody,
+				mMisoTail,
+				mosiEvent,
+				misoEvent,
+				mMisoFragmentation,
+				misoAnbStatReached,
+				alignMisoMsgFields,
+				addMisoEntry,
+				mDisplayBase);
+		}
+	}
+
+	if ((mosiEvent == ErrorEvent::SpiFragmentationError) ||
+		(misoEvent == ErrorEvent::SpiFragmentationError))
+	{
+		mMosiFragmentation = mMosiPreviousFragState;
+		mMisoFragmentation = mMisoPreviousFragState;
+
+		/* Determine if additional tabs need to be added to get correct alignment in CSV */
+		if (!mosiAppStatReached)
+		{
+			mSharedBody.append(CSV_DELIMITER);
+		}
+
+		if (!misoAnbStatReached)
+		{
+			mSharedBody.append(CSV_DELIMITER);
+		}
+	}
+
+	if (addMosiEntry)
+	{
+		if (mosiEvent == ErrorEvent::None)
+		{
+			mMosiPreviousFragState = mMosiFragmentation;
+			mosiEvent = GetTransactionEvent(SpiChannel::MOSI, packet_id);
+		}
+
+		AppendCsvMessageEntry(mMosiHead, mSharedBody, mMosiTail, mosiEvent);
+	}
+
+	if (addMisoEntry)
+	{
+		if (misoEvent == ErrorEvent::None)
+		{
+			mMisoPreviousFragState = mMisoFragmentation;
+			misoEvent = GetTransactionEvent(SpiChannel::MISO, packet_id);
+		}
+
+		AppendCsvMessageEntry(mMisoHead, mSharedBody, mMisoTail, misoEvent);
+	}
+
+	ClearEntryBuffers();
+}
+
+ErrorEvent SpiAnalyzerExport::GetTransactionEvent(SpiChannel_t channel, U64 packet_id)
+{
+	U8 channelFlag = (channel == SpiChannel::MOSI) ? ABCC_MESSAGE_MOSI_FLAG : 0;
+	AbccMessage_t message;
+
+	if ((mMessages == nullptr) || (mTransactions == nullptr))
+	{
+		return ErrorEvent::None;
+	}
+
+	/* The messages are ordered by their last frame, so by the packet that
+	** completed them, and the packets are exported in capture order. The
+	** messages of exported packets may have been discarded. */
+	mMessageIndex = std::max(mMessageIndex, mMessages->GetFirstMessageIndex());
+
+	while (mMessages->GetMessage(mMessageIndex, &message) && (message.lLastPacketId < packet_id))
+	{
+		mMessageIndex++;
+	}
+
+	for (U64 i = mMessageIndex; mMessages->GetMessage(i, &message) && (message.lLastPacketId == packet_id); i++)
+	{
+		AbccTransaction_t transaction;
+
+		if ((message.bFlags & ABCC_MESSAGE_MOSI_FLAG) != channelFlag)
+		{
+			continue;
+		}
+
+		if (!mTransactions->GetTransaction(mTransactions->GetMessageTransaction(i), &transaction))
+		{
+			break;
+		}
+
+		if (transaction.lResponseMessage == i)
+		{
+			if (transaction.bFlags & ABCC_TRANSACTION_ORPHANED_FLAG)
+			{
+				return ErrorEvent::OrphanedResponse;
+			}
+			else if (transaction.bFlags & ABCC_TRANSACTION_DUPLICATED_FLAG)
+			{
+				return ErrorEvent::DuplicatedResponse;
+			}
+			else if (transaction.bFlags & ABCC_TRANSACTION_MISMATCH_FLAG)
+			{
+				return ErrorEvent::MismatchedResponse;
+			}
+		}
+		else if (transaction.bFlags & ABCC_TRANSACTION_REUSED_SOURCE_ID_FLAG)
+		{
+			return ErrorEvent::ReusedSourceId;
+		}
+
+		break;
+	}
+
+	return ErrorEvent::None;
+}
+
+void SpiAnalyzerExport::AddProcessDataEntries(U64 packet_id, const Frame* frames, U64 frame_count)
+{
+	char timeStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+	char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE] = "";
+	bool addMosiEntry = false;
+	bool addMisoEntry = false;
+	ErrorEvent mosiEvent = ErrorEvent::None;
+	ErrorEvent misoEvent = ErrorEvent::None;
+	bool mosiAppStatReached = false;
+	bool misoAnbStatReached = false;
+	bool mosiImageChanged = false;
+	bool misoImageChanged = false;
+
+	/* Iterate through packet and extract message header and data
+	** stream is written only on receipt of "last fragment". */
+	for (U64 i = 0; i < frame_count; i++)
+	{
+		Frame frame = frames[i];
+
+		if (IS_MOSI_FRAME(frame))
+		{
+			switch (frame.mType)
+			{
+			case AbccSpiError::Fragmentation:
+				mosiEvent = ErrorEvent::SpiFragmentationError;
+				break;
+			case AbccMosiStates::ProcessDataLength:
+				if (mAddCsvHeader)
+				{
+					U32 dwBytes = ((U16)frame.mData1) << 1;
+					/* Add header fields */
+					mWriter.Write("Channel" + CSV_DELIMITER +
+								  "Time [s]" + CSV_DELIMITER +
+								  "Packet ID" + CSV_DELIMITER +
+								  "Error Event" + CSV_DELIMITER +
+								  "Anybus State" + CSV_DELIMITER +
+								  "Application State" + CSV_DELIMITER +
+								  "Network Time");
+
+					for (U16 cnt = 0; cnt < dwBytes; cnt++)
+					{
+						mWriter.Write(CSV_DELIMITER);
+						mWriter.Write("Process Data ");
+						mWriter.WriteUnsigned(cnt);
+					}
+
+					mAddCsvHeader = false;
+				}
+
+				if (mProcessDataChangesOnly)
+				{
+					/* The image size follows the process data length */
+					mMosiImage.resize(((U16)frame.mData1) << 1);
+					mMisoImage.resize(((U16)frame.mData1) << 1);
+				}
+
+				break;
+			case AbccMosiStates::SpiControl:
+			{
+				if (frame.mData1 & ABP_SPI_CTRL_WRPD_VALID)
+				{
+					/* Add in the timestamp, packet ID */
+					AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, mTriggerSample, mSampleRate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
+					mMosiHead.append("\n").append(MOSI_STR).append(CSV_DELIMITER).append(timeStr).append(CSV_DELIMITER);
+					AppendUnsigned(mMosiHead, packet_id);
+					addMosiEntry = true;
+				}
+
+				break;
+			}
+			case AbccMosiStates::ApplicationStatus:
+			{
+				mosiAppStatReached = true;
+				GetApplStsString((U8)frame.mData1, dataStr, sizeof(dataStr), mDisplayBase);
+				mSharedBody.append(CSV_DELIMITER).append(dataStr);
+				break;
+			}
+			case AbccMosiStates::WriteProcessData:
+			{
+				/* With changes only, the row holds the rebuilt image (see below) */
+				std::string& text = mProcessDataChangesOnly ? mMosiFrameText : mMosiTail;
+
+				if (mProcessDataChangesOnly)
+				{
+					UpdateImage(mMosiImage, frame);
+					mosiImageChanged = true;
+				}
+
+				if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+				{
+					text.append(CSV_DELIMITER);
+					AppendFrameBytes(text, frame, CSV_DELIMITER.c_str());
+				}
+				else
+				{
+					text.append(CSV_DELIMITER);
+					AppendNumberString(text, frame.mData1, GET_MOSI_FRAME_BITSIZE(frame.mType));
+				}
+
+				break;
+			}
+			case AbccMosiStates::Crc32:
+			{
+				if ((U32)frame.mData1 != (U32)frame.mData2)
+				{
+					mosiEvent = ErrorEvent::CrcError;
+				}
+
+				break;
+			}
+			default:
+				break;
+			}
+		}
+		else
+		{
+			/* MISO Frame */
+			switch (frame.mType)
+			{
+			case AbccSpiError::Fragmentation:
+				misoEvent = ErrorEvent::SpiFragmentationError;
+				break;
+			case AbccMisoStates::AnybusStatus:
+			{
+				misoAnbStatReached = true;
+				GetAbccStatusString((U8)frame.mData1, dataStr, sizeof(dataStr), mDisplayBase);
+				mSharedBody.append(CSV_DELIMITER).append(dataStr);
+				break;
+			}
+			case AbccMisoStates::SpiStatus:
+			{
+				if (frame.mData1 & ABP_SPI_STATUS_NEW_PD)
+				{
+					/* Add in the timestamp, packet ID */
+					AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, mTriggerSample, mSampleRate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
+					mMisoHead.append("\n").append(MISO_STR).append(CSV_DELIMITER).append(timeStr).append(CSV_DELIMITER);
+					AppendUnsigned(mMisoHead, packet_id);
+					addMisoEntry = true;
+				}
+
+				break;
+			}
+			case AbccMisoStates::NetworkTime:
+			{
+				/* Append network time stamp to both string streams */
+				GetNumberString(frame.mData1, DisplayBase::Decimal, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
+				mMisoTail.append(CSV_DELIMITER).append(dataStr);
+				mMosiTail.append(CSV_DELIMITER).append(dataStr);
+				break;
+			}
+			case AbccMisoStates::ReadProcessData:
+			{
+				std::string& text = mProcessDataChangesOnly ? mMisoFrameText : mMisoTail;
+
+				if (mProcessDataChangesOnly)
+				{
+					UpdateImage(mMisoImage, frame);
+					misoImageChanged = true;
+				}
+
+				if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+				{
+					text.append(CSV_DELIMITER);
+					AppendFrameBytes(text, frame, CSV_DELIMITER.c_str());
+				}
+				else
+				{
+					text.append(CSV_DELIMITER);
+					AppendNumberString(text, frame.mData1, GET_MISO_FRAME_BITSIZE(frame.mType));
+				}
+
+				break;
+			}
+			case AbccMisoStates::Crc32:
+			{
+				if ((U32)frame.mData1 != (U32)frame.mData2)
+				{
+					misoEvent = ErrorEvent::CrcError;
+					mosiEvent = ErrorEvent::CrcError;
+				}
+
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
+	if ((mosiEvent == ErrorEvent::SpiFragmentationError) ||
+		(misoEvent == ErrorEvent::SpiFragmentationError))
+	{
+		/* Determine if additional tabs need to be added to get correct alignment in CSV */
+		if (!mosiAppStatReached)
+		{
+			mSharedBody.append(CSV_DELIMITER);
+		}
+
+		if (!misoAnbStatReached)
+		{
+			mSharedBody.append(CSV_DELIMITER);
+		}
+	}
+
+	if (mProcessDataChangesOnly)
+	{
+		/* Rows are written for changed images and errors. The image of a
+		** fragmented packet is incomplete, its bytes are written as received. */
+		if (mosiEvent == ErrorEvent::SpiFragmentationError)
+		{
+			mMosiTail.append(mMosiFrameText);
+		}
+		else
+		{
+			addMosiEntry = addMosiEntry && (mosiImageChanged || (mosiEvent != ErrorEvent::None));
+			AppendImageBytes(mMosiTail, mMosiImage);
+		}
+
+		if (misoEvent == ErrorEvent::SpiFragmentationError)
+		{
+			mMisoTail.append(mMisoFrameText);
+		}
+		else
+		{
+			addMisoEntry = addMisoEntry && (misoImageChanged || (misoEvent != ErrorEvent::None));
+			AppendImageBytes(mMisoTail, mMisoImage);
+		}
+	}
+
+	if (addMosiEntry)
+	{
+		AppendCsvMessageEntry(mMosiHead, mSharedBody, mMosiTail, mosiEvent);
+	}
+
+	if (addMisoEntry)
+	{
+		AppendCsvMessageEntry(mMisoHead, mSharedBody, mMisoTail, misoEvent);
+	}
+
+	ClearEntryBuffers();
+}
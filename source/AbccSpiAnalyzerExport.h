@@ -0,0 +1,212 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccSpiAnalyzerExport.h
+**    Summary: Streams decoded frames, one packet at a time, into the exported
+**             CSV files. Shared by the plugin and the offline decoder.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_SPI_ANALYZER_EXPORT_H
+#define ABCC_SPI_ANALYZER_EXPORT_H
+
+#include <string>
+#include <vector>
+
+#include "AnalyzerResults.h"
+#include "AbccByteArena.h"
+#include "AbccExportWriter.h"
+#include "AbccJitterAnalyzer.h"
+#include "AbccLatencyStatistics.h"
+#include "AbccTransactionIndex.h"
+#include "AbccSpiAnalyzerTypes.h"
+#include "AbccSpiAnalyzerResults.h"
+#include "AbccSpiAnalyzerSettings.h"
+
+/*
+** @brief Writes one of the export file types. Frames are passed in capture
+**        order, grouped by the packet containing them, so only the frames of
+**        a single packet need to be held in memory at any time.
+*/
+class SpiAnalyzerExport
+{
+public:
+
+	SpiAnalyzerExport(ExportType export_type, DisplayBase display_base, const std::string& delimiter, U32 network_type, U32 sample_rate, U64 trigger_sample);
+	~SpiAnalyzerExport();
+
+	/*******************************************************************************
+	** @brief Create the export file and write the header row (if known upfront).
+	**
+	** @param file - Path of the file to create.
+	*/
+	void Start(const char* file);
+
+	/*******************************************************************************
+	** @brief Set the arena holding the bytes of aggregated frames.
+	**
+	** @param frame_data - The arena, must outlive the export.
+	*/
+	void SetFrameData(const AbccByteArena* frame_data);
+
+	/*******************************************************************************
+	** @brief Set the parameters of the network time jitter export.
+	**
+	** @param filter - The packets whose network timestamps are analyzed.
+	** @param nominal_cycle_ns - The nominal network cycle, 0 to estimate it.
+	** @param threshold_ns - The outlier threshold, 0 for the default.
+	*/
+	void SetJitterOptions(TimestampIndexing filter, U32 nominal_cycle_ns, U32 threshold_ns);
+
+	/*******************************************************************************
+	** @brief Set whether the frames only hold the changed process data (see
+	**        AbccProcessDataFilter). The process data export then rebuilds
+	**        each image and only writes a row for the images that changed.
+	*/
+	void SetProcessDataChangesOnly(bool changes_only);
+
+	/*******************************************************************************
+	** @brief Set the messages and transactions of the capture. The message data
+	**        export then reports the transaction flags of each message as an
+	**        error event, on the row of the packet that completed the message.
+	**
+	** @param messages - The message table, must outlive the export.
+	** @param transactions - The transactions of the messages, must outlive
+	**                       the export. Both are read as the packets are added,
+	**                       so may still be growing, and the messages of the
+	**                       packets already added may be discarded.
+	*/
+	void SetTransactions(const AbccMessageTable* messages, const AbccTransactionIndex* transactions);
+
+	/*******************************************************************************
+	** @brief Write the export entries of one packet.
+	**
+	** @param packet_id - The ID of the packet, INVALID_RESULT_INDEX for frames
+	**                    not contained in a packet.
+	** @param frames - The frames of the packet.
+	** @param frame_count - The number of frames.
+	*/
+	void AddPacket(U64 packet_id, const Frame* frames, U64 frame_count);
+
+	/*******************************************************************************
+	** @brief Add a transaction to the latency statistics. Only used by the
+	**        latency export, which writes its rows when the export ends.
+	**
+	** @param transaction - The transaction, as correlated by AbccTransactionIndex.
+	*/
+	void AddTransaction(const AbccTransaction_t& transaction);
+
+	/*******************************************************************************
+	** @brief Close the export file.
+	*/
+	void End();
+
+protected: /* Members */
+
+	ExportType mExportType;
+	DisplayBase mDisplayBase;
+	std::string mDelimiter;
+	U32 mNetworkType;
+	U32 mSampleRate;
+	U64 mTriggerSample;
+	AbccExportWriter mWriter;
+	const AbccByteArena* mFrameData;
+	std::vector<U8> mFrameBytes;
+	std::vector<std::string> mByteText;			// Of each byte value, in the display base
+	std::vector<std::string> mFrameByteText;	// As above, formatted as the frames export does
+	AbccLatencyStatistics mLatency;
+	AbccJitterAnalyzer mJitter;
+	TimestampIndexing mJitterFilter;
+	bool mProcessDataChangesOnly;
+	std::vector<U8> mMosiImage;
+	std::vector<U8> mMisoImage;
+	const AbccMessageTable* mMessages;
+	const AbccTransactionIndex* mTransactions;
+	U64 mMessageIndex;							// The first message not completed by an exported packet
+
+	/* State carried between packets */
+	bool mMosiFragmentation;
+	bool mMisoFragmentation;
+	bool mMosiPreviousFragState;
+	bool mMisoPreviousFragState;
+	bool mAddCsvHeader;
+
+	/* Text of the current entries, reused between packets */
+	std::string mMosiHead;
+	std::string mMisoHead;
+	std::string mMosiTail;
+	std::string mMisoTail;
+	std::string mSharedBody;
+	std::string mMosiFrameText;
+	std::string mMisoFrameText;
+	std::string mFrameText;
+
+protected: /* Methods */
+
+	void AddFrameEntries(U64 packet_id, const Frame* frames, U64 frame_count);
+	void AddMessageDataEntries(U64 packet_id, const Frame* frames, U64 frame_count);
+	void AddProcessDataEntries(U64 packet_id, const Frame* frames, U64 frame_count);
+	ErrorEvent GetTransactionEvent(SpiChannel_t channel, U64 packet_id);
+	void WriteLatencyEntries();
+	void AddJitterEntries(U64 packet_id, const Frame* frames, U64 frame_count);
+	void WriteJitterEntries();
+	void WriteJitterSummary();
+	void ClearEntryBuffers();
+	const std::vector<U8>& GetFrameBytes(const Frame& frame);
+	void AppendNumberString(std::string& csv_data, U64 number, U32 num_data_bits);
+	void AppendFrameBytes(std::string& csv_data, const Frame& frame, const char* separator);
+	void UpdateImage(std::vector<U8>& image, const Frame& frame);
+	void AppendImageBytes(std::string& csv_data, const std::vector<U8>& image);
+
+	void BufferCsvMessageMsgEntry(
+		Frame& frame,
+		std::string& csv_data,
+		bool& align_msg_fields,
+		DisplayBase display_base);
+
+	void BufferCsvMessageDataRun(
+		Frame& frame,
+		std::string& csv_data,
+		bool& align_msg_fields,
+		DisplayBase display_base);
+
+	void BufferCsvMessageMisoEntry(
+		U32 sample_rate,
+		U64 trigger_sample,
+		U64 packet_id,
+		Frame& frame,
+		std::string& csv_head,
+		std::string& csv_body,
+		std::string& csv_tail,
+		ErrorEvent& mosi_event,
+		ErrorEvent& miso_event,
+		bool& fragmentation,
+		bool& anb_stat_reached,
+		bool& align_msg_fields,
+		bool& add_entry,
+		DisplayBase display_base);
+
+	void BufferCsvMessageMosiEntry(
+		U32 sample_rate,
+		U64 trigger_sample,
+		U64 packet_id,
+		Frame &frame,
+		std::string& csv_head,
+		std::string& csv_body,
+		std::string& csv_tail,
+		ErrorEvent &mosi_event,
+		ErrorEvent &miso_event,
+		bool &fragmentation,
+		bool &app_stat_reached,
+		bool &align_msg_fields,
+		bool &add_entry,
+		DisplayBase display_base );
+
+	void AppendCsvHeaderDelimeters(std::string& csv_data, U8 count, bool& add_header_delims);
+	void AppendCsvMessageEntry(std::string& csv_head, const std::string& csv_body, const std::string& csv_tail, ErrorEvent event);
+	void AppendCsvSafeString(std::string& csv_data, char* input_data_str, DisplayBase display_base);
+};
+
+#endif /* ABCC_SPI_ANALYZER_EXPORT_H */
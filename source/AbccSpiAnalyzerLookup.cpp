@@ -68,18 +68,6 @@
 
 #define NUM_ENTRIES(lut)				( sizeof(lut) / sizeof(LookupTable_t) )
 
-#define ABCC_MSG_SIZE_FIELD_SIZE		2
-#define ABCC_MSG_RES1_FIELD_SIZE		2
-#define ABCC_MSG_SRC_ID_FIELD_SIZE		1
-#define ABCC_MSG_OBJ_FIELD_SIZE			1
-#define ABCC_MSG_INST_FIELD_SIZE		2
-#define ABCC_MSG_CMD_FIELD_SIZE			1
-#define ABCC_MSG_RES2_FIELD_SIZE		1
-#define ABCC_MSG_CMDEXT_FIELD_SIZE		2
-#define ABCC_MSG_CMDEXT0_FIELD_SIZE		1
-#define ABCC_MSG_CMDEXT1_FIELD_SIZE		1
-#define ABCC_MSG_DATA_FIELD_SIZE		1
-
 typedef struct AttributeNameTable
 {
 	const U8 object_num;
@@ -120,82 +108,13 @@ typedef struct ExceptionNameTable
 } ExceptionNameTable_t;
 
 
-/*******************************************************************************
-**
-** Protocol state lookup tables
-**
-*******************************************************************************/
-
-const AbccMosiInfo_t asMosiStates[] =
-{
-	{ AbccMosiStates::Idle,								"",			0 },
-	{ AbccMosiStates::SpiControl,						"SPI_CTL",	1 },
-	{ AbccMosiStates::Reserved1,						"RES",		1 },
-	{ AbccMosiStates::MessageLength,					"MSG_LEN",	2 },
-	{ AbccMosiStates::ProcessDataLength,				"PD_LEN",	2 },
-	{ AbccMosiStates::ApplicationStatus,				"APP_STS",	1 },
-	{ AbccMosiStates::InterruptMask,					"INT_MSK",	1 },
-	{ AbccMosiStates::MessageField,						"MD",		ABCC_MSG_DATA_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Size,				"MSG_SIZE",	ABCC_MSG_SIZE_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Reserved1,			"RES",		ABCC_MSG_RES1_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_SourceId,			"SRC_ID",	ABCC_MSG_SRC_ID_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Object,				"OBJ",		ABCC_MSG_OBJ_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Instance,			"INST",		ABCC_MSG_INST_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Command,				"CMD",		ABCC_MSG_CMD_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Reserved2,			"RES",		ABCC_MSG_RES2_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_CommandExtension,	"EXT",		ABCC_MSG_CMDEXT_FIELD_SIZE },
-	{ AbccMosiStates::MessageField_Data,				"MD",		ABCC_MSG_DATA_FIELD_SIZE },
-	{ AbccMosiStates::WriteProcessData,					"PD",		1 },
-	{ AbccMosiStates::Crc32,							"CRC32",	4 },
-	{ AbccMosiStates::Pad,								"PAD",		2 },
-	{ AbccMosiStates::MessageField_DataNotValid, 		"--",		1 }
-};
-
-const AbccMisoInfo_t asMisoStates[] =
-{
-	{ AbccMisoStates::Idle,								"",			0 },
-	{ AbccMisoStates::Reserved1,						"RES",		1 },
-	{ AbccMisoStates::Reserved2,						"RES",		1 },
-	{ AbccMisoStates::LedStatus,						"LED_STS",	2 },
-	{ AbccMisoStates::AnybusStatus,						"ANB_STS",	1 },
-	{ AbccMisoStates::SpiStatus,						"SPI_STS",	1 },
-	{ AbccMisoStates::NetworkTime,						"TIME",		4 },
-	{ AbccMisoStates::MessageField,						"MD",		ABCC_MSG_DATA_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Size,				"MD_SIZE",	ABCC_MSG_SIZE_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Reserved1,			"RES",		ABCC_MSG_RES1_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_SourceId,			"SRC_ID",	ABCC_MSG_SRC_ID_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Object,				"OBJ",		ABCC_MSG_OBJ_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Instance,			"INST",		ABCC_MSG_INST_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Command,				"CMD",		ABCC_MSG_CMD_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Reserved2,			"RES",		ABCC_MSG_RES2_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_CommandExtension,	"EXT",		ABCC_MSG_CMDEXT_FIELD_SIZE },
-	{ AbccMisoStates::MessageField_Data,				"MD",		ABCC_MSG_DATA_FIELD_SIZE },
-	{ AbccMisoStates::ReadProcessData,					"PD",		1 },
-	{ AbccMisoStates::Crc32,							"CRC32",	4 },
-	{ AbccMisoStates::MessageField_DataNotValid, 		"--",		1 }
-
-};
-
-const AbccMsgInfo_t asMsgStates[] =
-{
-	{ AbccMsgField::Size,				"MD_SIZE",	ABCC_MSG_SIZE_FIELD_SIZE },
-	{ AbccMsgField::Reserved1,			"RES",		ABCC_MSG_RES1_FIELD_SIZE },
-	{ AbccMsgField::SourceId,			"SRC_ID",	ABCC_MSG_SRC_ID_FIELD_SIZE },
-	{ AbccMsgField::Object,				"OBJ",		ABCC_MSG_OBJ_FIELD_SIZE },
-	{ AbccMsgField::Instance,			"INST",		ABCC_MSG_INST_FIELD_SIZE },
-	{ AbccMsgField::Command,			"CMD",		ABCC_MSG_CMD_FIELD_SIZE },
-	{ AbccMsgField::Reserved2,			"RES",		ABCC_MSG_RES2_FIELD_SIZE },
-	{ AbccMsgField::CommandExtension,	"EXT",		ABCC_MSG_CMDEXT_FIELD_SIZE },
-	{ AbccMsgField::Data,				"MD",		ABCC_MSG_DATA_FIELD_SIZE }
-};
-
 /*******************************************************************************
 **
 ** Basic SPI field enumeration lookup tables
 **
 *******************************************************************************/
 
-static const LookupTable_t asAnybusStsNames[] =
+static constexpr LookupTable_t asAnybusStsNames[] =
 {
 	{ ABP_ANB_STATE_SETUP,			"SETUP",			NotifEvent::None },
 	{ ABP_ANB_STATE_NW_INIT,		"NW_INIT",			NotifEvent::None },
@@ -206,7 +125,7 @@ static const LookupTable_t asAnybusStsNames[] =
 	{ ABP_ANB_STATE_EXCEPTION,		"EXCEPTION",		NotifEvent::Alert }
 };
 
-static const LookupTable_t asApplStsNames[] =
+static constexpr LookupTable_t asApplStsNames[] =
 {
 	{ ABP_APPSTAT_NO_ERROR,			"No Error",									NotifEvent::None },
 	{ ABP_APPSTAT_NOT_SYNCED,		"Not yet synchronized",						NotifEvent::None },
@@ -219,7 +138,7 @@ static const LookupTable_t asApplStsNames[] =
 	{ ABP_APPSTAT_GENERAL_SYNC_ERR,	"General sync error",						NotifEvent::Alert }
 };
 
-static const LookupTable_t asSpiStsNames[] =
+static constexpr LookupTable_t asSpiStsNames[] =
 {
 	{ 0xC0,							"RESERVED",		NotifEvent::Alert }, // No ABP mask exists
 	{ ABP_SPI_STATUS_NEW_PD,		"NEW_PD",		NotifEvent::None },
@@ -229,7 +148,7 @@ static const LookupTable_t asSpiStsNames[] =
 	{ ABP_SPI_STATUS_WRMSG_FULL,	"WRMSG_FULL",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asSpiCtrlNames[] =
+static constexpr LookupTable_t asSpiCtrlNames[] =
 {
 	{ ABP_SPI_CTRL_T,			"TOGGLE",		NotifEvent::None },
 	{ 0x60,						"RESERVED",		NotifEvent::Alert }, // No ABP mask exists
@@ -239,7 +158,7 @@ static const LookupTable_t asSpiCtrlNames[] =
 	{ ABP_SPI_CTRL_WRPD_VALID,	"WRPD_VALID",	NotifEvent::None }
 };
 
-static const LookupTable_t asIntMaskNames[] =
+static constexpr LookupTable_t asIntMaskNames[] =
 {
 	{ ABP_INTMASK_RDPDIEN,		"RDPD",		NotifEvent::None },
 	{ ABP_INTMASK_RDMSGIEN,		"RDMSG",	NotifEvent::None },
@@ -251,7 +170,7 @@ static const LookupTable_t asIntMaskNames[] =
 	{ 0x80,						"RESERVED",	NotifEvent::Alert }  // No ABP mask exists
 };
 
-static const LookupTable_t asLedStsNames[] =
+static constexpr LookupTable_t asLedStsNames[] =
 {
 	{ 0x0001, "LED1A",		NotifEvent::None },
 	{ 0x0002, "LED1B",		NotifEvent::None },
@@ -274,7 +193,7 @@ static const LookupTable_t asLedStsNames[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asObjectNames[] =
+static constexpr LookupTable_t asObjectNames[] =
 {
 	/*--------------------------------------------------------------------------
 	** Anybus module objects
@@ -375,7 +294,7 @@ const U8 abNetworkTypeValue[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asBipNcInstNames[] =
+static constexpr LookupTable_t asBipNcInstNames[] =
 {
 	{ 3,	"IP Address",											NotifEvent::None },
 	{ 4,	"Subnet Mask",											NotifEvent::None },
@@ -402,13 +321,13 @@ static const LookupTable_t asBipNcInstNames[] =
 	{ 25,	"Foreign Device Registration Time to Live Value",		NotifEvent::None },
 };
 
-static const LookupTable_t asCclNcInstNames[] =
+static constexpr LookupTable_t asCclNcInstNames[] =
 {
 	{ 1,	"Station Number",						NotifEvent::None },
 	{ 3,	"Network Number",						NotifEvent::None }
 };
 
-static const LookupTable_t asCetNcInstNames[] =
+static constexpr LookupTable_t asCetNcInstNames[] =
 {
 	{ 3,	"IP Address",							NotifEvent::None },
 	{ 4,	"Subnet Mask",							NotifEvent::None },
@@ -429,20 +348,20 @@ static const LookupTable_t asCetNcInstNames[] =
 	{ 19,	"Reserved",								NotifEvent::None },
 };
 
-static const LookupTable_t asCopNcInstNames[] =
+static constexpr LookupTable_t asCopNcInstNames[] =
 {
 	{ 1,	"Device Address",	NotifEvent::None },
 	{ 2,	"Baud Rate",		NotifEvent::None },
 };
 
-static const LookupTable_t asDevNcInstNames[] =
+static constexpr LookupTable_t asDevNcInstNames[] =
 {
 	{ 1,	"Node Address",						NotifEvent::None },
 	{ 2,	"Baud Rate",						NotifEvent::None },
 	{ 3,	"QuickConnect",						NotifEvent::None }
 };
 
-static const LookupTable_t asEctNcInstNames[] =
+static constexpr LookupTable_t asEctNcInstNames[] =
 {
 	{ 1,	"Device ID",							NotifEvent::None },
 	{ 3,	"IP Address",							NotifEvent::None },
@@ -458,7 +377,7 @@ static const LookupTable_t asEctNcInstNames[] =
 	{ 15,	"SMTP Password",						NotifEvent::None }
 };
 
-static const LookupTable_t asEipNcInstNames[] =
+static constexpr LookupTable_t asEipNcInstNames[] =
 {
 	{ 3,	"IP Address",							NotifEvent::None },
 	{ 4,	"Subnet Mask",							NotifEvent::None },
@@ -480,12 +399,12 @@ static const LookupTable_t asEipNcInstNames[] =
 	{ 20,	"QuickConnect",							NotifEvent::None }
 };
 
-static const LookupTable_t asEplNcInstNames[] =
+static constexpr LookupTable_t asEplNcInstNames[] =
 {
 	{ 1,	"Node ID",	NotifEvent::None }
 };
 
-static const LookupTable_t asEtnNcInstNames[] =
+static constexpr LookupTable_t asEtnNcInstNames[] =
 {
 	{ 3,	"IP Address",							NotifEvent::None },
 	{ 4,	"Subnet Mask",							NotifEvent::None },
@@ -509,7 +428,7 @@ static const LookupTable_t asEtnNcInstNames[] =
 	{ 22,	"Word Order",							NotifEvent::None }
 };
 
-static const LookupTable_t asPirNcInstNames[] =
+static constexpr LookupTable_t asPirNcInstNames[] =
 {
 	{ 3,	"IP Address",							NotifEvent::None },
 	{ 4,	"Subnet Mask",							NotifEvent::None },
@@ -564,7 +483,7 @@ NcInstNameTable_t asNcInstNameTables[] =
 **
 *******************************************************************************/
 
-static const AttrLookupTable_t asObjAttrNames[] =
+static constexpr AttrLookupTable_t asObjAttrNames[] =
 {
 	{ ABP_OA_NAME,			"Name",						BaseType::Character,	NotifEvent::None },
 	{ ABP_OA_REV,			"Revision",					BaseType::Numeric,		NotifEvent::None },
@@ -578,14 +497,14 @@ static const AttrLookupTable_t asObjAttrNames[] =
 **
 *******************************************************************************/
 
-static const AttrLookupTable_t asAddObjAttrNames[] =
+static constexpr AttrLookupTable_t asAddObjAttrNames[] =
 {
 	{ ABP_ADD_OA_MAX_INST,			"Max Instance",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ADD_OA_EXT_DIAG_OVERFLOW,	"Ext Diag Overflow",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ADD_OA_STATIC_DIAG,		"Static Diag",			BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asAddInstAttrNames[] =
+static constexpr AttrLookupTable_t asAddInstAttrNames[] =
 {
 	{ ABP_ADD_IA_MODULE_NUMBER,		"Module Number",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ADD_IA_IO_TYPE,			"IO Type",			BaseType::Numeric,	NotifEvent::None },
@@ -594,7 +513,7 @@ static const AttrLookupTable_t asAddInstAttrNames[] =
 	{ ABP_ADD_IA_ERROR_TYPE,		"Error Type",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asAnbInstAttrNames[] =
+static constexpr AttrLookupTable_t asAnbInstAttrNames[] =
 {
 	{ ABP_ANB_IA_MODULE_TYPE,		"Module Type",				BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ANB_IA_FW_VERSION,		"Firmware Version",			BaseType::Numeric,	NotifEvent::None },
@@ -619,7 +538,7 @@ static const AttrLookupTable_t asAnbInstAttrNames[] =
 	{ ABP_ANB_IA_ABIP_LICENSE,		"Anybus IP License",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asAppInstAttrNames[] =
+static constexpr AttrLookupTable_t asAppInstAttrNames[] =
 {
 	{ ABP_APP_IA_CONFIGURED,	"Configured",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_APP_IA_SUP_LANG,		"Supported Languages",				BaseType::Numeric,		NotifEvent::None },
@@ -634,14 +553,14 @@ static const AttrLookupTable_t asAppInstAttrNames[] =
 	{ ABP_APP_IA_HW_VERSION,	"HW Version",						BaseType::Numeric,		NotifEvent::None },
 };
 
-static const AttrLookupTable_t asAppdObjAttrNames[] =
+static constexpr AttrLookupTable_t asAppdObjAttrNames[] =
 {
 	{ ABP_APPD_OA_NR_READ_PD_MAPPABLE_INSTANCES,	"No. of RD PD Mappable Instances",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_APPD_OA_NR_WRITE_PD_MAPPABLE_INSTANCES,	"No. of WR PD Mappable Instances",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_APPD_OA_NR_NV_INSTANCES,					"No. of Non-Volatile Instances",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asAppdInstAttrNames[] =
+static constexpr AttrLookupTable_t asAppdInstAttrNames[] =
 {
 	{ ABP_APPD_IA_NAME,			"Name",						BaseType::Character,	NotifEvent::None },
 	{ ABP_APPD_IA_DATA_TYPE,	"Data Type",				BaseType::Numeric,		NotifEvent::None },
@@ -655,13 +574,13 @@ static const AttrLookupTable_t asAppdInstAttrNames[] =
 	{ ABP_APPD_IA_ELEM_NAME,	"Element Name",				BaseType::Character,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asAsmObjAttrNames[] =
+static constexpr AttrLookupTable_t asAsmObjAttrNames[] =
 {
 	{ ABP_ASM_OA_WRITE_PD_INST_LIST,	"Write PD Instance List",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ASM_OA_READ_PD_INST_LIST,		"Read PD Instance List",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asAsmInstAttrNames[] =
+static constexpr AttrLookupTable_t asAsmInstAttrNames[] =
 {
 	{ ABP_ASM_IA_DESCRIPTOR,		"Assembly Descriptor",			BaseType::Numeric,		NotifEvent::None },
 	{ ABP_ASM_IA_ADI_MAP_XX + 0,	"ADI Map 0",					BaseType::Numeric,		NotifEvent::None },
@@ -679,7 +598,7 @@ static const AttrLookupTable_t asAsmInstAttrNames[] =
 	{ ABP_ASM_IA_MAX_NUM_ADI_MAPS,	"Max Number of ADI Mappings",	BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asBacInstAttrNames[] =
+static constexpr AttrLookupTable_t asBacInstAttrNames[] =
 {
 	{ ABP_BAC_IA_OBJECT_NAME,			"Object Name",				BaseType::Character,	NotifEvent::None },
 	{ ABP_BAC_IA_VENDOR_NAME,			"Vendor Name",				BaseType::Character,	NotifEvent::None },
@@ -692,7 +611,7 @@ static const AttrLookupTable_t asBacInstAttrNames[] =
 	{ ABP_BAC_IA_PASSWORD,				"Password",					BaseType::Character,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCclInstAttrNames[] =
+static constexpr AttrLookupTable_t asCclInstAttrNames[] =
 {
 	{ ABP_CCL_IA_VENDOR_CODE,			"Vendor Code",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_CCL_IA_SOFTWARE_VERSION,		"Software Version",		BaseType::Numeric,	NotifEvent::None },
@@ -702,7 +621,7 @@ static const AttrLookupTable_t asCclInstAttrNames[] =
 	{ ABP_CCL_IA_HOLD_CLEAR_SETTING,	"Hold Clear Setting",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCfnInstAttrNames[] =
+static constexpr AttrLookupTable_t asCfnInstAttrNames[] =
 {
 	{ ABP_CFN_IA_VENDOR_CODE,		"Vendor Code",			BaseType::Numeric,		NotifEvent::None },
 	{ ABP_CFN_IA_VENDOR_NAME,		"Vendor Name",			BaseType::Character,	NotifEvent::None },
@@ -714,7 +633,7 @@ static const AttrLookupTable_t asCfnInstAttrNames[] =
 	{ ABP_CFN_IA_ENA_SLMP_FORWARD,	"Enable SLMP Forward",	BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCipIdInstAttrNames[] =
+static constexpr AttrLookupTable_t asCipIdInstAttrNames[] =
 {
 	{ ABP_CIPID_IA_VENDOR_ID,		"Vendor ID",		BaseType::Numeric,	NotifEvent::None },
 	{ ABP_CIPID_IA_DEVICE_TYPE,		"Device Type",		BaseType::Numeric,	NotifEvent::None },
@@ -725,7 +644,7 @@ static const AttrLookupTable_t asCipIdInstAttrNames[] =
 	{ ABP_CIPID_IA_PRODUCT_NAME,	"Product Name",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCntInstAttrNames[] =
+static constexpr AttrLookupTable_t asCntInstAttrNames[] =
 {
 	{ ABP_CNT_IA_VENDOR_ID,					"Vendor ID",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_CNT_IA_DEVICE_TYPE,				"Device Type",						BaseType::Numeric,		NotifEvent::None },
@@ -740,7 +659,7 @@ static const AttrLookupTable_t asCntInstAttrNames[] =
 	{ ABP_CNT_IA_CONFIG_INSTANCE,			"Configuration Instance",			BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCopInstAttrNames[] =
+static constexpr AttrLookupTable_t asCopInstAttrNames[] =
 {
 	{ ABP_COP_IA_VENDOR_ID,				"Vendor ID",							BaseType::Numeric,		NotifEvent::None },
 	{ ABP_COP_IA_PRODUCT_CODE,			"Product Code",							BaseType::Numeric,		NotifEvent::None },
@@ -755,12 +674,12 @@ static const AttrLookupTable_t asCopInstAttrNames[] =
 	{ ABP_COP_IA_READ_PD_BUF_INIT_VAL,	"Read PD Buffer Init Value",			BaseType::Character,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCpcObjAttrNames[] =
+static constexpr AttrLookupTable_t asCpcObjAttrNames[] =
 {
 	{ ABP_CPC_OA_MAX_INST, "Maximum Number of Instances",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCpcInstAttrNames[] =
+static constexpr AttrLookupTable_t asCpcInstAttrNames[] =
 {
 	{ ABP_CPC_IA_PORT_TYPE,					"Port Type",					BaseType::Numeric,		NotifEvent::None },
 	{ ABP_CPC_IA_PORT_NUMBER,				"Port Number",					BaseType::Numeric,		NotifEvent::None },
@@ -771,7 +690,7 @@ static const AttrLookupTable_t asCpcInstAttrNames[] =
 	{ ABP_CPC_IA_PORT_ROUTING_CAPABILITIES,	"Port Routing Capabilities",	BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asCpnInstAttrNames[] =
+static constexpr AttrLookupTable_t asCpnInstAttrNames[] =
 {
 	{ ABP_CPN_IA_VENDOR_ID,					"Vendor ID",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_CPN_IA_DEVICE_TYPE,				"Device Type",						BaseType::Numeric,		NotifEvent::None },
@@ -786,7 +705,7 @@ static const AttrLookupTable_t asCpnInstAttrNames[] =
 	{ ABP_CPN_IA_BIT_SLAVE,					"Bit Slave",						BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asDevInstAttrNames[] =
+static constexpr AttrLookupTable_t asDevInstAttrNames[] =
 {
 	{ ABP_DEV_IA_VENDOR_ID,					"Vendor ID",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_DEV_IA_DEVICE_TYPE,				"Device Type",						BaseType::Numeric,		NotifEvent::None },
@@ -808,13 +727,13 @@ static const AttrLookupTable_t asDevInstAttrNames[] =
 	{ ABP_DEV_IA_CONS_INSTANCE_LIST,		"Consuming Instance List",			BaseType::Numeric,		NotifEvent::None },
 };
 
-static const AttrLookupTable_t asDiObjAttrNames[] =
+static constexpr AttrLookupTable_t asDiObjAttrNames[] =
 {
 	{ ABP_DI_OA_MAX_INST,		"Maximum Number of Instances",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_DI_OA_SUPPORT_FUNC,	"Supported Functionality",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asDiInstAttrNames[] =
+static constexpr AttrLookupTable_t asDiInstAttrNames[] =
 {
 	{ ABP_DI_IA_SEVERITY,			"Severity",						BaseType::Numeric,	NotifEvent::None },
 	{ ABP_DI_IA_EVENT_CODE,			"Event Code",					BaseType::Numeric,	NotifEvent::None },
@@ -825,7 +744,7 @@ static const AttrLookupTable_t asDiInstAttrNames[] =
 	{ ABP_DI_IA_BIT,				"Bit",							BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asDpv1InstAttrNames[] =
+static constexpr AttrLookupTable_t asDpv1InstAttrNames[] =
 {
 	{ ABP_DPV1_IA_IDENT_NUMBER,			"Identity Number",					BaseType::Numeric,		NotifEvent::None },
 	{ ABP_DPV1_IA_PRM_DATA,				"Parameter Data",					BaseType::Numeric,		NotifEvent::None },
@@ -849,7 +768,7 @@ static const AttrLookupTable_t asDpv1InstAttrNames[] =
 	{ ABP_DPV1_IA_RESERVED,				"Reserved",							BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asEcoObjAttrNames[] =
+static constexpr AttrLookupTable_t asEcoObjAttrNames[] =
 {
 	{ ABP_ECO_OA_CURRENT_ENERGY_SAVING_MODE,		"Current Energy Saving Mode",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ECO_OA_REMAINING_TIME_TO_DEST,			"Remaining Time to Destination",		BaseType::Numeric,	NotifEvent::None },
@@ -857,7 +776,7 @@ static const AttrLookupTable_t asEcoObjAttrNames[] =
 	{ ABP_ECO_OA_TRANSITION_TO_POWER_OFF_SUPPORTED,	"Transition To Power Off Supported",	BaseType::Numeric,	NotifEvent::None },
 };
 
-static const AttrLookupTable_t asEcoInstAttrNames[] =
+static constexpr AttrLookupTable_t asEcoInstAttrNames[] =
 {
 	{ ABP_ECO_IA_MODE_ATTRIBUTES,			"Mode Attributes",					BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ECO_IA_TIME_MIN_PAUSE,			"Time Min Pause",					BaseType::Numeric,	NotifEvent::None },
@@ -872,7 +791,7 @@ static const AttrLookupTable_t asEcoInstAttrNames[] =
 	{ ABP_ECO_IA_POWER_CONSUMPTION,			"Power Consumption",				BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asEipInstAttrNames[] =
+static constexpr AttrLookupTable_t asEipInstAttrNames[] =
 {
 	{ ABP_EIP_IA_VENDOR_ID,						"Vendor ID",										BaseType::Numeric,		NotifEvent::None },
 	{ ABP_EIP_IA_DEVICE_TYPE,					"Device Type",										BaseType::Numeric,		NotifEvent::None },
@@ -907,7 +826,7 @@ static const AttrLookupTable_t asEipInstAttrNames[] =
 	{ ABP_EIP_IA_ABCC_ENABLE_CIP_SYNC,			"ABCC Enable CIP Sync",								BaseType::Numeric,		NotifEvent::None },
 };
 
-static const AttrLookupTable_t asEmeInstAttrNames[] =
+static constexpr AttrLookupTable_t asEmeInstAttrNames[] =
 {
 	{ ABP_EME_IA_VOLTAGE_PHASE_NEUTRAL,			"Voltage Phase Neutral",		BaseType::Numeric,	NotifEvent::None },
 	{ ABP_EME_IA_VOLTAGE_PHASE_NEUTRAL_MIN,		"Voltage Phase Neutral Min",	BaseType::Numeric,	NotifEvent::None },
@@ -942,7 +861,7 @@ static const AttrLookupTable_t asEmeInstAttrNames[] =
 	{ ABP_EME_IA_TOTAL_APPARENT_ENERGY,			"Total Apparent Energy",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asEplInstAttrNames[] =
+static constexpr AttrLookupTable_t asEplInstAttrNames[] =
 {
 	{ ABP_EPL_IA_VENDOR_ID,			"Vendor ID",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_EPL_IA_PRODUCT_CODE,		"Product Code",						BaseType::Numeric,		NotifEvent::None },
@@ -959,7 +878,7 @@ static const AttrLookupTable_t asEplInstAttrNames[] =
 	{ ABP_EPL_APP_SW_DATE_AND_TIME,	"Application SW Date and Time",		BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asErInstAttrNames[] =
+static constexpr AttrLookupTable_t asErInstAttrNames[] =
 {
 	{ ABP_ER_IA_ENERGY_READING,				"Energy Reading",				BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ER_IA_DIRECTION,					"Direction",					BaseType::Numeric,	NotifEvent::None },
@@ -968,7 +887,7 @@ static const AttrLookupTable_t asErInstAttrNames[] =
 	{ ABP_ER_IA_NOMINAL_POWER_CONSUMPTION,	"Nominal Power Consumption",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asEtcInstAttrNames[] =
+static constexpr AttrLookupTable_t asEtcInstAttrNames[] =
 {
 	{ ABP_ECT_IA_VENDOR_ID,				"Vendor ID",								BaseType::Numeric,		NotifEvent::None },
 	{ ABP_ECT_IA_PRODUCT_CODE,			"Product Code",								BaseType::Numeric,		NotifEvent::None },
@@ -1001,7 +920,7 @@ static const AttrLookupTable_t asEtcInstAttrNames[] =
 	{ ABP_ECT_IA_SII_COE_DETAILS,		"SII CoE Details",							BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asEtnInstAttrNames[] =
+static constexpr AttrLookupTable_t asEtnInstAttrNames[] =
 {
 	{ ABP_ETN_IA_MAC_ADDRESS,					"MAC Address",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_ETN_IA_ENABLE_HICP,					"Enable HICP",						BaseType::Numeric,		NotifEvent::None },
@@ -1029,7 +948,7 @@ static const AttrLookupTable_t asEtnInstAttrNames[] =
 	{ ABP_ETN_IA_ENABLE_WEBDAV,					"Enable WebDAV",					BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asFsiObjAttrNames[] =
+static constexpr AttrLookupTable_t asFsiObjAttrNames[] =
 {
 	{ ABP_FSI_OA_MAX_INST,						"Max Number of Instances",		BaseType::Numeric,	NotifEvent::None },
 	{ ABP_FSI_OA_DISABLE_VFS,					"Disable Virtual File System",	BaseType::Numeric,	NotifEvent::None },
@@ -1040,14 +959,14 @@ static const AttrLookupTable_t asFsiObjAttrNames[] =
 	{ ABP_FSI_OA_DISC_FAULT_TOLERANCE_LEVEL,	"Disc Fault Tolerance Level",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asFsiInstAttrNames[] =
+static constexpr AttrLookupTable_t asFsiInstAttrNames[] =
 {
 	{ ABP_FSI_IA_TYPE,		"Instance Type",			BaseType::Numeric,		NotifEvent::None },
 	{ ABP_FSI_IA_FILE_SIZE,	"File Size",				BaseType::Numeric,		NotifEvent::None },
 	{ ABP_FSI_IA_PATH,		"Current Instance Path",	BaseType::Character,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asFusmInstAttrNames[] =
+static constexpr AttrLookupTable_t asFusmInstAttrNames[] =
 {
 	{ ABP_FUSM_IA_STATE,		"State",					BaseType::Numeric,		NotifEvent::None },
 	{ ABP_FUSM_IA_VENDOR_ID,	"Vendor ID",				BaseType::Numeric,		NotifEvent::None },
@@ -1064,13 +983,13 @@ static const AttrLookupTable_t asFusmInstAttrNames[] =
 	{ ABP_FUSM_IA_VENDOR_BLK_2,	"Vendor Block Safe uC2",	BaseType::Character,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asMddObjAttrNames[] =
+static constexpr AttrLookupTable_t asMddObjAttrNames[] =
 {
 	{ ABP_MDD_OA_NUM_SLOTS,			"Number of Slots",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_MDD_OA_NUM_ADIS_PER_SLOT,	"Number of ADIs Per Slot",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asModInstAttrNames[] =
+static constexpr AttrLookupTable_t asModInstAttrNames[] =
 {
 	{ ABP_MOD_IA_VENDOR_NAME,			"Vendor Name",									BaseType::Character,	NotifEvent::None },
 	{ ABP_MOD_IA_PRODUCT_CODE,			"Product Code",									BaseType::Character,	NotifEvent::None },
@@ -1086,7 +1005,7 @@ static const AttrLookupTable_t asModInstAttrNames[] =
 	{ ABP_MOD_IA_DISABLE_DEVICE_ID_FC,	"Disable Device ID Function Code",				BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asNcInstAttrNames[] =
+static constexpr AttrLookupTable_t asNcInstAttrNames[] =
 {
 	{ ABP_NC_VAR_IA_NAME,			"Name",					BaseType::Character,	NotifEvent::None },
 	{ ABP_NC_VAR_IA_DATA_TYPE,		"Data Type",			BaseType::Numeric,		NotifEvent::None },
@@ -1096,7 +1015,7 @@ static const AttrLookupTable_t asNcInstAttrNames[] =
 	{ ABP_NC_VAR_IA_CONFIG_VALUE,	"Configured Value",		BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asNwInstAttrNames[] =
+static constexpr AttrLookupTable_t asNwInstAttrNames[] =
 {
 	{ ABP_NW_IA_NW_TYPE,		"Network Type",				BaseType::Numeric,		NotifEvent::None },
 	{ ABP_NW_IA_NW_TYPE_STR,	"Network Type String",		BaseType::Character,	NotifEvent::None },
@@ -1107,7 +1026,7 @@ static const AttrLookupTable_t asNwInstAttrNames[] =
 	{ ABP_NW_IA_EXCEPTION_INFO,	"Exception Information",	BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asNwCclInstAttrNames[] =
+static constexpr AttrLookupTable_t asNwCclInstAttrNames[] =
 {
 	{ ABP_NWCCL_IA_NETWORK_SETTINGS,	"Network Settings",				BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWCCL_IA_SYSTEM_AREA_HANDLER,	"System Area Handler",			BaseType::Numeric,	NotifEvent::None },
@@ -1117,14 +1036,14 @@ static const AttrLookupTable_t asNwCclInstAttrNames[] =
 	{ ABP_NWCCL_IA_ERROR_INFO,			"Error Information",			BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asNwCfnInstAttrNames[] =
+static constexpr AttrLookupTable_t asNwCfnInstAttrNames[] =
 {
 	{ ABP_NWCFN_IA_IO_DATA_SIZES,	"IO Data Sizes",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWCFN_IA_APP_OP_STATUS,	"Application OP Status",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWCFN_IA_SLMP_REC_LOCK,	"SLMP Reception Lock",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asNwDpv1InstAttrNames[] =
+static constexpr AttrLookupTable_t asNwDpv1InstAttrNames[] =
 {
    { ABP_DPV1_IA_IDENT_NUMBER,			"PNO Identity Number",		BaseType::Numeric,		NotifEvent::None },
    { ABP_DPV1_IA_PRM_DATA,				"Parameterization Data",	BaseType::Numeric,		NotifEvent::None },
@@ -1148,7 +1067,7 @@ static const AttrLookupTable_t asNwDpv1InstAttrNames[] =
    { ABP_DPV1_IA_RESERVED,				"Reserved",					BaseType::Numeric,		NotifEvent::Alert }
 };
 
-static const AttrLookupTable_t asNwEtnInstAttrNames[] =
+static constexpr AttrLookupTable_t asNwEtnInstAttrNames[] =
 {
 	{ ABP_NWETN_IA_MAC_ID,				"MAC Address",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWETN_IA_PORT1_MAC_ID,		"Port 1 MAC Address",	BaseType::Numeric,	NotifEvent::None },
@@ -1158,7 +1077,7 @@ static const AttrLookupTable_t asNwEtnInstAttrNames[] =
 	{ ABP_NWETN_IA_MEDIA_COUNTERS,		"Media Counters",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asNwPnioInstAttrNames[] =
+static constexpr AttrLookupTable_t asNwPnioInstAttrNames[] =
 {
 	{ ABP_NWPNIO_IA_ONLINE_TRANS,			"Number of on-line transitions",		BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWPNIO_IA_OFFLINE_TRANS,			"Number of off-line transitions",		BaseType::Numeric,	NotifEvent::None },
@@ -1173,13 +1092,13 @@ static const AttrLookupTable_t asNwPnioInstAttrNames[] =
 	{ ABP_NWPNIO_IA_PORT2_MAC_ADDRESS,		"PROFINET IO port 2 MAC address",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asMqttInstAttrNames[] =
+static constexpr AttrLookupTable_t asMqttInstAttrNames[] =
 {
 	{ ABP_MQTT_IA_MODE,			"Mode",				BaseType::Numeric,	NotifEvent::None },
 	{ APB_MQTT_IA_LAST_WILL,	"Last Will",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asOpcuaInstAttrNames[] =
+static constexpr AttrLookupTable_t asOpcuaInstAttrNames[] =
 {
 	{ ABP_OPCUA_IA_MODEL,					"Model",				BaseType::Numeric,		NotifEvent::None },
 	{ ABP_OPCUA_IA_APPLICATION_URI,			"Application URI",		BaseType::Character,	NotifEvent::None },
@@ -1190,7 +1109,7 @@ static const AttrLookupTable_t asOpcuaInstAttrNames[] =
 	{ ABP_OPCUA_IA_LIMITS,					"Limits",				BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asPnamInstAttrNames[] =
+static constexpr AttrLookupTable_t asPnamInstAttrNames[] =
 {
 	{ ABP_PNAM_IA_INFO_TYPE,		"Info Type",							BaseType::Numeric,		NotifEvent::None },
 	{ ABP_PNAM_IA_UNIQUE_ID,		"Unique ID",							BaseType::Numeric,		NotifEvent::None },
@@ -1208,7 +1127,7 @@ static const AttrLookupTable_t asPnamInstAttrNames[] =
 	{ ABP_PNAM_IA_IM_HW_REV,		"I&M Hardware Revision",				BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asPnioInstAttrNames[] =
+static constexpr AttrLookupTable_t asPnioInstAttrNames[] =
 {
 	{ ABP_PNIO_IA_DEVICE_ID,				"Device ID",						BaseType::Numeric,		NotifEvent::None },
 	{ ABP_PNIO_IA_VENDOR_ID,				"Vendor ID (I&M Manufacturer ID)",	BaseType::Numeric,		NotifEvent::None },
@@ -1241,7 +1160,7 @@ static const AttrLookupTable_t asPnioInstAttrNames[] =
 	{ ABP_PNIO_IA_S2_PRIMARY_AR_HANDLE,		"S2 Primary AR Handle",				BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSafeInstAttrNames[] =
+static constexpr AttrLookupTable_t asSafeInstAttrNames[] =
 {
 	{ ABP_SAFE_IA_SAFETY_ENABLED,			"Safety Enabled",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_SAFE_IA_BAUD_RATE,				"Baud Rate",				BaseType::Numeric,	NotifEvent::None },
@@ -1250,14 +1169,14 @@ static const AttrLookupTable_t asSafeInstAttrNames[] =
 	{ ABP_SAFE_IA_FW_UPGRADE_IN_PROGRESS,	"FW Upgrade In Progress",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSmtpObjAttrNames[] =
+static constexpr AttrLookupTable_t asSmtpObjAttrNames[] =
 {
 	{ ABP_SMTP_OA_MAX_INST,		"Maximum Number of Instances",	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_SMTP_OA_EMAILS_SENT,	"Emails Sent",					BaseType::Numeric,	NotifEvent::None },
 	{ ABP_SMTP_OA_EMAIL_FAILED,	"Emails Failed to Send",		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSmtpInstAttrNames[] =
+static constexpr AttrLookupTable_t asSmtpInstAttrNames[] =
 {
 	{ ABP_SMTP_IA_FROM,		"From Address",		BaseType::Character,	NotifEvent::None },
 	{ ABP_SMTP_IA_TO,		"To Address",		BaseType::Character,	NotifEvent::None },
@@ -1265,12 +1184,12 @@ static const AttrLookupTable_t asSmtpInstAttrNames[] =
 	{ ABP_SMTP_IA_MESSAGE,	"Message Body",		BaseType::Character,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSocObjAttrNames[] =
+static constexpr AttrLookupTable_t asSocObjAttrNames[] =
 {
 	{ ABP_SOC_OA_MAX_INST, "Maximum Number of Instances",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSocInstAttrNames[] =
+static constexpr AttrLookupTable_t asSocInstAttrNames[] =
 {
 	{ ABP_SOC_IA_SOCK_TYPE,			"Socket Type",			BaseType::Numeric,	NotifEvent::None },
 	{ ABP_SOC_IA_LOCAL_PORT,		"Local Port",			BaseType::Numeric,	NotifEvent::None },
@@ -1288,7 +1207,7 @@ static const AttrLookupTable_t asSocInstAttrNames[] =
 	{ ABP_SOC_IA_TCP_CONNTIMEO,		"TCP Connect Timeout",	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSrc3InstAttrNames[] =
+static constexpr AttrLookupTable_t asSrc3InstAttrNames[] =
 {
 	{ ABP_SRC3_IA_COMPONENT_NAME,		"Component Name",					BaseType::Character,	NotifEvent::None },
 	{ ABP_SRC3_IA_VENDOR_CODE,			"Vendor Code",						BaseType::Numeric,		NotifEvent::None },
@@ -1299,7 +1218,7 @@ static const AttrLookupTable_t asSrc3InstAttrNames[] =
 	{ ABP_SRC3_IA_MAJOR_EVT_LATCHING,	"Major Diagnostic Event Latching",	BaseType::Numeric,		NotifEvent::None }
 };
 
-static const AttrLookupTable_t asSyncInstAttrNames[] =
+static constexpr AttrLookupTable_t asSyncInstAttrNames[] =
 {
 	{ ABP_SYNC_IA_CYCLE_TIME,			"Cycle Time",					BaseType::Numeric,	NotifEvent::None },
 	{ ABP_SYNC_IA_OUTPUT_VALID,			"Output Valid",					BaseType::Numeric,	NotifEvent::None },
@@ -1315,7 +1234,7 @@ static const AttrLookupTable_t asSyncInstAttrNames[] =
 
 // Entries contained in this table shall be sorted by object number.
 // { Object, Object names pointer, Num object names, Instance names pointer, Num instance names } */
-AttributeNameTable_t asAttributeNameTables[] = {
+static constexpr AttributeNameTable_t asAttributeNameTables[] = {
 	{ ABP_OBJ_NUM_ANB,		0,									NUM_ENTRIES(asAnbInstAttrNames),	nullptr,			asAnbInstAttrNames },
 	{ ABP_OBJ_NUM_DI,		NUM_ENTRIES(asDiObjAttrNames),		NUM_ENTRIES(asDiInstAttrNames),		asDiObjAttrNames,	asDiInstAttrNames },
 	{ ABP_OBJ_NUM_NW,		0,									NUM_ENTRIES(asNwInstAttrNames),		nullptr,			asNwInstAttrNames },
@@ -1369,7 +1288,7 @@ AttributeNameTable_t asAttributeNameTables[] = {
 **
 *******************************************************************************/
 
-static const CmdLookupTable_t asCmdNames[] =
+static constexpr CmdLookupTable_t asCmdNames[] =
 {
 	{ ABP_CMD_GET_ATTR,			"Get_Attribute",			BaseType::Numeric,	BaseType::Numeric,		NotifEvent::None }, // NOTE: BaseType values here are not used by plugin
 	{ ABP_CMD_SET_ATTR,			"Set_Attribute",			BaseType::Numeric,	BaseType::Numeric,		NotifEvent::None }, // NOTE: BaseType values here are not used by plugin
@@ -1387,12 +1306,12 @@ static const CmdLookupTable_t asCmdNames[] =
 **
 *******************************************************************************/
 
-static const CmdLookupTable_t asAddCmdNames[] =
+static constexpr CmdLookupTable_t asAddCmdNames[] =
 {
 	{ ABP_ADD_CMD_ALARM_NOTIFICATION,	"Alarm_Notification",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::Alert }
 };
 
-static const CmdLookupTable_t asAppCmdNames[] =
+static constexpr CmdLookupTable_t asAppCmdNames[] =
 {
 	{ ABP_APP_CMD_RESET_REQUEST,		"Reset_Request",			BaseType::Numeric,	BaseType::Numeric,		NotifEvent::None },
 	{ ABP_APP_CMD_CHANGE_LANG_REQUEST,	"Change_Language_Request",	BaseType::Numeric,	BaseType::Numeric,		NotifEvent::None },
@@ -1400,7 +1319,7 @@ static const CmdLookupTable_t asAppCmdNames[] =
 	{ ABP_APP_CMD_GET_DATA_NOTIF,		"Get_Data_Notification",	BaseType::Numeric,	BaseType::Character,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asAppdCmdNames[] =
+static constexpr CmdLookupTable_t asAppdCmdNames[] =
 {
 	{ ABP_APPD_CMD_GET_INST_BY_ORDER,		"Get_Instance_Number_By_Order",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_APPD_GET_PROFILE_INST_NUMBERS,	"Get_Profile_Inst_Numbers",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1410,13 +1329,13 @@ static const CmdLookupTable_t asAppdCmdNames[] =
 	{ ABP_APPD_GET_INSTANCE_NUMBERS,		"Get_Instance_Numbers",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asAsmCmdNames[] =
+static constexpr CmdLookupTable_t asAsmCmdNames[] =
 {
 	{ ABP_ASM_CMD_WRITE_ASSEMBLY_DATA,	"Write_Assembly_Data",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ASM_CMD_READ_ASSEMBLY_DATA,	"Read_Assembly_Data",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asBacCmdNames[] =
+static constexpr CmdLookupTable_t asBacCmdNames[] =
 {
 	{ ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST,		"Get_ADI_By_BacNet_Obj_Inst",		BaseType::Numeric,		BaseType::Numeric,	NotifEvent::None },
 	{ ABP_BAC_CMD_GET_ADI_BY_BACNET_OBJ_INST_NAME,	"Get_ADI_By_BacNet_Obj_Inst_Name",	BaseType::Character,	BaseType::Numeric,	NotifEvent::None },
@@ -1424,36 +1343,36 @@ static const CmdLookupTable_t asBacCmdNames[] =
 	{ ABP_BAC_CMD_GET_BACNET_OBJ_INST_BY_ADI,		"Get_BacNet_Obj_Inst_By_ADI",		BaseType::Numeric,		BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asCclCmdNames[] =
+static constexpr CmdLookupTable_t asCclCmdNames[] =
 {
 	{ ABP_CCL_CMD_INITIAL_DATA_SETTING_NOTIFICATION,				"Initial_Data_Setting_Notification",				BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_CCL_CMD_INITIAL_DATA_PROCESSING_COMPLETED_NOTIFICATION,	"Initial_Data_Processing_Completed_Notification",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asCfnCmdNames[] =
+static constexpr CmdLookupTable_t asCfnCmdNames[] =
 {
 	{ ABP_CFN_CMD_BUF_SIZE_NOTIF,	"Buf_Size_Notif",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_CFN_CMD_SLMP_SERVER_REQ,	"SLMP_Server_Req",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asCntCmdNames[] =
+static constexpr CmdLookupTable_t asCntCmdNames[] =
 {
 	{ ABP_CNT_CMD_PROCESS_CIP_OBJ_REQUEST,	"Process_CIP_Obj_Request",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_CNT_CMD_SET_CONFIG_DATA,			"Set_Config_Data",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_CNT_CMD_GET_CONFIG_DATA,			"Get_Config_Data",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 };
 
-static const CmdLookupTable_t asCpnCmdNames[] =
+static constexpr CmdLookupTable_t asCpnCmdNames[] =
 {
 	{ ABP_CPN_CMD_PROCESS_CIP_OBJ_REQUEST,	"Process_CIP_Obj_Request",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asDevCmdNames[] =
+static constexpr CmdLookupTable_t asDevCmdNames[] =
 {
 	{ ABP_DEV_CMD_PROCESS_CIP_OBJ_REQUEST,	"Process_CIP_Obj_Request",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asDpv1CmdNames[] =
+static constexpr CmdLookupTable_t asDpv1CmdNames[] =
 {
 	{ ABP_DPV1_CMD_GET_IM_RECORD,	"Get_IM_Record",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_DPV1_CMD_SET_IM_RECORD,	"Set_IM_Record",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1462,14 +1381,14 @@ static const CmdLookupTable_t asDpv1CmdNames[] =
 	{ ABP_DPV1_CMD_SET_RECORD,		"Set_Record",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asEcoCmdNames[] =
+static constexpr CmdLookupTable_t asEcoCmdNames[] =
 {
 	{ ABP_ECO_CMD_START_PAUSE,			"Start_Pause",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ECO_CMD_END_PAUSE,			"End_Pause",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_ECO_CMD_PREVIEW_PAUSE_TIME,	"Preview_Pause_Time",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asEctCmdNames[] =
+static constexpr CmdLookupTable_t asEctCmdNames[] =
 {
 	{ ABP_ECT_CMD_GET_OBJECT_DESC,		"Get_Object_Description",	BaseType::Numeric,	BaseType::Numeric,		NotifEvent::None },
 	{ ABP_ECT_CMD_GET_OBJECT_ACCESS,	"Get_Object_Access",		BaseType::Numeric,	BaseType::Numeric,		NotifEvent::None },
@@ -1477,7 +1396,7 @@ static const CmdLookupTable_t asEctCmdNames[] =
 	{ ABP_ECT_CMD_GET_ENUM_DATA,		"Get_Enum_Data",			BaseType::Numeric,	BaseType::Character,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asEipCmdNames[] =
+static constexpr CmdLookupTable_t asEipCmdNames[] =
 {
 	{ ABP_EIP_CMD_PROCESS_CIP_OBJ_REQUEST,		"Process_CIP_Obj_Request",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_EIP_CMD_SET_CONFIG_DATA,				"Set_Config_Data",				BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1486,12 +1405,12 @@ static const CmdLookupTable_t asEipCmdNames[] =
 	{ ABP_EIP_CMD_PROCESS_CIP_OBJ_REQUEST_EXT,	"Process_CIP_Obj_Request_Ext",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asEmeCmdNames[] =
+static constexpr CmdLookupTable_t asEmeCmdNames[] =
 {
 	{ ABP_EME_CMD_GET_ATTRIBUTE_MEASUREMENT_LIST,	"Get_Attribute_Measurement_List",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asFsiCmdNames[] =
+static constexpr CmdLookupTable_t asFsiCmdNames[] =
 {
 	{ ABP_FSI_CMD_FILE_OPEN,			"File_Open",				BaseType::Character,	BaseType::Numeric,		NotifEvent::None },
 	{ ABP_FSI_CMD_FILE_CLOSE,			"File_Close",				BaseType::Numeric,		BaseType::Numeric,		NotifEvent::None },
@@ -1509,7 +1428,7 @@ static const CmdLookupTable_t asFsiCmdNames[] =
 	{ ABP_FSI_CMD_FORMAT_DISC,			"Format_Disc (deprecated)",	BaseType::Numeric,		BaseType::Numeric,		NotifEvent::Alert }
 };
 
-static const CmdLookupTable_t asFusmCmdNames[] =
+static constexpr CmdLookupTable_t asFusmCmdNames[] =
 {
 	{ ABP_FUSM_CMD_ERROR_CONFIRMATION,		"Error_Confirmation",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::Alert },
 	{ ABP_FUSM_CMD_SET_IO_CFG_STRING,		"Set_IO_Cfg_String",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1517,22 +1436,22 @@ static const CmdLookupTable_t asFusmCmdNames[] =
 	{ ABP_FUSM_CMD_GET_SAFETY_INPUT_PDU,	"Get_Safety_Input_PDU",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asMddCmdNames[] =
+static constexpr CmdLookupTable_t asMddCmdNames[] =
 {
 	{ ABP_MDD_CMD_GET_LIST, "Get_List",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asModCmdNames[] =
+static constexpr CmdLookupTable_t asModCmdNames[] =
 {
 	{ ABP_MOD_CMD_PROCESS_MODBUS_MESSAGE,	"Process_Modbus_Message",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asMqttCmdNames[] =
+static constexpr CmdLookupTable_t asMqttCmdNames[] =
 {
 	{ ABP_MQTT_CMD_GET_PUBLISH_CONFIGURATION,	"Get_Publish_Configuration",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asNwCmdNames[] =
+static constexpr CmdLookupTable_t asNwCmdNames[] =
 {
 	{ ABP_NW_CMD_MAP_ADI_WRITE_AREA,		"Map_ADI_Write_Area",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NW_CMD_MAP_ADI_READ_AREA,			"Map_ADI_Read_Area",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1540,25 +1459,25 @@ static const CmdLookupTable_t asNwCmdNames[] =
 	{ ABP_NW_CMD_MAP_ADI_READ_EXT_AREA,		"Map_ADI_Read_Ext_Area",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asNwCclCmdNames[] =
+static constexpr CmdLookupTable_t asNwCclCmdNames[] =
 {
 	{ ABP_NWCCL_CMD_MAP_ADI_SPEC_WRITE_AREA,	"Map_ADI_Spec_Write_Area",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWCCL_CMD_MAP_ADI_SPEC_READ_AREA,		"Map_ADI_Spec_Read_Area",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWCCL_CMD_CCL_CONF_TEST_MODE,			"CCL_Conf_Test_Mode",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asNwCfnCmdNames[] =
+static constexpr CmdLookupTable_t asNwCfnCmdNames[] =
 {
 	{ ABP_NWCFN_CMD_EXT_LOOPBACK,	"Ext_Loopback",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asNwDpv1CmdNames[] =
+static constexpr CmdLookupTable_t asNwDpv1CmdNames[] =
 {
 	{ ABP_NWDPV1_CMD_MAP_ADI_WRITE_AREA,	"Map_ADI_Write_Area",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWDPV1_CMD_MAP_ADI_READ_AREA,		"Map_ADI_Read_Area",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asNwPnioCmdNames[] =
+static constexpr CmdLookupTable_t asNwPnioCmdNames[] =
 {
 	{ ABP_NWPNIO_CMD_PLUG_MODULE,			"Plug_Module",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_NWPNIO_CMD_PLUG_SUB_MODULE,		"Plug_Submodule",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1573,7 +1492,7 @@ static const CmdLookupTable_t asNwPnioCmdNames[] =
 	{ ABP_NWPNIO_CMD_IDENT_CHANGE_DONE,		"Ident_Change_Done",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asPnioCmdNames[] =
+static constexpr CmdLookupTable_t asPnioCmdNames[] =
 {
 	{ ABP_PNIO_CMD_GET_RECORD,			"Get_Record",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
 	{ ABP_PNIO_CMD_SET_RECORD,			"Set_Record",			BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None },
@@ -1592,12 +1511,12 @@ static const CmdLookupTable_t asPnioCmdNames[] =
 	{ ABP_PNIO_CMD_PRM_BEGIN_IND,		"Prm_Begin_Ind",		BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-static const CmdLookupTable_t asSrc3CmdNames[] =
+static constexpr CmdLookupTable_t asSrc3CmdNames[] =
 {
 	{ ABP_SRC3_CMD_RESET_DIAGNOSTIC,	"Reset_Diagnostic",	BaseType::Numeric,	BaseType::Numeric,	NotifEvent::None }
 };
 
-CommandNameTable_t asCommandNameTables[] =
+static constexpr CommandNameTable_t asCommandNameTables[] =
 {
 	{ ABP_OBJ_NUM_ADD,		NUM_ENTRIES(asAddCmdNames),		asAddCmdNames },
 	{ ABP_OBJ_NUM_NW,		NUM_ENTRIES(asNwCmdNames),		asNwCmdNames },
@@ -1635,7 +1554,7 @@ CommandNameTable_t asCommandNameTables[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asErrorRspNames[] =
+static constexpr LookupTable_t asErrorRspNames[] =
 {
 	{ ABP_ERR_INV_MSG_FORMAT,					"Invalid message format",							NotifEvent::Alert },
 	{ ABP_ERR_UNSUP_OBJ,						"Unsupported object",								NotifEvent::Alert },
@@ -1668,28 +1587,28 @@ static const LookupTable_t asErrorRspNames[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asAnbErrNames[] =
+static constexpr LookupTable_t asAnbErrNames[] =
 {
 	{ ABP_ANB_ERR_INV_PRD_CFG,		"Invalid process data config",		NotifEvent::Alert },
 	{ ABP_ANB_ERR_INV_DEV_ADDR,		"Invalid device address",			NotifEvent::Alert },
 	{ ABP_ANB_ERR_INV_COM_SETTINGS,	"Invalid communication settings",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asAppdErrNames[] =
+static constexpr LookupTable_t asAppdErrNames[] =
 {
 	{ ABP_APPD_ERR_MAPPING_ITEM_NAK,				"Mapping item NAK",				NotifEvent::Alert },
 	{ ABP_APPD_ERR_INVALID_TOTAL_SIZE,				"Invalid total size",			NotifEvent::Alert },
 	{ ABP_APPD_ERR_ATTR_CTRL_FROM_OTHER_CHANNEL,	"Attr ctrl from other channel",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asDiErrNames[] =
+static constexpr LookupTable_t asDiErrNames[] =
 {
 	{ ABP_DI_ERR_NOT_REMOVED,		"Event could not be removed",		NotifEvent::Alert },
 	{ ABP_DI_LATCH_NOT_SUPPORTED,	"Latching events not supported",	NotifEvent::Alert },
 	{ ABP_DI_ERR_NW_SPECIFIC,		"Network specific error",			NotifEvent::Alert }
 };
 
-static const LookupTable_t asPirDiErrNames[] =
+static constexpr LookupTable_t asPirDiErrNames[] =
 {
 	{ 0x03,	"API does not exist",								NotifEvent::Alert },
 	{ 0x04,	"No module inserted in the specified slot",			NotifEvent::Alert },
@@ -1709,13 +1628,13 @@ static const LookupTable_t asPirDiErrNames[] =
 	{ 0xFF,	"Unknown error",									NotifEvent::Alert }
 };
 
-static const LookupTable_t asEipErrNames[] =
+static constexpr LookupTable_t asEipErrNames[] =
 {
 	{ ABP_EIP_ERR_OWNERSHIP_CONFLICT,	"Ownership conflict",		NotifEvent::Alert },
 	{ ABP_EIP_ERR_INVALID_CONFIG,		"Invalid configuration",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asFsiErrNames[] =
+static constexpr LookupTable_t asFsiErrNames[] =
 {
 	{ ABP_FSI_ERR_FILE_OPEN_FAILED,				"File_Open Failed",			NotifEvent::Alert },
 	{ ABP_FSI_ERR_FILE_CLOSE_FAILED,			"File_Close Failed",		NotifEvent::Alert },
@@ -1731,18 +1650,18 @@ static const LookupTable_t asFsiErrNames[] =
 	{ ABP_FSI_ERR_FILE_RENAME_FAILED,			"File_Rename Failed",		NotifEvent::Alert }
 };
 
-static const LookupTable_t asFusmErrNames[] =
+static constexpr LookupTable_t asFusmErrNames[] =
 {
 	{ ABP_FUSM_ERR_REJECT_BY_MODULE,	"Rejected by module",			NotifEvent::Alert },
 	{ ABP_FUSM_ERR_MODULE_RSP_FAULTY,	"Module response is faulty",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asModErrNames[] =
+static constexpr LookupTable_t asModErrNames[] =
 {
 	{ ABP_MOD_NW_EXCPT_MISSING_MAC_ADDRESS,	"Missing MAC Address",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwErrNames[] =
+static constexpr LookupTable_t asNwErrNames[] =
 {
 	{ ABP_NW_ERR_INVALID_ADI_DATA_TYPE,	"Invalid ADI data type",		NotifEvent::Alert },
 	{ ABP_NW_ERR_INVALID_NUM_ELEMENTS,	"Invalid number of elements",	NotifEvent::Alert },
@@ -1756,7 +1675,7 @@ static const LookupTable_t asNwErrNames[] =
 	{ ABP_NW_ERR_NW_SPEC_RESTRICTION,	"Network specific restriction",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwCclErrNames[] =
+static constexpr LookupTable_t asNwCclErrNames[] =
 {
 	{ ABP_NWCCL_ERR_INVALID_ADI_DATA_TYPE,	"Invalid ADI data type",		NotifEvent::Alert },
 	{ ABP_NWCCL_ERR_INVALID_NUM_ELEMENTS,	"Invalid number of elements",	NotifEvent::Alert },
@@ -1768,7 +1687,7 @@ static const LookupTable_t asNwCclErrNames[] =
 	{ ABP_NWCCL_ERR_DATA_OVERLAPPING,		"Data overlapping",				NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwDpv1ErrNames[] =
+static constexpr LookupTable_t asNwDpv1ErrNames[] =
 {
 	{ ABP_NWDPV1_ERR_INVALID_ADI_DATA_TYPE,		"Invalid ADI data type",		NotifEvent::Alert },
 	{ ABP_NWDPV1_ERR_INVALID_NUM_ELEMENTS,		"Invalid number of elements",	NotifEvent::Alert },
@@ -1779,7 +1698,7 @@ static const LookupTable_t asNwDpv1ErrNames[] =
 	{ ABP_NWDPV1_ERR_TOO_MUCH_TOTAL_CFG_DATA,	"Too much total config data",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwPnioErrNames[] =
+static constexpr LookupTable_t asNwPnioErrNames[] =
 {
 	{ ABP_NWPNIO_ERR_ADI_WRITE_NOT_MAPPED,		"ADI not mapped via Map_ADI_Write_Area",	NotifEvent::Alert },
 	{ ABP_NWPNIO_ERR_ADI_READ_NOT_MAPPED,		"ADI not mapped via Map_ADI_Read_Area",		NotifEvent::Alert },
@@ -1806,7 +1725,7 @@ static const LookupTable_t asNwPnioErrNames[] =
 	{ ABP_NWPNIO_ERR_ASM_ALREADY_PLUGGED,		"Safety module already plugged",			NotifEvent::Alert }
 };
 
-static const LookupTable_t asSmtpErrNames[] =
+static constexpr LookupTable_t asSmtpErrNames[] =
 {
 	{ ABP_SMTP_NO_EMAIL_SERVER,			"No e-mail server",			NotifEvent::Alert },
 	{ ABP_SMTP_SERVER_NOT_READY,		"Server not ready",			NotifEvent::Alert },
@@ -1818,7 +1737,7 @@ static const LookupTable_t asSmtpErrNames[] =
 };
 
 
-static const LookupTable_t asSocErrNames[] =
+static constexpr LookupTable_t asSocErrNames[] =
 {
 	{ SOC_ERR_ENOBUFS,			"ENOBUFS",			NotifEvent::Alert },
 	{ SOC_ERR_ETIMEDOUT,		"ETIMEDOUT",		NotifEvent::Alert },
@@ -1874,12 +1793,12 @@ ErrorNameTable_t asErrorNameTables[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asNwExcptNames[] =
+static constexpr LookupTable_t asNwExcptNames[] =
 {
 	{ ABP_NW_EXCPT_INFO_NONE,	"No exception",	NotifEvent::None }
 };
 
-static const LookupTable_t asNwBacExcptNames[] =
+static constexpr LookupTable_t asNwBacExcptNames[] =
 {
 	{ ABP_BAC_EXCPT_INFO_COULD_NOT_READ_OBJ_INST_AV,		"Could not read object instance AV",		NotifEvent::Alert },
 	{ ABP_BAC_EXCPT_INFO_COULD_NOT_READ_OBJ_INST_BV,		"Could not read object instance BV",		NotifEvent::Alert },
@@ -1888,23 +1807,23 @@ static const LookupTable_t asNwBacExcptNames[] =
 };
 
 /* Unused Lookup Tables
-static const LookupTable_t asNwCntExcptNames[] =
+static constexpr LookupTable_t asNwCntExcptNames[] =
 {
 	{ ABP_CNT_NW_EXCPT_INFO_INVALID_SY_INST,	"Invalid SY instance",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwCpnExcptNames[] =
+static constexpr LookupTable_t asNwCpnExcptNames[] =
 {
 	{ ABP_CPN_NW_EXCPT_INFO_INVALID_SY_INST,	"Invalid SY instance",	NotifEvent::Alert }
 };
 */
 
-static const LookupTable_t asNwDevExcptNames[] =
+static constexpr LookupTable_t asNwDevExcptNames[] =
 {
 	{ ABP_DEV_NW_EXCPT_INFO_INVALID_SY_INST,	"Invalid SY instance",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwDpv1ExcptNames[] =
+static constexpr LookupTable_t asNwDpv1ExcptNames[] =
 {
 	{ ABP_NW_EXCPT_DPV1_TOO_MUCH_DEFAULT_CFG_DATA,			"Too much default config data",					NotifEvent::Alert },
 	{ ABP_NW_EXCPT_DPV1_CFG_DATA_ATTR_TOO_BIG,				"Data attribute too big",						NotifEvent::Alert },
@@ -1921,7 +1840,7 @@ static const LookupTable_t asNwDpv1ExcptNames[] =
 	{ ABP_NW_EXCPT_DPV1_INVALID_MAP_EMPTY_SLOT,				"Invalid map empty slot",						NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwEctExcptNames[] =
+static constexpr LookupTable_t asNwEctExcptNames[] =
 {
 	{ ABP_ECT_NW_EXCPT_ILLEGAL_DATA_TYPE,								"Illegal data type",								NotifEvent::Alert },
 	{ ABP_ECT_NW_EXCPT_INSTANCE_BY_ORDER_ERROR,							"Instance by order error",							NotifEvent::Alert },
@@ -1934,7 +1853,7 @@ static const LookupTable_t asNwEctExcptNames[] =
 	{ ABP_ECT_NW_EXCPT_NO_MAC_ADDR,										"No MAC address",									NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwEipExcptNames[] =
+static constexpr LookupTable_t asNwEipExcptNames[] =
 {
 	{ ABP_EIP_NW_EXCPT_INFO_INVALID_SY_INST,		"Invalid SY Instance",			NotifEvent::Alert },
 	{ ABP_EIP_NW_EXCPT_INFO_INVALID_PROD_MAP_SIZE,	"Invalid producing map size",	NotifEvent::Alert },
@@ -1942,23 +1861,23 @@ static const LookupTable_t asNwEipExcptNames[] =
 	{ ABP_EIP_NW_EXCPT_INFO_MISSING_MAC_ADDRESS,	"Missing MAC address",			NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwEplExcptNames[] =
+static constexpr LookupTable_t asNwEplExcptNames[] =
 {
 	{ ABP_EPL_NW_EXCPT_GET_INST_NUMBERS_ERROR,		"Get instance numbers error",			NotifEvent::Alert },
 	{ ABP_EPL_NW_EXCPT_NO_MAC_ADDR,					"No MAC Address",						NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwModExcptNames[] =
+static constexpr LookupTable_t asNwModExcptNames[] =
 {
 	{ ABP_MOD_NW_EXCPT_MISSING_MAC_ADDRESS,	"Missing MAC address",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwCopExcptNames[] =
+static constexpr LookupTable_t asNwCopExcptNames[] =
 {
 	{ ABP_COP_NW_EXCPT_ILLEGAL_DATA_TYPE,	"Illegal Data Type",	NotifEvent::Alert }
 };
 
-static const LookupTable_t asNwPnioExcptNames[] =
+static constexpr LookupTable_t asNwPnioExcptNames[] =
 {
 	{ ABP_PNIO_NW_EXCPT_ILLEGAL_VALUE,			"Illegal value",			NotifEvent::Alert },
 	{ ABP_PNIO_NW_EXCPT_WRONG_DATA_SIZE,		"Wrong data size",			NotifEvent::Alert },
@@ -1977,7 +1896,7 @@ static const LookupTable_t asNwPnioExcptNames[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asAnbExcptNames[] =
+static constexpr LookupTable_t asAnbExcptNames[] =
 {
 	{ ABP_ANB_EXCPT_NONE,					"No exception",						NotifEvent::None },
 	{ ABP_ANB_EXCPT_APP_TO,					"Application timeout",				NotifEvent::Alert },
@@ -2001,7 +1920,7 @@ static const LookupTable_t asAnbExcptNames[] =
 **
 *******************************************************************************/
 
-static const LookupTable_t asFusmExcptNames[] =
+static constexpr LookupTable_t asFusmExcptNames[] =
 {
 	{ ABP_FUSM_EXCPT_INFO_NONE,					"None",									NotifEvent::None },
 	{ ABP_FUSM_EXCPT_INFO_BAUDRATE_NOT_SUPP,	"Baudrate not supported",				NotifEvent::Alert },
@@ -2027,7 +1946,7 @@ static const LookupTable_t asFusmExcptNames[] =
 	{ ABP_FUSM_EXCPT_INFO_SAFE_MOD_INIT_FAIL,	"Safety module initialzation failed",	NotifEvent::Alert }
 };
 
-ExceptionNameTable asExceptionNameTables[] =
+static constexpr ExceptionNameTable_t asExceptionNameTables[] =
 {
 	/* Negative reference IDs are associated with Anybus objects other than the Network object. */
 	{ -ABP_OBJ_NUM_FUSM,			1,	ABP_FUSM_IA_EXCPT_INFO,		NUM_ENTRIES(asFusmExcptNames),		asFusmExcptNames }, /* Special case for addressing FUSM Object exceptions. */
@@ -2059,12 +1978,141 @@ ExceptionNameTable asExceptionNameTables[] =
 	{ ABP_NW_TYPE_PIR_IIOT,			1,	ABP_NW_IA_EXCEPTION_INFO,	NUM_ENTRIES(asNwPnioExcptNames),	asNwPnioExcptNames }
 };
 
-static const CmdLookupTable_t* FindCmdEntryInTable(U8 cmd,
-	const CmdLookupTable_t* command_names, U8 num_commands);
+/*******************************************************************************
+**
+** Direct-index tables, generated at compile time from the lookup tables above.
+** Each maps a value to the position of its first entry in a lookup table, so
+** that a lookup does not have to search the tables.
+**
+*******************************************************************************/
+
+#define NO_ENTRY_INDEX					0xFF
+#define NUM_OBJECT_VALUES				256
+#define NUM_ATTRIBUTE_VALUES			256
+#define NUM_COMMAND_VALUES				(ABP_MSG_HEADER_CMD_BITS + 1)
 
-static const AttrLookupTable_t* FindAttrEntryInTable(U16 inst, U8 attr,
-	const AttrLookupTable_t* obj_names, U8 num_obj_names,
-	const AttrLookupTable_t* inst_names, U8 num_inst_names);
+typedef struct ObjectIndex
+{
+	U8 abName[NUM_OBJECT_VALUES];					// Entry of asObjectNames
+	U8 abAttributeTable[NUM_OBJECT_VALUES];			// Entry of asAttributeNameTables
+	U8 abCommandTable[NUM_OBJECT_VALUES];			// Entry of asCommandNameTables
+	U8 abObjectException[NUM_OBJECT_VALUES];		// Entry of asExceptionNameTables, by object
+	U8 abNetworkException[NUM_OBJECT_VALUES];		// Entry of asExceptionNameTables, by network type
+} ObjectIndex_t;
+
+template <U32 NUM_TABLES>
+struct AttributeIndex
+{
+	U8 abCommon[NUM_ATTRIBUTE_VALUES];				// Entry of asObjAttrNames
+	U8 aabObj[NUM_TABLES][NUM_ATTRIBUTE_VALUES];	// Entry of the table's obj_names
+	U8 aabInst[NUM_TABLES][NUM_ATTRIBUTE_VALUES];	// Entry of the table's inst_names
+};
+
+template <U32 NUM_TABLES>
+struct CommandIndex
+{
+	U8 abStandard[NUM_COMMAND_VALUES];				// Entry of asCmdNames
+	U8 aabObjSpecific[NUM_TABLES][NUM_COMMAND_VALUES];	// Entry of the table's cmd_names
+};
+
+template <typename T>
+constexpr void BuildEntryIndex(U8* index, U32 num_values, const T* entries, U32 num_entries)
+{
+	for (U32 i = 0; i < num_values; i++)
+	{
+		index[i] = NO_ENTRY_INDEX;
+	}
+
+	// Backwards, so that the first of any duplicate values is found
+	for (U32 i = num_entries; i > 0; i--)
+	{
+		if (entries[i - 1].value < num_values)
+		{
+			index[entries[i - 1].value] = (U8)(i - 1);
+		}
+	}
+}
+
+template <typename T>
+constexpr void BuildTableIndex(U8* index, const T* tables, U32 num_tables)
+{
+	for (U32 i = 0; i < NUM_OBJECT_VALUES; i++)
+	{
+		index[i] = NO_ENTRY_INDEX;
+	}
+
+	for (U32 i = num_tables; i > 0; i--)
+	{
+		index[tables[i - 1].object_num] = (U8)(i - 1);
+	}
+}
+
+constexpr ObjectIndex_t BuildObjectIndex()
+{
+	ObjectIndex_t index = {};
+
+	BuildEntryIndex(index.abName, NUM_OBJECT_VALUES, asObjectNames, NUM_ENTRIES(asObjectNames));
+	BuildTableIndex(index.abAttributeTable, asAttributeNameTables, sizeof(asAttributeNameTables) / sizeof(AttributeNameTable_t));
+	BuildTableIndex(index.abCommandTable, asCommandNameTables, sizeof(asCommandNameTables) / sizeof(CommandNameTable_t));
+
+	for (U32 i = 0; i < NUM_OBJECT_VALUES; i++)
+	{
+		index.abObjectException[i] = NO_ENTRY_INDEX;
+		index.abNetworkException[i] = NO_ENTRY_INDEX;
+	}
+
+	// Negative reference IDs are object numbers, positive ones network types
+	for (U32 i = sizeof(asExceptionNameTables) / sizeof(ExceptionNameTable_t); i > 0; i--)
+	{
+		S16 refId = asExceptionNameTables[i - 1].ref_id;
+
+		if (refId < 0)
+		{
+			index.abObjectException[(U8)-refId] = (U8)(i - 1);
+		}
+		else if (refId > 0)
+		{
+			index.abNetworkException[(U8)refId] = (U8)(i - 1);
+		}
+	}
+
+	return index;
+}
+
+template <U32 NUM_TABLES>
+constexpr AttributeIndex<NUM_TABLES> BuildAttributeIndex(const AttributeNameTable_t (&tables)[NUM_TABLES])
+{
+	AttributeIndex<NUM_TABLES> index = {};
+
+	BuildEntryIndex(index.abCommon, NUM_ATTRIBUTE_VALUES, asObjAttrNames, NUM_ENTRIES(asObjAttrNames));
+
+	for (U32 i = 0; i < NUM_TABLES; i++)
+	{
+		BuildEntryIndex(index.aabObj[i], NUM_ATTRIBUTE_VALUES, tables[i].obj_names, tables[i].num_obj_names);
+		BuildEntryIndex(index.aabInst[i], NUM_ATTRIBUTE_VALUES, tables[i].inst_names, tables[i].num_inst_names);
+	}
+
+	return index;
+}
+
+template <U32 NUM_TABLES>
+constexpr CommandIndex<NUM_TABLES> BuildCommandIndex(const CommandNameTable_t (&tables)[NUM_TABLES])
+{
+	CommandIndex<NUM_TABLES> index = {};
+
+	BuildEntryIndex(index.abStandard, NUM_COMMAND_VALUES, asCmdNames, NUM_ENTRIES(asCmdNames));
+
+	for (U32 i = 0; i < NUM_TABLES; i++)
+	{
+		BuildEntryIndex(index.aabObjSpecific[i], NUM_COMMAND_VALUES, tables[i].cmd_names, tables[i].num_cmd_names);
+	}
+
+	return index;
+}
+
+static constexpr ObjectIndex_t sObjectIndex = BuildObjectIndex();
+static constexpr auto sAttributeIndex = BuildAttributeIndex(asAttributeNameTables);
+static constexpr auto sCommandIndex = BuildCommandIndex(asCommandNameTables);
 
 static const CmdLookupTable_t* LookupCmdEntry(U8 obj, U8 cmd);
 static const AttrLookupTable_t* LookupAttrEntry(U8 obj, U16 inst, U8 attr);
@@ -2073,10 +2121,9 @@ static const AttrLookupTable_t* LookupAttrEntry(U8 obj, U16 inst, U8 attr);
 bool GetExceptionTableIndex(bool nw_object, U8 nw_type_idx, const MsgHeaderInfo_t* msg_header, U16* table_index)
 {
 	const U16 unspecifiedNetworkTypeTableIndex = 0xFFFF;
-	const U16 numEntries = sizeof(asExceptionNameTables) / sizeof(ExceptionNameTable_t);
 	const U8 exceptionAttrNum = 7;
 	U8 attribute = static_cast<U8>(msg_header->cmdExt & 0x00FF);
-	bool foundTableEntry = false;
+	U8 entry;
 
 	if (nw_object && (nw_type_idx == 0))
 	{
@@ -2085,36 +2132,26 @@ bool GetExceptionTableIndex(bool nw_object, U8 nw_type_idx, const MsgHeaderInfo_
 		return (attribute == exceptionAttrNum);
 	}
 
-	// Attempt to find matching "exception names" table.
-	for (*table_index = 0; *table_index < numEntries; (*table_index)++)
+	// The "exception names" table of the network type or object, at most one each.
+	if (nw_object)
 	{
-		if (nw_object && (asExceptionNameTables[*table_index].ref_id > 0))
-		{
-			// ref_id represents a network type.
-			if ((abNetworkTypeValue[nw_type_idx] == asExceptionNameTables[*table_index].ref_id) &&
-				(msg_header->inst == asExceptionNameTables[*table_index].inst) &&
-				(attribute == asExceptionNameTables[*table_index].attribute))
-			{
-				foundTableEntry = true;
-				break;
-			}
-		}
-		else if (!nw_object && (asExceptionNameTables[*table_index].ref_id < 0))
-		{
-			// ref_id represents an object number (in 2's complement).
-			U8 objNum = (U8)(~asExceptionNameTables[*table_index].ref_id + 1);
+		entry = sObjectIndex.abNetworkException[abNetworkTypeValue[nw_type_idx]];
+	}
+	else
+	{
+		entry = sObjectIndex.abObjectException[msg_header->obj];
+	}
 
-			if ((objNum == msg_header->obj) &&
-				(msg_header->inst == asExceptionNameTables[*table_index].inst) &&
-				(attribute == asExceptionNameTables[*table_index].attribute))
-			{
-				foundTableEntry = true;
-				break;
-			}
-		}
+	if ((entry == NO_ENTRY_INDEX) ||
+		(msg_header->inst != asExceptionNameTables[entry].inst) ||
+		(attribute != asExceptionNameTables[entry].attribute))
+	{
+		return false;
 	}
 
-	return foundTableEntry;
+	*table_index = entry;
+
+	return true;
 }
 
 NotifEvent_t GetExceptionString(bool nw_object, U16 table_index, U8 val, char* str, U16 max_str_len, DisplayBase display_base)
@@ -2628,15 +2665,13 @@ NotifEvent_t GetNamedAttrString(
 NotifEvent_t GetObjectString(U8 val, char* str, U16 max_str_len, DisplayBase display_base)
 {
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+	U8 entry = sObjectIndex.abName[val];
 
-	for (U8 i = 0; i < NUM_ENTRIES(asObjectNames); i++)
+	if (entry != NO_ENTRY_INDEX)
 	{
-		if (asObjectNames[i].value == val)
-		{
-			SNPRINTF(str, max_str_len, "%s", asObjectNames[i].name);
+		SNPRINTF(str, max_str_len, "%s", asObjectNames[entry].name);
 
-			return asObjectNames[i].notification;
-		}
+		return asObjectNames[entry].notification;
 	}
 
 	GetNumberString(val, display_base, SIZE_IN_BITS(val), numberStr, sizeof(numberStr), BaseType::Numeric);
@@ -2784,123 +2819,66 @@ BaseType GetCmdBaseType(U8 obj, U8 cmd)
 	return type;
 }
 
-static const AttrLookupTable_t* FindAttrEntryInTable(
-	U16 inst, U8 attr,
-	const AttrLookupTable_t* obj_names, U8 num_obj_names,
-	const AttrLookupTable_t* inst_names, U8 num_inst_names)
+static const AttrLookupTable_t* LookupAttrEntry(U8 obj, U16 inst, U8 attr)
 {
-	const AttrLookupTable_t* tablePtr = nullptr;
-	const AttrLookupTable_t* entryPtr = nullptr;
-	U8 numAttrs = 0;
+	U8 table = sObjectIndex.abAttributeTable[obj];
+	const AttrLookupTable_t* tablePtr;
+	U8 entry;
+
+	if (table == NO_ENTRY_INDEX)
+	{
+		return nullptr;
+	}
 
 	if (inst == ABP_INST_OBJ)
 	{
 		if (attr <= asObjAttrNames[NUM_ENTRIES(asObjAttrNames) - 1].value)
 		{
-			tablePtr = &asObjAttrNames[0];
-			numAttrs = NUM_ENTRIES(asObjAttrNames);
+			tablePtr = asObjAttrNames;
+			entry = sAttributeIndex.abCommon[attr];
 		}
 		else
 		{
-			if (obj_names != nullptr)
-			{
-				tablePtr = obj_names;
-				numAttrs = num_obj_names;
-			}
+			tablePtr = asAttributeNameTables[table].obj_names;
+			entry = sAttributeIndex.aabObj[table][attr];
 		}
 	}
 	else
 	{
-		if (num_inst_names != 0)
-		{
-			tablePtr = inst_names;
-			numAttrs = num_inst_names;
-		}
-	}
-
-	if (tablePtr != nullptr)
-	{
-		for (U8 i = 0; i < numAttrs; i++)
-		{
-			if (tablePtr[i].value == attr)
-			{
-				entryPtr = &tablePtr[i];
-				break;
-			}
-		}
-	}
-
-	return entryPtr;
-}
-
-static const AttrLookupTable_t* LookupAttrEntry(U8 obj, U16 inst, U8 attr)
-{
-	const AttrLookupTable_t* entryPtr = nullptr;
-
-	for (U8 i = 0; i < sizeof(asAttributeNameTables) / sizeof(AttributeNameTable_t); i++)
-	{
-		if (asAttributeNameTables[i].object_num == obj)
-		{
-			entryPtr = FindAttrEntryInTable(
-				inst,
-				attr,
-				asAttributeNameTables[i].obj_names,
-				asAttributeNameTables[i].num_obj_names,
-				asAttributeNameTables[i].inst_names,
-				asAttributeNameTables[i].num_inst_names);
-
-			break;
-		}
-	}
-
-	return entryPtr;
-}
-
-static const CmdLookupTable_t* FindCmdEntryInTable(U8 cmd, const CmdLookupTable_t* command_names, U8 num_commands)
-{
-	const CmdLookupTable_t* entryPtr = nullptr;
-
-	for (U8 i = 0; i < num_commands; i++)
-	{
-		if (command_names[i].value == cmd)
-		{
-			entryPtr = &command_names[i];
-			break;
-		}
+		tablePtr = asAttributeNameTables[table].inst_names;
+		entry = sAttributeIndex.aabInst[table][attr];
 	}
 
-	return entryPtr;
+	return (entry == NO_ENTRY_INDEX) ? nullptr : &tablePtr[entry];
 }
 
 static const CmdLookupTable_t* LookupCmdEntry(U8 obj, U8 cmd)
 {
 	const CmdLookupTable_t* entryPtr = nullptr;
+	U8 entry;
 
 	cmd &= ABP_MSG_HEADER_CMD_BITS;
 
 	if (IS_CMD_STANDARD(cmd))
 	{
-		for (U8 i = 0; i < NUM_ENTRIES(asCmdNames); i++)
+		entry = sCommandIndex.abStandard[cmd];
+
+		if (entry != NO_ENTRY_INDEX)
 		{
-			if (asCmdNames[i].value == cmd)
-			{
-				entryPtr = &asCmdNames[i];
-				break;
-			}
+			entryPtr = &asCmdNames[entry];
 		}
 	}
 	else if (IS_CMD_OBJECT_SPECIFIC(cmd))
 	{
-		for (U8 i = 0; i < sizeof(asCommandNameTables) / sizeof(CommandNameTable_t); i++)
+		U8 table = sObjectIndex.abCommandTable[obj];
+
+		if (table != NO_ENTRY_INDEX)
 		{
-			if (asCommandNameTables[i].object_num == obj)
-			{
-				entryPtr = FindCmdEntryInTable(
-					cmd,
-					asCommandNameTables[i].cmd_names,
-					asCommandNameTables[i].num_cmd_names);
+			entry = sCommandIndex.aabObjSpecific[table][cmd];
 
-				break;
+			if (entry != NO_ENTRY_INDEX)
+			{
+				entryPtr = &asCommandNameTables[table].cmd_names[entry];
 			}
 		}
 	}
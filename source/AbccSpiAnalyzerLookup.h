@@ -14,12 +14,6 @@
 #include "Analyzer.h"
 #include "AbccSpiAnalyzerTypes.h"
 
-enum class BaseType : U8
-{
-	Character,
-	Numeric
-};
-
 enum class SegmentationType : U8
 {
 	None,
@@ -86,6 +80,16 @@ inline bool IsSegmentedMessage(bool cmd_message, SegmentationType segmentation_t
 		(!cmd_message && (segmentation_type == SegmentationType::Response)));
 }
 
+/* An error response is composed of one to three bytes: the error code, which
+** when object specific is followed by the object and network specific codes.
+** The bytes of an aggregated run of message data flagged as an error response
+** are told apart from the counter and first byte of the run. */
+inline bool IsErrorRspByte(U16 first_msg_data_cnt, U8 first_byte, U16 msg_data_cnt)
+{
+	return ((msg_data_cnt == 0) ||
+		((msg_data_cnt <= 2) && ((first_msg_data_cnt != 0) || (first_byte == (U8)ABP_ERR_OBJ_SPECIFIC))));
+}
+
 NotifEvent_t GetSpiCtrlString(U8 val, char* str, U16 max_str_len, DisplayBase display_base);
 
 NotifEvent_t GetSpiStsString(U8 val, char* str, U16 max_str_len, DisplayBase display_base);
@@ -13,8 +13,10 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "AbccSpiAnalyzerResults.h"
+#include "AbccSpiAnalyzerExport.h"
 #include "AnalyzerHelpers.h"
 #include "AbccSpiAnalyzer.h"
 #include "AbccSpiAnalyzerSettings.h"
@@ -29,18 +31,18 @@
 #define MOSI_TAG_STR          "MOSI-"
 #define MISO_TAG_STR          "MISO-"
 
-#define MOSI_STR              "MOSI"
-#define MISO_STR              "MISO"
+/* Separates the entries of a packet summary */
+#define SUMMARY_SEPARATOR_STR "; "
 
-#define FIRST_FRAG_STR        "FIRST_FRAGMENT"
-#define FRAGMENT_STR          "FRAGMENT"
-#define LAST_FRAG_STR         "LAST_FRAGMENT"
+/* Alerts raised by the pairing of a command and its response */
+#define ORPHANED_RSP_STR      "No Outstanding Command"
+#define DUPLICATED_RSP_STR    "Duplicated Response"
+#define MISMATCHED_RSP_STR    "Response Does Not Match Command"
+#define SUPERSEDED_CMD_STR    "Source ID Reused Before Response"
+#define REUSED_SRC_ID_STR     "Source ID of Outstanding Command Reused"
 
-#define ERROR_RESPONSE_STR    " (ERR_RSP)"
-#define RESPONSE_STR          " (RSP)"
-#define COMMAND_STR           " (CMD)"
-
-#define CSV_DELIMITER         mSettings->mExportDelimiter
+/* Frames (or transactions) exported between checks for cancellation */
+#define EXPORT_PROGRESS_INTERVAL 16384
 
 #ifdef _DEBUG
 /* Dummy macros, the old SDK does not support these */
@@ -51,25 +53,84 @@
 SpiAnalyzerResults::SpiAnalyzerResults(SpiAnalyzer* analyzer, SpiAnalyzerSettings* settings)
 	: AnalyzerResults(),
 	  mSettings(settings),
-	  mAnalyzer(analyzer)
+	  mAnalyzer(analyzer),
+	  mGroupedMessageCount(0)
 {
-	memset(mMsgSizeStr, 0, sizeof(mMsgSizeStr));
-	memset(mMsgSrcStr, 0, sizeof(mMsgSrcStr));
-	memset(mMsgObjStr, 0, sizeof(mMsgObjStr));
-	memset(mMsgInstStr, 0, sizeof(mMsgInstStr));
-	memset(mMsgCmdStr, 0, sizeof(mMsgCmdStr));
-	memset(mMsgExtStr, 0, sizeof(mMsgExtStr));
-	mMsgValidFlag[SpiChannel::MOSI] = false;
-	mMsgValidFlag[SpiChannel::MISO] = false;
-	mMsgErrorRspFlag[SpiChannel::MOSI] = false;
-	mMsgErrorRspFlag[SpiChannel::MISO] = false;
+	mMessages.SetFrameData(&mFrameData);
+	InvalidateText();
 }
 
 SpiAnalyzerResults::~SpiAnalyzerResults()
 {
 }
 
-void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, const char* verbose, NotifEvent_t notification, DisplayPriority disp_priority)
+/* Append an entry to the text of a packet summary, tagged as WriteTabularText(result_text, ) does */
+static void AppendSummaryText(std::string* summary, SpiChannel_t channel, const char* text, NotifEvent_t notification)
+{
+	if (!summary->empty())
+	{
+		summary->append(SUMMARY_SEPARATOR_STR);
+	}
+
+	if (channel == SpiChannel::MOSI)
+	{
+		summary->append(MOSI_TAG_STR);
+	}
+	else if (channel == SpiChannel::MISO)
+	{
+		summary->append(MISO_TAG_STR);
+	}
+
+	if (notification)
+	{
+		summary->append("!");
+	}
+
+	summary->append(text);
+}
+
+void SpiAnalyzerResults::InvalidateText()
+{
+	mTextCache.Clear();
+}
+
+U64 SpiAnalyzerResults::AddFrameData(const U8* data, U32 length)
+{
+	return mFrameData.Append(data, length);
+}
+
+void SpiAnalyzerResults::AddBubbleString(ResultText_t* result_text, const char* str1, const char* str2)
+{
+	result_text->asStrings.push_back(str1);
+
+	if (str2 != nullptr)
+	{
+		result_text->asStrings.back().append(str2);
+	}
+
+	AddResultString(result_text->asStrings.back().c_str());
+}
+
+void SpiAnalyzerResults::AddTabularString(ResultText_t* result_text, const char* str1, const char* str2, const char* str3, const char* str4, const char* str5, const char* str6)
+{
+	const char* strs[] = { str2, str3, str4, str5, str6 };
+
+	result_text->asStrings.push_back(str1);
+
+	for (const char* str : strs)
+	{
+		if (str == nullptr)
+		{
+			break;
+		}
+
+		result_text->asStrings.back().append(str);
+	}
+
+	AddTabularText(result_text->asStrings.back().c_str());
+}
+
+void SpiAnalyzerResults::WriteBubbleText(ResultText_t* result_text, const char* tag, const char* value, const char* verbose, NotifEvent_t notification, DisplayPriority disp_priority)
 {
 	const char alertStr[] = "!ALERT - ";
 	U16 strLenValue, strLenVerbose;
@@ -110,7 +171,7 @@ void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, con
 		if ((notification == NotifEvent::Alert) || disp_priority == DisplayPriority::Tag)
 		{
 			str[1] = '\0';
-			AddResultString(str);
+			AddBubbleString(result_text, str);
 		}
 
 		if (disp_priority == DisplayPriority::Value)
@@ -119,11 +180,11 @@ void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, con
 			{
 				if (notification == NotifEvent::Alert)
 				{
-					AddResultString(alertStr, value);
+					AddBubbleString(result_text, alertStr, value);
 				}
 				else
 				{
-					AddResultString(value);
+					AddBubbleString(result_text, value);
 				}
 			}
 
@@ -138,22 +199,22 @@ void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, con
 
 			if (notification == NotifEvent::Alert)
 			{
-				AddResultString(alertStr, str);
+				AddBubbleString(result_text, alertStr, str);
 			}
 			else
 			{
-				AddResultString(str);
+				AddBubbleString(result_text, str);
 			}
 		}
 		else
 		{
 			if (notification == NotifEvent::Alert)
 			{
-				AddResultString(alertStr, tag);
+				AddBubbleString(result_text, alertStr, tag);
 			}
 			else
 			{
-				AddResultString(tag);
+				AddBubbleString(result_text, tag);
 			}
 
 			if (value)
@@ -169,11 +230,11 @@ void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, con
 
 				if (notification == NotifEvent::Alert)
 				{
-					AddResultString(alertStr, str);
+					AddBubbleString(result_text, alertStr, str);
 				}
 				else
 				{
-					AddResultString(str);
+					AddBubbleString(result_text, str);
 				}
 			}
 		}
@@ -186,11 +247,11 @@ void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, con
 
 			if (notification == NotifEvent::Alert)
 			{
-				AddResultString(alertStr, str);
+				AddBubbleString(result_text, alertStr, str);
 			}
 			else
 			{
-				AddResultString(str);
+				AddBubbleString(result_text, str);
 			}
 		}
 	}
@@ -220,11 +281,11 @@ void SpiAnalyzerResults::WriteBubbleText(const char* tag, const char* value, con
 			}
 		}
 
-		AddResultString(str);
+		AddBubbleString(result_text, str);
 	}
 }
 
-void SpiAnalyzerResults::WriteTabularText(SpiChannel_t channel, const char* text, NotifEvent_t notification)
+void SpiAnalyzerResults::WriteTabularText(ResultText_t* result_text, SpiChannel_t channel, const char* text, NotifEvent_t notification)
 {
 	char str[FORMATTED_STRING_BUFFER_SIZE];
 	const char *prefix;
@@ -254,7 +315,7 @@ void SpiAnalyzerResults::WriteTabularText(SpiChannel_t channel, const char* text
 		SNPRINTF(str, sizeof(str), "%s%s", prefix, text);
 	}
 
-	AddTabularText(str);
+	AddTabularString(result_text, str);
 }
 
 void SpiAnalyzerResults::FormatTabularTextBuffer(char* buffer, size_t buffer_size, const char* tag, const char* text, NotifEvent_t notification)
@@ -269,37 +330,45 @@ void SpiAnalyzerResults::FormatTabularTextBuffer(char* buffer, size_t buffer_siz
 	}
 }
 
-bool SpiAnalyzerResults::BuildCmdString(U8 command, U8 obj, DisplayBase display_base)
+bool SpiAnalyzerResults::BuildCmdString(ResultText_t* result_text, U8 command, U8 obj, const char* transaction_alert, DisplayBase display_base)
 {
 	bool errorRspMsg;
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetCmdString(command, obj, verboseStr, sizeof(verboseStr), display_base);
 
+	if (transaction_alert != nullptr)
+	{
+		size_t length = strlen(verboseStr);
+
+		SNPRINTF(&verboseStr[length], sizeof(verboseStr) - length, ", %s", transaction_alert);
+		notification = NotifEvent::Alert;
+	}
+
 	GetNumberString(command, display_base, GET_MSG_FRAME_BITSIZE(AbccMsgField::Command), numberStr, sizeof(numberStr), BaseType::Numeric);
 
 	if ((command & ABP_MSG_HEADER_E_BIT) == ABP_MSG_HEADER_E_BIT)
 	{
 		errorRspMsg = true;
-		WriteBubbleText("ERR_RSP", numberStr, verboseStr, NotifEvent::Alert);
+		WriteBubbleText(result_text, "ERR_RSP", numberStr, verboseStr, NotifEvent::Alert);
 	}
 	else
 	{
 		errorRspMsg = false;
 		if ((command & ABP_MSG_HEADER_C_BIT) == ABP_MSG_HEADER_C_BIT)
 		{
-			WriteBubbleText("CMD", numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, "CMD", numberStr, verboseStr, notification);
 		}
 		else
 		{
-			WriteBubbleText("RSP", numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, "RSP", numberStr, verboseStr, notification);
 		}
 	}
 
 	return errorRspMsg;
 }
 
-void SpiAnalyzerResults::BuildInstString(U8 nw_type_idx, U8 obj, U16 inst, DisplayBase display_base)
+void SpiAnalyzerResults::BuildInstString(ResultText_t* result_text, U8 nw_type_idx, U8 obj, U16 inst, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
@@ -312,15 +381,15 @@ void SpiAnalyzerResults::BuildInstString(U8 nw_type_idx, U8 obj, U16 inst, Displ
 
 	if (instFound)
 	{
-		WriteBubbleText(GET_MSG_FRAME_TAG(AbccMsgField::Instance), numberStr, verboseStr, notification);
+		WriteBubbleText(result_text, GET_MSG_FRAME_TAG(AbccMsgField::Instance), numberStr, verboseStr, notification);
 	}
 	else
 	{
-		WriteBubbleText(GET_MSG_FRAME_TAG(AbccMsgField::Instance), numberStr, nullptr, NotifEvent::None);
+		WriteBubbleText(result_text, GET_MSG_FRAME_TAG(AbccMsgField::Instance), numberStr, nullptr, NotifEvent::None);
 	}
 }
 
-void SpiAnalyzerResults::BuildAttrString(const MsgHeaderInfo_t* msg_header_ptr, U16 attr, AttributeAccessMode_t access_mode, DisplayBase display_base)
+void SpiAnalyzerResults::BuildAttrString(ResultText_t* result_text, const MsgHeaderInfo_t* msg_header_ptr, U16 attr, AttributeAccessMode_t access_mode, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
@@ -332,51 +401,51 @@ void SpiAnalyzerResults::BuildAttrString(const MsgHeaderInfo_t* msg_header_ptr,
 
 	if (attrFound)
 	{
-		WriteBubbleText(GET_MSG_FRAME_TAG(AbccMsgField::CommandExtension), numberStr, verboseStr, notification);
+		WriteBubbleText(result_text, GET_MSG_FRAME_TAG(AbccMsgField::CommandExtension), numberStr, verboseStr, notification);
 	}
 	else
 	{
-		WriteBubbleText(GET_MSG_FRAME_TAG(AbccMsgField::CommandExtension), numberStr, nullptr, NotifEvent::None);
+		WriteBubbleText(result_text, GET_MSG_FRAME_TAG(AbccMsgField::CommandExtension), numberStr, nullptr, NotifEvent::None);
 	}
 }
 
-void SpiAnalyzerResults::BuildObjectString(U8 object_num, DisplayBase display_base)
+void SpiAnalyzerResults::BuildObjectString(ResultText_t* result_text, U8 object_num, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetObjectString(object_num, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(object_num, display_base, GET_MSG_FRAME_BITSIZE(AbccMsgField::Object), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText(GET_MSG_FRAME_TAG(AbccMsgField::Object), numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, GET_MSG_FRAME_TAG(AbccMsgField::Object), numberStr, verboseStr, notification);
 }
 
-void SpiAnalyzerResults::BuildSpiCtrlString(U8 spi_control, DisplayBase display_base)
+void SpiAnalyzerResults::BuildSpiCtrlString(ResultText_t* result_text, U8 spi_control, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetSpiCtrlString(spi_control, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(spi_control, display_base, GET_MOSI_FRAME_BITSIZE(AbccMosiStates::SpiControl), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText(GET_MOSI_FRAME_TAG(AbccMosiStates::SpiControl), numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(AbccMosiStates::SpiControl), numberStr, verboseStr, notification);
 }
 
-void SpiAnalyzerResults::BuildSpiStsString(U8 spi_status, DisplayBase display_base)
+void SpiAnalyzerResults::BuildSpiStsString(ResultText_t* result_text, U8 spi_status, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetSpiStsString(spi_status, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(spi_status, display_base, GET_MISO_FRAME_BITSIZE(AbccMisoStates::SpiStatus), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText(GET_MISO_FRAME_TAG(AbccMisoStates::SpiStatus), numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, GET_MISO_FRAME_TAG(AbccMisoStates::SpiStatus), numberStr, verboseStr, notification);
 }
 
-void SpiAnalyzerResults::BuildErrorRsp(U8 error_code, DisplayBase display_base)
+void SpiAnalyzerResults::BuildErrorRsp(ResultText_t* result_text, U8 error_code, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetErrorRspString(error_code, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(error_code, display_base, SIZE_IN_BITS(error_code), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText("ERR_CODE", numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, "ERR_CODE", numberStr, verboseStr, notification);
 }
 
-void SpiAnalyzerResults::BuildErrorRsp(bool nw_spec_err, U8 nw_type_idx, U8 obj, U8 error_code, DisplayBase display_base)
+void SpiAnalyzerResults::BuildErrorRsp(ResultText_t* result_text, bool nw_spec_err, U8 nw_type_idx, U8 obj, U8 error_code, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
@@ -385,42 +454,91 @@ void SpiAnalyzerResults::BuildErrorRsp(bool nw_spec_err, U8 nw_type_idx, U8 obj,
 
 	if (nw_spec_err)
 	{
-		WriteBubbleText("NW_ERR", numberStr, verboseStr, notification);
+		WriteBubbleText(result_text, "NW_ERR", numberStr, verboseStr, notification);
 	}
 	else
 	{
-		WriteBubbleText("OBJ_ERR", numberStr, verboseStr, notification);
+		WriteBubbleText(result_text, "OBJ_ERR", numberStr, verboseStr, notification);
 	}
 }
 
-void SpiAnalyzerResults::BuildIntMask(U8 int_mask, DisplayBase display_base)
+void SpiAnalyzerResults::BuildIntMask(ResultText_t* result_text, U8 int_mask, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetIntMaskString(int_mask, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(int_mask, display_base, GET_MOSI_FRAME_BITSIZE(AbccMosiStates::InterruptMask), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText(GET_MOSI_FRAME_TAG(AbccMosiStates::InterruptMask), numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(AbccMosiStates::InterruptMask), numberStr, verboseStr, notification);
 }
 
-void SpiAnalyzerResults::BuildAbccStatus(U8 abcc_status, DisplayBase display_base)
+void SpiAnalyzerResults::BuildAbccStatus(ResultText_t* result_text, U8 abcc_status, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetAbccStatusString(abcc_status, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(abcc_status, display_base, GET_MISO_FRAME_BITSIZE(AbccMisoStates::AnybusStatus), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText(GET_MISO_FRAME_TAG(AbccMisoStates::AnybusStatus), numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, GET_MISO_FRAME_TAG(AbccMisoStates::AnybusStatus), numberStr, verboseStr, notification);
 }
 
-void SpiAnalyzerResults::BuildApplStatus(U8 appl_status, DisplayBase display_base)
+void SpiAnalyzerResults::BuildApplStatus(ResultText_t* result_text, U8 appl_status, DisplayBase display_base)
 {
 	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
 	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
 	NotifEvent_t notification = GetApplStsString(appl_status, verboseStr, sizeof(verboseStr), display_base);
 	GetNumberString(appl_status, display_base, GET_MOSI_FRAME_BITSIZE(AbccMosiStates::ApplicationStatus), numberStr, sizeof(numberStr), BaseType::Numeric);
-	WriteBubbleText(GET_MOSI_FRAME_TAG(AbccMosiStates::ApplicationStatus), numberStr, verboseStr, notification);
+	WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(AbccMosiStates::ApplicationStatus), numberStr, verboseStr, notification);
+}
+
+/*
+** The flags of a response are final once it is correlated with its command,
+** while a command may be superseded until it is answered. The text of a
+** header is not cached as long as its alert may still change.
+*/
+const char* SpiAnalyzerResults::GetTransactionAlert(ResultText_t* result_text, SpiChannel_t channel, U64 frame_index)
+{
+	U64 messageIndex = mMessages.FindMessage(channel, frame_index);
+	AbccTransaction_t transaction;
+
+	if ((messageIndex == INVALID_MESSAGE_INDEX) ||
+		!mTransactions.GetTransaction(mTransactions.GetMessageTransaction(messageIndex), &transaction))
+	{
+		// The message may not be complete, or not correlated yet
+		result_text->fCacheable = false;
+		return nullptr;
+	}
+
+	if (transaction.lResponseMessage == messageIndex)
+	{
+		if (transaction.bFlags & ABCC_TRANSACTION_ORPHANED_FLAG)
+		{
+			return ORPHANED_RSP_STR;
+		}
+		else if (transaction.bFlags & ABCC_TRANSACTION_DUPLICATED_FLAG)
+		{
+			return DUPLICATED_RSP_STR;
+		}
+		else if (transaction.bFlags & ABCC_TRANSACTION_MISMATCH_FLAG)
+		{
+			return MISMATCHED_RSP_STR;
+		}
+
+		return nullptr;
+	}
+
+	if (transaction.bFlags & ABCC_TRANSACTION_SUPERSEDED_FLAG)
+	{
+		return SUPERSEDED_CMD_STR;
+	}
+
+	if (transaction.lResponseMessage == INVALID_MESSAGE_INDEX)
+	{
+		result_text->fCacheable = false;
+	}
+
+	return nullptr;
 }
 
-void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase display_base)
+void SpiAnalyzerResults::GenerateMessageBubbleText(ResultText_t* result_text, SpiChannel_t channel, U64 frame_index, Frame &frame, DisplayBase display_base)
 {
 	NotifEvent_t notification = NotifEvent::None;
 	AbccSpiStatesUnion_t uState;
@@ -445,7 +563,7 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 				SNPRINTF(verboseStr, sizeof(verboseStr), "%d Bytes", (U16)frame.mData1);
 			}
 
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
 
 			break;
 		}
@@ -459,26 +577,26 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 				notification = NotifEvent::Alert;
 			}
 
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
 
 			break;
 		}
 
 		case AbccMisoStates::MessageField_SourceId:
 			GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), BaseType::Numeric);
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, nullptr, notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, nullptr, notification);
 			break;
 
 		case AbccMisoStates::MessageField_Object:
-			BuildObjectString((U8)frame.mData1, display_base);
+			BuildObjectString(result_text, (U8)frame.mData1, display_base);
 			break;
 
 		case AbccMisoStates::MessageField_Instance:
-			BuildInstString((U8)mSettings->mNetworkType, (U8)frame.mData2, (U16)frame.mData1, display_base);
+			BuildInstString(result_text, (U8)mSettings->mNetworkType, (U8)frame.mData2, (U16)frame.mData1, display_base);
 			break;
 
 		case AbccMisoStates::MessageField_Command:
-			BuildCmdString((U8)frame.mData1, (U8)frame.mData2, display_base);
+			BuildCmdString(result_text, (U8)frame.mData1, (U8)frame.mData2, GetTransactionAlert(result_text, channel, frame_index), display_base);
 			break;
 
 		case AbccMisoStates::MessageField_Reserved2:
@@ -490,7 +608,7 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 				notification = NotifEvent::Alert;
 			}
 
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
 
 			break;
 		}
@@ -502,11 +620,11 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 
 			if (IsNonIndexedAttributeCmd(psMsgHdr->cmd))
 			{
-				BuildAttrString(psMsgHdr, cmdExt, AttributeAccessMode::Normal, display_base);
+				BuildAttrString(result_text, psMsgHdr, cmdExt, AttributeAccessMode::Normal, display_base);
 			}
 			else if (IsIndexedAttributeCmd(psMsgHdr->cmd))
 			{
-				BuildAttrString(psMsgHdr, cmdExt, AttributeAccessMode::Indexed, display_base);
+				BuildAttrString(result_text, psMsgHdr, cmdExt, AttributeAccessMode::Indexed, display_base);
 			}
 			else
 			{
@@ -574,7 +692,7 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 					verboseStrPtr = nullptr;
 				}
 
-				WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStrPtr, notification);
+				WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStrPtr, notification);
 			}
 
 			break;
@@ -584,6 +702,13 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 		case AbccMisoStates::MessageField_Data:
 		{
 			MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
+			U8 data = (U8)frame.mData1;
+
+			if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+			{
+				/* The leading byte of a run holds the error or exception code */
+				mFrameData.Read(GET_AGGREGATED_FRAME_OFFSET(frame.mData1), &data, 1);
+			}
 
 			if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
 			{
@@ -594,7 +719,7 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 
 				if (info->msgDataCnt == 0)
 				{
-					BuildErrorRsp((U8)frame.mData1, display_base);
+					BuildErrorRsp(result_text, data, display_base);
 				}
 				else
 				{
@@ -607,7 +732,7 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 						nwTypeIdx = static_cast<U8>(mSettings->mNetworkType);
 					}
 
-					BuildErrorRsp(nwSpecificError, nwTypeIdx, info->msgHeader.obj, (U8)frame.mData1, display_base);
+					BuildErrorRsp(result_text, nwSpecificError, nwTypeIdx, info->msgHeader.obj, data, display_base);
 				}
 			}
 			else
@@ -633,24 +758,28 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 
 					if (GetExceptionTableIndex(nwObject, (U8)mSettings->mNetworkType, &info->msgHeader, &tableIndex))
 					{
-						notification = GetExceptionString(nwObject, tableIndex, (U8)frame.mData1, verboseStr, sizeof(verboseStr), display_base);
+						notification = GetExceptionString(nwObject, tableIndex, data, verboseStr, sizeof(verboseStr), display_base);
 						exception = true;
 					}
 				}
 
-				GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), type);
+				GetNumberString(data, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), type);
 
 				if (exception)
 				{
 					if (nwObject)
 					{
-						WriteBubbleText("EXC_INFO", numberStr, verboseStr, notification);
+						WriteBubbleText(result_text, "EXC_INFO", numberStr, verboseStr, notification);
 					}
 					else
 					{
-						WriteBubbleText("EXC_CODE", numberStr, verboseStr, notification);
+						WriteBubbleText(result_text, "EXC_CODE", numberStr, verboseStr, notification);
 					}
 				}
+				else if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+				{
+					GenerateBlockBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), frame, display_base, type, info->msgDataCnt, mSettings->mMsgDataPriority);
+				}
 				else
 				{
 					SNPRINTF(verboseStr, sizeof(verboseStr), " [%s] Byte #%d ", numberStr, info->msgDataCnt);
@@ -659,11 +788,11 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 					{
 						/* Conditionally trim the leading 0x specifier */
 						U8 offset = (display_base == DisplayBase::Hexadecimal) ? 2 : 0;
-						WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), &numberStr[offset], verboseStr, notification, DisplayPriority::Value);
+						WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), &numberStr[offset], verboseStr, notification, DisplayPriority::Value);
 					}
 					else
 					{
-						WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
+						WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
 					}
 				}
 
@@ -677,7 +806,43 @@ void SpiAnalyzerResults::GenerateMessageBubbleText(Frame &frame, DisplayBase dis
 	}
 }
 
-void SpiAnalyzerResults::GenerateMisoBubbleText(Frame &frame, DisplayBase display_base)
+void SpiAnalyzerResults::GenerateBlockBubbleText(ResultText_t* result_text, const char* tag, Frame &frame, DisplayBase display_base, BaseType type, U32 first_byte, DisplayPriority priority)
+{
+	U8 data[MAX_BLOCK_BUBBLE_TEXT_BYTES];
+	char numberStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
+	char valueStr[FORMATTED_STRING_BUFFER_SIZE] = "";
+	char verboseStr[FORMATTED_STRING_BUFFER_SIZE];
+	U32 length = GET_AGGREGATED_FRAME_LENGTH(frame.mData1);
+	U32 count = (length < sizeof(data)) ? length : (U32)sizeof(data);
+	size_t textLength = 0;
+
+	count = mFrameData.Read(GET_AGGREGATED_FRAME_OFFSET(frame.mData1), data, count);
+
+	/* List the leading bytes of the block, as many as fit */
+	for (U32 i = 0; i < count; i++)
+	{
+		GetNumberString(data[i], display_base, BITS_PER_BYTE, numberStr, sizeof(numberStr), type);
+
+		if ((textLength + strlen(numberStr) + 5) >= sizeof(valueStr))
+		{
+			count = i;
+			break;
+		}
+
+		textLength += SNPRINTF(&valueStr[textLength], sizeof(valueStr) - textLength, (i == 0) ? "%s" : " %s", numberStr);
+	}
+
+	if (count < length)
+	{
+		SNPRINTF(&valueStr[textLength], sizeof(valueStr) - textLength, " ...");
+	}
+
+	SNPRINTF(verboseStr, sizeof(verboseStr), " [%s] Bytes #%u-#%u ", valueStr, first_byte, first_byte + length - 1);
+
+	WriteBubbleText(result_text, tag, valueStr, verboseStr, NotifEvent::None, priority);
+}
+
+void SpiAnalyzerResults::GenerateMisoBubbleText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base)
 {
 	NotifEvent_t notification = NotifEvent::None;
 	AbccSpiStatesUnion_t uState;
@@ -700,33 +865,33 @@ void SpiAnalyzerResults::GenerateMisoBubbleText(Frame &frame, DisplayBase displa
 				notification = NotifEvent::Alert;
 			}
 
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
 
 			break;
 		}
 
 		case AbccMisoStates::Reserved2:
 			GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), BaseType::Numeric);
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, "Reserved", notification);
 			break;
 
 		case AbccMisoStates::LedStatus:
 			GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), BaseType::Numeric);
 			notification = GetLedStatusString((U16)frame.mData1, verboseStr, sizeof(verboseStr), display_base);
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
 			break;
 
 		case AbccMisoStates::AnybusStatus:
-			BuildAbccStatus((U8)frame.mData1, display_base);
+			BuildAbccStatus(result_text, (U8)frame.mData1, display_base);
 			break;
 
 		case AbccMisoStates::SpiStatus:
-			BuildSpiStsString((U8)frame.mData1, display_base);
+			BuildSpiStsString(result_text, (U8)frame.mData1, display_base);
 			break;
 
 		case AbccMisoStates::NetworkTime:
 			GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), BaseType::Numeric);
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, nullptr, notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, nullptr, notification);
 			break;
 
 		case AbccMisoStates::MessageField_Size:
@@ -739,16 +904,29 @@ void SpiAnalyzerResults::GenerateMisoBubbleText(Frame &frame, DisplayBase displa
 		case AbccMisoStates::MessageField_CommandExtension:
 		case AbccMisoStates::MessageField:
 		case AbccMisoStates::MessageField_Data:
-			GenerateMessageBubbleText(frame, display_base);
+			GenerateMessageBubbleText(result_text, SpiChannel::MISO, frame_index, frame, display_base);
 			break;
 
 		case AbccMisoStates::MessageField_DataNotValid:
+			if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+			{
+				MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
+				GenerateBlockBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), frame, display_base, BaseType::Numeric, info->msgDataCnt, DisplayPriority::Tag);
+				break;
+			}
+
 			AnalyzerHelpers::GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(AbccMisoStates::MessageField_Data), numberStr, sizeof(numberStr));
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, nullptr, notification, DisplayPriority::Tag);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, nullptr, notification, DisplayPriority::Tag);
 			break;
 
 		case AbccMisoStates::ReadProcessData:
 		{
+			if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+			{
+				GenerateBlockBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), frame, display_base, BaseType::Numeric, (U32)frame.mData2, mSettings->mProcessDataPriority);
+				break;
+			}
+
 			GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(uState.eMiso), numberStr, sizeof(numberStr), BaseType::Numeric);
 			SNPRINTF(verboseStr, sizeof(verboseStr), " [%s] Byte #%lld ", numberStr, frame.mData2);
 
@@ -756,11 +934,11 @@ void SpiAnalyzerResults::GenerateMisoBubbleText(Frame &frame, DisplayBase displa
 			{
 				/* Conditionally trim the leading 0x specifier */
 				U8 offset = (display_base == DisplayBase::Hexadecimal) ? 2 : 0;
-				WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), &numberStr[offset], verboseStr, notification, DisplayPriority::Value);
+				WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), &numberStr[offset], verboseStr, notification, DisplayPriority::Value);
 			}
 			else
 			{
-				WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
+				WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
 			}
 
 			break;
@@ -780,19 +958,19 @@ void SpiAnalyzerResults::GenerateMisoBubbleText(Frame &frame, DisplayBase displa
 				SNPRINTF(verboseStr, sizeof(verboseStr), "Received 0x%08X == Calculated 0x%08X", (U32)(frame.mData1), (U32)(frame.mData2));
 			}
 
-			WriteBubbleText(GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, GET_MISO_FRAME_TAG(uState.eMiso), numberStr, verboseStr, notification);
 			break;
 		}
 
 		default:
 			GetNumberString(frame.mData1, display_base, 8, numberStr, sizeof(numberStr), BaseType::Numeric);
 			notification = NotifEvent::Alert;
-			WriteBubbleText("UNKNOWN", numberStr, "Internal Error: Unknown State", notification);
+			WriteBubbleText(result_text, "UNKNOWN", numberStr, "Internal Error: Unknown State", notification);
 			break;
 	}
 }
 
-void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase display_base)
+void SpiAnalyzerResults::GenerateMosiBubbleText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base)
 {
 	NotifEvent_t notification = NotifEvent::None;
 	AbccSpiStatesUnion_t uState;
@@ -807,7 +985,7 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 			break;
 
 		case AbccMosiStates::SpiControl:
-			BuildSpiCtrlString((U8)frame.mData1, display_base);
+			BuildSpiCtrlString(result_text, (U8)frame.mData1, display_base);
 			break;
 
 		case AbccMosiStates::Reserved1:
@@ -819,7 +997,7 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 				notification = NotifEvent::Alert;
 			}
 
-			WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, "Reserved", notification);
+			WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, "Reserved", notification);
 
 			break;
 		}
@@ -827,21 +1005,21 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 		case AbccMosiStates::MessageLength:
 			GetNumberString(frame.mData1, display_base, GET_MOSI_FRAME_BITSIZE(uState.eMosi), numberStr, sizeof(numberStr), BaseType::Numeric);
 			SNPRINTF(verboseStr, sizeof(verboseStr), "%d Words", (U16)frame.mData1);
-			WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
 			break;
 
 		case AbccMosiStates::ProcessDataLength:
 			GetNumberString(frame.mData1, display_base, GET_MOSI_FRAME_BITSIZE(uState.eMosi), numberStr, sizeof(numberStr), BaseType::Numeric);
 			SNPRINTF(verboseStr, sizeof(verboseStr), "%d Words", (U16)frame.mData1);
-			WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
 			break;
 
 		case AbccMosiStates::ApplicationStatus:
-			BuildApplStatus((U8)frame.mData1, display_base);
+			BuildApplStatus(result_text, (U8)frame.mData1, display_base);
 			break;
 
 		case AbccMosiStates::InterruptMask:
-			BuildIntMask((U8)frame.mData1, display_base);
+			BuildIntMask(result_text, (U8)frame.mData1, display_base);
 			break;
 
 		case AbccMosiStates::MessageField_Size:
@@ -854,16 +1032,29 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 		case AbccMosiStates::MessageField_CommandExtension:
 		case AbccMosiStates::MessageField:
 		case AbccMosiStates::MessageField_Data:
-			GenerateMessageBubbleText(frame, display_base);
+			GenerateMessageBubbleText(result_text, SpiChannel::MOSI, frame_index, frame, display_base);
 			break;
 
 		case AbccMosiStates::MessageField_DataNotValid:
+			if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+			{
+				MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
+				GenerateBlockBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), frame, display_base, BaseType::Numeric, info->msgDataCnt, DisplayPriority::Tag);
+				break;
+			}
+
 			AnalyzerHelpers::GetNumberString(frame.mData1, display_base, GET_MOSI_FRAME_BITSIZE(AbccMosiStates::MessageField_Data), numberStr, sizeof(numberStr));
-			WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, nullptr, notification, DisplayPriority::Tag);
+			WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, nullptr, notification, DisplayPriority::Tag);
 			break;
 
 		case AbccMosiStates::WriteProcessData:
 		{
+			if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
+			{
+				GenerateBlockBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), frame, display_base, BaseType::Numeric, (U32)frame.mData2, mSettings->mProcessDataPriority);
+				break;
+			}
+
 			GetNumberString(frame.mData1, display_base, GET_MOSI_FRAME_BITSIZE(uState.eMosi), numberStr, sizeof(numberStr), BaseType::Numeric);
 			SNPRINTF(verboseStr, sizeof(verboseStr), " [%s] Byte #%lld ", numberStr, frame.mData2);
 
@@ -871,11 +1062,11 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 			{
 				/* Conditionally trim the leading 0x specifier */
 				U8 offset = (display_base == DisplayBase::Hexadecimal) ? 2 : 0;
-				WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), &numberStr[offset], verboseStr, notification, DisplayPriority::Value);
+				WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), &numberStr[offset], verboseStr, notification, DisplayPriority::Value);
 			}
 			else
 			{
-				WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
+				WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
 			}
 
 			break;
@@ -895,7 +1086,7 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 				SNPRINTF(verboseStr, sizeof(verboseStr), "Received 0x%08X == Calculated 0x%08X", (U32)(frame.mData1 & 0xFFFFFFFF), (U32)(frame.mData2 & 0xFFFFFFFF));
 			}
 
-			WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
+			WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, verboseStr, notification);
 
 			break;
 		}
@@ -909,7 +1100,7 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 				notification = NotifEvent::Alert;
 			}
 
-			WriteBubbleText(GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, nullptr, notification);
+			WriteBubbleText(result_text, GET_MOSI_FRAME_TAG(uState.eMosi), numberStr, nullptr, notification);
 
 			break;
 		}
@@ -917,18 +1108,47 @@ void SpiAnalyzerResults::GenerateMosiBubbleText(Frame &frame, DisplayBase displa
 		default:
 			GetNumberString(frame.mData1, display_base, 8, numberStr, sizeof(numberStr), BaseType::Numeric);
 			notification = NotifEvent::Alert;
-			WriteBubbleText("UNKNOWN", numberStr, "Internal Error: Unknown State", notification);
+			WriteBubbleText(result_text, "UNKNOWN", numberStr, "Internal Error: Unknown State", notification);
 			break;
 	}
 }
 
 void SpiAnalyzerResults::GenerateBubbleText(U64 frame_index, Channel &channel, DisplayBase display_base)
 {
+	SpiChannel_t textChannel = SpiChannel::NotSpecified;
+	ResultText_t resultText;
+
+	if (channel == mSettings->mMosiChannel)
+	{
+		textChannel = SpiChannel::MOSI;
+	}
+	else if (channel == mSettings->mMisoChannel)
+	{
+		textChannel = SpiChannel::MISO;
+	}
+
+	U64 key = AbccTextCache::GetKey(frame_index, TextKind::Bubble, textChannel, display_base);
+	U32 generation = mTextCache.GetGeneration();
+
 	ClearResultStrings();
+
+	if (mTextCache.Find(key, &resultText.asStrings))
+	{
+		for (const std::string& str : resultText.asStrings)
+		{
+			AddResultString(str.c_str());
+		}
+
+		return;
+	}
+
 	Frame frame = GetFrame(frame_index);
 	AbccSpiStatesUnion_t uState;
 	uState.eMosi = (AbccMosiStates::Enum)frame.mType;
 
+	// Cleared by the frames whose text depends on transactions that may still change
+	resultText.fCacheable = true;
+
 	if (frame.HasFlag(SPI_ERROR_FLAG))
 	{
 		NotifEvent_t notification = NotifEvent::Alert;
@@ -940,19 +1160,19 @@ void SpiAnalyzerResults::GenerateBubbleText(U64 frame_index, Channel &channel, D
 				if ((IS_MISO_FRAME(frame) && (channel == mSettings->mMisoChannel)) ||
 					(IS_MOSI_FRAME(frame) && (channel == mSettings->mMosiChannel)))
 				{
-					WriteBubbleText("FRAGMENT", nullptr, "Fragmented ABCC SPI Packet.", notification);
+					WriteBubbleText(&resultText, "FRAGMENT", nullptr, "Fragmented ABCC SPI Packet.", notification);
 				}
 
 				break;
 			}
 
 			case AbccSpiError::EndOfTransfer:
-				WriteBubbleText("CLOCKING", nullptr, "ABCC SPI Clocking. The analyzer expects one transaction per 'Active Enable' phase.", notification);
+				WriteBubbleText(&resultText, "CLOCKING", nullptr, "ABCC SPI Clocking. The analyzer expects one transaction per 'Active Enable' phase.", notification);
 				break;
 
 			case AbccSpiError::Generic:
 			default:
-				WriteBubbleText("ERROR", nullptr, "ABCC SPI Error.", notification);
+				WriteBubbleText(&resultText, "ERROR", nullptr, "ABCC SPI Error.", notification);
 				break;
 		}
 	}
@@ -960,1146 +1180,348 @@ void SpiAnalyzerResults::GenerateBubbleText(U64 frame_index, Channel &channel, D
 	{
 		if ((channel == mSettings->mMosiChannel) && IS_MOSI_FRAME(frame))
 		{
-			GenerateMosiBubbleText(frame, display_base);
+			GenerateMosiBubbleText(&resultText, frame_index, frame, display_base);
 		}
 		else if ((channel == mSettings->mMisoChannel) && IS_MISO_FRAME(frame))
 		{
-			GenerateMisoBubbleText(frame, display_base);
+			GenerateMisoBubbleText(&resultText, frame_index, frame, display_base);
 		}
 	}
+
+	if (resultText.fCacheable)
+	{
+		mTextCache.Insert(key, generation, &resultText.asStrings);
+	}
 }
 
-void SpiAnalyzerResults::ExportAllFramesToFile(const char* file, DisplayBase display_base)
+void SpiAnalyzerResults::GroupTransactionPackets()
 {
-	std::stringstream ss;
-	void *f = AnalyzerHelpers::StartFile(file);
+	U64 messageCount = mMessages.GetMessageCount();
+	AbccTransaction_t transaction;
+	AbccMessage_t message;
 
-	U64 triggerSample = mAnalyzer->GetTriggerSample();
-	U32 sampleRate = mAnalyzer->GetSampleRate();
-	U64 numFrames = GetNumFrames();
+	for (; mGroupedMessageCount < messageCount; mGroupedMessageCount++)
+	{
+		U64 transactionIndex = mTransactions.GetMessageTransaction(mGroupedMessageCount);
+
+		if (!mTransactions.GetTransaction(transactionIndex, &transaction) ||
+			!mMessages.GetMessage(mGroupedMessageCount, &message))
+		{
+			// Not correlated yet
+			break;
+		}
+
+		// A transaction is complete with its response, commands that are
+		// never answered are not grouped
+		if (transaction.lResponseMessage != mGroupedMessageCount)
+		{
+			continue;
+		}
+
+		if (transaction.lCommandMessage != INVALID_MESSAGE_INDEX)
+		{
+			AbccMessage_t command;
+
+			if (mMessages.GetMessage(transaction.lCommandMessage, &command))
+			{
+				GroupMessagePackets(transactionIndex, command);
+			}
+		}
 
-	ss << "Channel" + CSV_DELIMITER +
-		  "Time [s]" + CSV_DELIMITER +
-		  "Packet ID" + CSV_DELIMITER +
-		  "Frame Type" + CSV_DELIMITER +
-		  "Frame Data"
-	   << std::endl;
+		GroupMessagePackets(transactionIndex, message);
+	}
+}
 
-	for (U32 i = 0; i < numFrames; i++)
+void SpiAnalyzerResults::GroupMessagePackets(U64 transaction_index, const AbccMessage_t& message)
+{
+	if ((message.lLastPacketId == INVALID_RESULT_INDEX) || (message.lFirstPacketId > message.lLastPacketId))
 	{
-		Frame frame = GetFrame(i);
-		U64 packetId = GetPacketContainingFrameSequential(i);
-		char timestampStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-		char frameDataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE] = "";
+		return;
+	}
 
-		AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, triggerSample, sampleRate, timestampStr, sizeof(timestampStr));
+	if (mafGroupedPackets.size() <= message.lLastPacketId)
+	{
+		mafGroupedPackets.resize((size_t)message.lLastPacketId + 1, false);
+	}
 
-		if (frame.HasFlag(SPI_ERROR_FLAG))
+	for (U64 packetId = message.lFirstPacketId; packetId <= message.lLastPacketId; packetId++)
+	{
+		if (!mafGroupedPackets[(size_t)packetId])
 		{
-			ss << "ERROR";
+			mafGroupedPackets[(size_t)packetId] = true;
+			AddPacketToTransaction(transaction_index, packetId);
 		}
-		else
+	}
+}
+
+void SpiAnalyzerResults::GenerateExportFile(const char* file, DisplayBase display_base, U32 export_type_user_id)
+{
+	SpiAnalyzerExport exporter(
+		static_cast<ExportType>(export_type_user_id),
+		display_base,
+		mSettings->mExportDelimiter,
+		mSettings->mNetworkType,
+		mAnalyzer->GetSampleRate(),
+		mAnalyzer->GetTriggerSample());
+	std::vector<Frame> packetFrames;
+	U64 numFrames = GetNumFrames();
+	U64 nextProgress = EXPORT_PROGRESS_INTERVAL;
+	U64 i = 0;
+
+	exporter.SetFrameData(&mFrameData);
+	exporter.SetTransactions(&mMessages, &mTransactions);
+	exporter.SetJitterOptions(mSettings->mTimestampIndexing, (U32)mSettings->mJitterNominalCycleNs, (U32)mSettings->mJitterThresholdNs);
+	exporter.SetProcessDataChangesOnly(mSettings->mProcessDataChangesOnly);
+	exporter.Start(file);
+
+	if (static_cast<ExportType>(export_type_user_id) == ExportType::Latency)
+	{
+		/* The statistics are built from the transactions, not the frames */
+		U64 numTransactions = mTransactions.GetTransactionCount();
+		AbccTransaction_t transaction;
+
+		for (U64 t = 0; t < numTransactions; t++)
 		{
-			if (IS_MOSI_FRAME(frame))
+			if (mTransactions.GetTransaction(t, &transaction))
 			{
-				ss << MOSI_STR;
+				exporter.AddTransaction(transaction);
 			}
-			else
+
+			if (((t % EXPORT_PROGRESS_INTERVAL) == 0) &&
+				(UpdateExportProgressAndCheckForCancel(t, numTransactions) == true))
 			{
-				ss << MISO_STR;
+				exporter.End();
+				return;
 			}
-
-			AnalyzerHelpers::GetNumberString(frame.mData1, display_base, GET_MOSI_FRAME_BITSIZE(frame.mType), frameDataStr, sizeof(frameDataStr));
 		}
 
-		ss << CSV_DELIMITER << timestampStr;
+		UpdateExportProgressAndCheckForCancel(numTransactions, numTransactions);
+		exporter.End();
+		return;
+	}
+
+	while (i < numFrames)
+	{
+		U64 packetId = GetPacketContainingFrameSequential(i);
 
 		if (packetId != INVALID_RESULT_INDEX)
 		{
-			ss << CSV_DELIMITER << packetId << CSV_DELIMITER;
+			U64 firstFrameId;
+			U64 lastFrameId;
+
+			GetFramesContainedInPacket(packetId, &firstFrameId, &lastFrameId);
+
+			packetFrames.clear();
+
+			for (U64 frameId = firstFrameId; frameId <= lastFrameId; frameId++)
+			{
+				packetFrames.push_back(GetFrame(frameId));
+			}
+
+			exporter.AddPacket(packetId, packetFrames.data(), packetFrames.size());
+
+			/* Jump to the next frame after the processed packet */
+			i = lastFrameId + 1;
 		}
 		else
 		{
-			ss << CSV_DELIMITER + CSV_DELIMITER;
+			Frame frame = GetFrame(i);
+
+			exporter.AddPacket(INVALID_RESULT_INDEX, &frame, 1);
+
+			/* Jump to next frame */
+			i++;
 		}
 
-		if (frame.HasFlag(SPI_ERROR_FLAG))
+		if (i >= nextProgress)
 		{
-			switch (frame.mType)
+			if (UpdateExportProgressAndCheckForCancel(i, numFrames) == true)
 			{
-			case AbccSpiError::Fragmentation:
-				ss << "FRAGMENT";
-				break;
-			case AbccSpiError::EndOfTransfer:
-				ss << "CLOCKING";
-				break;
-			case AbccSpiError::Generic:
-			default:
-				ss << "GENERIC";
-				break;
+				exporter.End();
+				return;
 			}
+
+			nextProgress = i + EXPORT_PROGRESS_INTERVAL;
 		}
-		else
+	}
+
+	UpdateExportProgressAndCheckForCancel(numFrames, numFrames);
+	exporter.End();
+}
+
+bool SpiAnalyzerResults::FormatMessageDataTabularText(SpiChannel_t channel, const MsgHeaderInfo_t* msg_header, U16 msg_data_cnt, bool error_rsp, U8 data, DisplayBase display_base, char* text, size_t size, NotifEvent_t* notification)
+{
+	if (error_rsp)
+	{
+		const U16 nwSpecErrCodeOffset = 2;
+		char errorStr[FORMATTED_STRING_BUFFER_SIZE];
+
+		// The error response may be composed of one to three bytes.
+		// This payload can represent a common error response,
+		// an object specific error response, or a network specific
+		// error response.
+
+		if (msg_data_cnt == 0)
+		{
+			*notification = GetErrorRspString(data, errorStr, sizeof(errorStr), display_base);
+			SNPRINTF(text, size, "Error Code: %s", errorStr);
+			return true;
+		}
+		else if (msg_data_cnt <= nwSpecErrCodeOffset)
 		{
-			if (IS_MOSI_FRAME(frame))
+			U8 nwTypeIdx = 0;
+			bool nwSpecificError = (msg_data_cnt == nwSpecErrCodeOffset);
+
+			if (nwSpecificError)
+			{
+				nwTypeIdx = static_cast<U8>(mSettings->mNetworkType);
+			}
+
+			*notification = GetErrorRspString(nwSpecificError, nwTypeIdx, msg_header->obj, data, errorStr, sizeof(errorStr), display_base);
+
+			if (nwSpecificError)
 			{
-				ss << GET_MOSI_FRAME_TAG(frame.mType);
+				SNPRINTF(text, size, "Network Error: %s", errorStr);
 			}
 			else
 			{
-				ss << GET_MISO_FRAME_TAG(frame.mType);
+				SNPRINTF(text, size, "Object Error: %s", errorStr);
 			}
-		}
-
-		ss << CSV_DELIMITER << frameDataStr << std::endl;
-
-		AnalyzerHelpers::AppendToFile((U8*)ss.str().c_str(), (U32)ss.str().length(), f);
-		ss.str(std::string());
 
-		if (UpdateExportProgressAndCheckForCancel(i, numFrames) == true)
-		{
-			AnalyzerHelpers::EndFile(f);
-			return;
+			return true;
 		}
 	}
-
-	UpdateExportProgressAndCheckForCancel(numFrames, numFrames);
-	AnalyzerHelpers::EndFile(f);
-}
-
-void SpiAnalyzerResults::AppendCsvHeaderDelimeters(std::stringstream &ss_csv_data, U8 count, bool& add_header_delims)
-{
-	if (add_header_delims)
+	else if (channel == SpiChannel::MISO)
 	{
-		for (U8 i = 0U; i < count; i++)
+		bool nwObject = (msg_header->obj == ABP_OBJ_NUM_NW);
+		bool exception = false;
+		bool attribute = IsAttributeCmd(msg_header->cmd);
+		bool firstAttributeByte = (attribute && (msg_data_cnt == 0));
+		char excepStr[FORMATTED_STRING_BUFFER_SIZE];
+
+		if (firstAttributeByte)
 		{
-			ss_csv_data << CSV_DELIMITER;
+			U16 tableIndex;
+
+			if (GetExceptionTableIndex(nwObject, (U8)mSettings->mNetworkType, msg_header, &tableIndex))
+			{
+				*notification = GetExceptionString(nwObject, tableIndex, data, excepStr, sizeof(excepStr), display_base);
+				exception = true;
+			}
 		}
 
-		add_header_delims = false;
+		if (exception)
+		{
+			if (nwObject)
+			{
+				SNPRINTF(text, size, "Exception Info: %s", excepStr);
+			}
+			else
+			{
+				SNPRINTF(text, size, "Exception Code: %s", excepStr);
+			}
+
+			return true;
+		}
 	}
-}
 
-void SpiAnalyzerResults::AppendCsvMessageEntry(void* file, std::stringstream &ss_csv_head, std::stringstream &ss_csv_body, std::stringstream &ss_csv_tail, ErrorEvent event)
-{
-	ss_csv_head << CSV_DELIMITER;
-
-	switch (event)
-	{
-	case ErrorEvent::SpiFragmentationError:
-		ss_csv_head << "SPI_ERROR";
-		break;
-	case ErrorEvent::RetransmitWarning:
-		ss_csv_head << "RETRANSMIT";
-		break;
-	case ErrorEvent::CrcError:
-		ss_csv_head << "CRC_ERROR";
-		break;
-	case ErrorEvent::None:
-	default:
-		break;
-	}
-
-	AnalyzerHelpers::AppendToFile((U8*)ss_csv_head.str().c_str(), (U32)ss_csv_head.str().length(), file);
-	AnalyzerHelpers::AppendToFile((U8*)ss_csv_body.str().c_str(), (U32)ss_csv_body.str().length(), file);
-	AnalyzerHelpers::AppendToFile((U8*)ss_csv_tail.str().c_str(), (U32)ss_csv_tail.str().length(), file);
+	return false;
 }
 
-void SpiAnalyzerResults::AppendCsvSafeString(std::stringstream &ss_csv_data, char* input_data_str, DisplayBase display_base)
+/*
+** The fields of a message header are formatted from the command extension
+** frame and the fields kept for it by the message header index, so the text
+** does not depend on the frames requested before.
+*/
+void SpiAnalyzerResults::FormatMessageHeaderTabularText(const MsgHeaderInfo_t* msg_header, const MsgHeaderFields_t* fields, DisplayBase display_base, MsgHeaderText_t* text)
 {
-	const char doubleQuote[] = "\"";
-	std::string csvStr;
-	bool isStringData = (
-		(display_base == DisplayBase::ASCII) ||
-		(display_base == DisplayBase::AsciiHex));
+	char str[FORMATTED_STRING_BUFFER_SIZE];
+	bool errorRsp = ((msg_header->cmd & ABP_MSG_HEADER_E_BIT) != 0);
 
-	if (!isStringData)
+	if (fields->bFlags & MSG_HEADER_SIZE_ERROR_FLAG)
 	{
-		ss_csv_data << CSV_DELIMITER << input_data_str;
-		return;
+		SNPRINTF(text->acSize, sizeof(text->acSize), "!Size: %u Bytes", fields->wSize);
+	}
+	else
+	{
+		SNPRINTF(text->acSize, sizeof(text->acSize), "Size: %u Bytes", fields->wSize);
 	}
 
-	csvStr.assign(input_data_str);
-
-	ss_csv_data << CSV_DELIMITER;
-
-	// The first two cases below are to reverse the Saleae Logic SDK's handling
-	// of the 'space' and 'comma' ASCII characters. In this case the plugin will
-	// escape the characters only if necessary based on the state of the
-	// CSV delimiter.
+	SNPRINTF(text->acSourceId, sizeof(text->acSourceId), "Source ID: %d (0x%02X)", fields->bSourceId, fields->bSourceId);
 
-	if (csvStr.find("COMMA") != std::string::npos)
+	if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed)
 	{
-		std::string comma = ",";
+		bool found = false;
+		NotifEvent_t notification = GetObjectString(msg_header->obj, str, sizeof(str), display_base);
 
-		if (CSV_DELIMITER.compare(comma) == 0)
+		if (notification == NotifEvent::Alert)
 		{
-			/* Replace with comma-character and surround with double quotes */
-			ss_csv_data << doubleQuote << comma << doubleQuote;
+			SNPRINTF(text->acObject, sizeof(text->acObject), "!Object: %s", str);
 		}
 		else
 		{
-			/* Replace with space-character */
-			ss_csv_data << comma;
+			SNPRINTF(text->acObject, sizeof(text->acObject), "Object: %s", str);
 		}
-	}
-	else if (csvStr.find("' '") != std::string::npos)
-	{
-		std::string space = " ";
 
-		if (CSV_DELIMITER.compare(space) == 0)
-		{
-			/* Replace with space-character and surround with double quotes */
-			ss_csv_data << doubleQuote << space << doubleQuote;
-		}
-		else
-		{
-			/* Replace with space-character */
-			ss_csv_data << space;
-		}
-	}
-	else
-	{
-		if (csvStr.find('"') != std::string::npos)
-		{
-			/* Escape double-quotes */
-			for (std::string::size_type n = 0;
-				(n = csvStr.find(doubleQuote, n)) != std::string::npos;
-				n += 2)
-			{
-				csvStr.replace(n, 1, "\"\"");
-			}
-
-			/* Wrap element in double quotes */
-			csvStr.insert(0, doubleQuote);
-			csvStr.append(doubleQuote);
-		}
-
-		if (csvStr.find(CSV_DELIMITER) != std::string::npos)
-		{
-			/* Wrap element in double quotes */
-			csvStr.insert(0, doubleQuote);
-			csvStr.append(doubleQuote);
-		}
-
-		/* No escaping needed */
-		ss_csv_data << csvStr;
-	}
-}
-
-void SpiAnalyzerResults::BufferCsvMessageMsgEntry(
-	Frame& frame,
-	std::stringstream& ss_csv_data,
-	bool& align_msg_fields,
-	DisplayBase display_base)
-{
-	char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-
-	// NOTE: AbccMosiStates and AbccMisoStates are assumed to have aligned
-	// values for AbccMosiStates::MessageField* and AbccMisoStates::MessageField*.
-	// This means only one of the enums will be used for the cases defined below.
-
-	switch (frame.mType)
-	{
-	case AbccMisoStates::MessageField_Size:
-	{
-		GetNumberString(frame.mData1, DisplayBase::Decimal, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-		ss_csv_data << CSV_DELIMITER << dataStr;
-		align_msg_fields = false;
-		break;
-	}
-
-	case AbccMisoStates::MessageField_SourceId:
-	{
-		GetNumberString(frame.mData1, DisplayBase::Decimal, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-		AppendCsvHeaderDelimeters(ss_csv_data, 1, align_msg_fields);
-		ss_csv_data << CSV_DELIMITER << dataStr;
-		break;
-	}
-
-	case AbccMisoStates::MessageField_Object:
-	{
-		GetObjectString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-		AppendCsvHeaderDelimeters(ss_csv_data, 2, align_msg_fields);
-		ss_csv_data << CSV_DELIMITER << dataStr;
-		break;
-	}
-
-	case AbccMisoStates::MessageField_Instance:
-	{
-		NotifEvent_t notification = NotifEvent::None;
-		bool found = GetInstString((U8)mSettings->mNetworkType, (U8)frame.mData2, (U16)frame.mData1, dataStr, sizeof(dataStr), &notification, display_base);
+		notification = NotifEvent::None;
+		found = GetInstString((U8)mSettings->mNetworkType, msg_header->obj, msg_header->inst, str, sizeof(str), &notification, display_base);
 
 		if (!found)
 		{
-			SNPRINTF(dataStr, sizeof(dataStr), "0x%04X", (U16)frame.mData1);
+			SNPRINTF(str, sizeof(str), "%d (0x%04X)", msg_header->inst, msg_header->inst);
 		}
 
-		AppendCsvHeaderDelimeters(ss_csv_data, 3, align_msg_fields);
-		ss_csv_data << CSV_DELIMITER << dataStr;
-
-		break;
-	}
-
-	case AbccMisoStates::MessageField_Command:
-	{
-		GetCmdString((U8)frame.mData1, (U8)frame.mData2, dataStr, sizeof(dataStr), display_base);
-		AppendCsvHeaderDelimeters(ss_csv_data, 4, align_msg_fields);
-
-		if (((U8)frame.mData1 & ABP_MSG_HEADER_E_BIT) == ABP_MSG_HEADER_E_BIT)
+		if (notification)
 		{
-			ss_csv_data << CSV_DELIMITER << dataStr << ERROR_RESPONSE_STR;
+			SNPRINTF(text->acInstance, sizeof(text->acInstance), "!Instance: %s", str);
 		}
 		else
 		{
-			if (((U8)frame.mData1 & ABP_MSG_HEADER_C_BIT) == ABP_MSG_HEADER_C_BIT)
-			{
-				ss_csv_data << CSV_DELIMITER << dataStr << COMMAND_STR;
-			}
-			else
-			{
-				ss_csv_data << CSV_DELIMITER << dataStr << RESPONSE_STR;
-			}
+			SNPRINTF(text->acInstance, sizeof(text->acInstance), "Instance: %s", str);
 		}
 
-		break;
-	}
-
-	case AbccMisoStates::MessageField_CommandExtension:
-	{
-		NotifEvent_t notification = NotifEvent::None;
-		DisplayBase displayBase = DisplayBase::Hexadecimal;
-		U16 cmdExt = static_cast<U16>(frame.mData1);
-		MsgHeaderInfo_t* psMsgHdr = reinterpret_cast<MsgHeaderInfo_t*>(&frame.mData2);
+		notification = GetCmdString(msg_header->cmd, msg_header->obj, str, sizeof(str), display_base);
 
-		if (IsNonIndexedAttributeCmd(psMsgHdr->cmd))
-		{
-			GetAttrString(psMsgHdr->obj, psMsgHdr->inst, cmdExt, dataStr, sizeof(dataStr), AttributeAccessMode::Normal, &notification, displayBase);
-		}
-		else if (IsIndexedAttributeCmd(psMsgHdr->cmd))
+		if ((errorRsp == true) || (notification == NotifEvent::Alert))
 		{
-			GetAttrString(psMsgHdr->obj, psMsgHdr->inst, cmdExt, dataStr, sizeof(dataStr), AttributeAccessMode::Indexed, &notification, displayBase);
-		}
-		else
-		{
-			SegmentationType segmentation = GetMessageSegmentationType(psMsgHdr);
-
-			if (segmentation != SegmentationType::None)
+			if (msg_header->cmd & ABP_MSG_HEADER_C_BIT)
 			{
-				bool commandMsg = IsCommandMessage(psMsgHdr);
-				bool segmentationMsg = IsSegmentedMessage(commandMsg, segmentation);
-				U8 cmdExt0 = (cmdExt >> 0) & 0xFF;
-				U8 cmdExt1 = (cmdExt >> 8) & 0xFF;
-				U8 validFlags = 0;
-
-				notification = NotifEvent::None;
-
-				if (commandMsg)
-				{
-					validFlags |= ABP_MSG_CMDEXT1_SEG_ABORT;
-				}
-
-				if (segmentationMsg)
-				{
-					validFlags |= ABP_MSG_CMDEXT1_SEG_FIRST | ABP_MSG_CMDEXT1_SEG_LAST;
-				}
-
-				if (cmdExt1 & ~validFlags)
-				{
-					notification = NotifEvent::Alert;
-					SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | Segmentation Unknown (0x%02X)", cmdExt0, cmdExt1);
-				}
-				else if (cmdExt1 & ABP_MSG_CMDEXT1_SEG_ABORT)
-				{
-					notification = NotifEvent::Alert;
-					SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | Segmentation Aborted", cmdExt0);
-				}
-				else if (segmentationMsg)
-				{
-					cmdExt1 &= (ABP_MSG_CMDEXT1_SEG_FIRST | ABP_MSG_CMDEXT1_SEG_LAST);
-
-					switch (cmdExt1)
-					{
-					case 0:
-						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | SEGMENT", cmdExt0);
-						break;
-					case ABP_MSG_CMDEXT1_SEG_FIRST:
-						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | FIRST_SEGMENT", cmdExt0);
-						break;
-					case ABP_MSG_CMDEXT1_SEG_LAST:
-						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | LAST_SEGMENT", cmdExt0);
-						break;
-					case (ABP_MSG_CMDEXT1_SEG_FIRST | ABP_MSG_CMDEXT1_SEG_LAST):
-					default:
-						SNPRINTF(dataStr, sizeof(dataStr), "0x%02X | FIRST_SEGMENT | LAST_SEGMENT", cmdExt0);
-						break;
-					}
-				}
-				else
-				{
-					// Message relates to segmentation but is either a command for
-					// "segmented response" or a response to a "segmented command".
-					GetNumberString(cmdExt, displayBase, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-				}
+				SNPRINTF(text->acCommand, sizeof(text->acCommand), "!Command: %s", str);
 			}
 			else
 			{
-				GetNumberString(cmdExt, displayBase, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-			}
-		}
-
-		AppendCsvHeaderDelimeters(ss_csv_data, 5, align_msg_fields);
-		ss_csv_data << CSV_DELIMITER << dataStr;
-
-		break;
-	}
-
-	case AbccMisoStates::MessageField_Data:
-	case AbccMisoStates::MessageField:
-	{
-		MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
-
-		if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
-		{
-			const U16 nwSpecErrCodeOffset = 2;
-
-			/* The error response may be composed of one to three bytes.
-			** This payload can represent a common error response,
-			** an object specific error response, or a network specific
-			** error response. */
-
-			if (info->msgDataCnt == 0)
-			{
-				GetErrorRspString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-			}
-			else if (info->msgDataCnt <= nwSpecErrCodeOffset)
-			{
-				U8 nwTypeIdx = 0;
-				bool nwSpecificError = (info->msgDataCnt == nwSpecErrCodeOffset);
-
-				if (nwSpecificError)
-				{
-					nwTypeIdx = static_cast<U8>(mSettings->mNetworkType);
-				}
-
-				GetErrorRspString(nwSpecificError, nwTypeIdx, info->msgHeader.obj, (U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-
-				// Explicitly set display_base to ASCII to ensure proper escaping
-				// is performed when calling AppendCsvSafeString().
-				display_base = DisplayBase::ASCII;
+				SNPRINTF(text->acCommand, sizeof(text->acCommand), "!Response: %s", str);
 			}
 		}
 		else
 		{
-			BaseType type;
-			bool exception = false;
-			bool attribute = IsAttributeCmd(info->msgHeader.cmd);
-			bool firstAttributeByte = (attribute && (info->msgDataCnt == 0));
-
-			if (attribute)
-			{
-				type = GetAttrBaseType(info->msgHeader.obj, info->msgHeader.inst, (U8)info->msgHeader.cmdExt);
-			}
-			else
-			{
-				type = GetCmdBaseType(info->msgHeader.obj, info->msgHeader.cmd);
-			}
-
-			if (IS_MISO_FRAME(frame) && firstAttributeByte)
-			{
-				bool nwObject = (info->msgHeader.obj == ABP_OBJ_NUM_NW);
-				U16 tableIndex;
-
-				if (GetExceptionTableIndex(nwObject, (U8)mSettings->mNetworkType, &info->msgHeader, &tableIndex))
-				{
-					GetExceptionString(nwObject, tableIndex, (U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-
-					// Explicitly set display_base to ASCII to ensure proper escaping
-					// is performed when calling AppendCsvSafeString().
-					display_base = DisplayBase::ASCII;
-					exception = true;
-				}
-			}
-
-			if (!exception)
-			{
-				GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), type);
-			}
-		}
-
-		AppendCsvHeaderDelimeters(ss_csv_data, 6, align_msg_fields);
-
-		AppendCsvSafeString(ss_csv_data, dataStr, display_base);
-
-		break;
-	}
-
-	default:
-		break;
-	}
-}
-
-void SpiAnalyzerResults::BufferCsvMessageMisoEntry(
-	U32 sample_rate,
-	U64 trigger_sample,
-	U64 packet_id,
-	Frame& frame,
-	std::stringstream& ss_csv_head,
-	std::stringstream& ss_csv_body,
-	std::stringstream& ss_csv_tail,
-	ErrorEvent& mosi_event,
-	ErrorEvent& miso_event,
-	bool& fragmentation,
-	bool& anb_stat_reached,
-	bool& align_msg_fields,
-	bool& add_entry,
-	DisplayBase display_base)
-{
-	switch (frame.mType)
-	{
-	case AbccSpiError::Fragmentation:
-		miso_event = ErrorEvent::SpiFragmentationError;
-		break;
-
-	case AbccMisoStates::AnybusStatus:
-	{
-		char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-
-		anb_stat_reached = true;
-		GetAbccStatusString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-		ss_csv_body << CSV_DELIMITER << dataStr;
-
-		break;
-	}
-
-	case AbccMisoStates::SpiStatus:
-	{
-		bool message = ((frame.mData1 & ABP_SPI_STATUS_M) != 0);
-
-		if (message)
-		{
-			char timeStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-
-			/* Add in the timestamp, packet ID, and Anybus state */
-			AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, trigger_sample, sample_rate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
-			ss_csv_head << std::endl
-				<< MISO_STR + CSV_DELIMITER << timeStr << CSV_DELIMITER << packet_id;
-			add_entry = true;
-		}
-
-		ss_csv_tail << CSV_DELIMITER;
-
-		if (message)
-		{
-			if (frame.mData1 & ABP_SPI_STATUS_LAST_FRAG)
+			if (msg_header->cmd & ABP_MSG_HEADER_C_BIT)
 			{
-				if (fragmentation)
-				{
-					ss_csv_tail << LAST_FRAG_STR;
-					fragmentation = false;
-				}
+				SNPRINTF(text->acCommand, sizeof(text->acCommand), "Command: %s", str);
 			}
 			else
 			{
-				if (!fragmentation)
-				{
-					fragmentation = true;
-					ss_csv_tail << FIRST_FRAG_STR;
-				}
-				else
-				{
-					ss_csv_tail << FRAGMENT_STR;
-				}
+				SNPRINTF(text->acCommand, sizeof(text->acCommand), "Response: %s", str);
 			}
 		}
-
-		break;
 	}
-
-	case AbccMisoStates::MessageField_Size:
-	case AbccMisoStates::MessageField_SourceId:
-	case AbccMisoStates::MessageField_Object:
-	case AbccMisoStates::MessageField_Instance:
-	case AbccMisoStates::MessageField_Command:
-	case AbccMisoStates::MessageField_CommandExtension:
-	case AbccMisoStates::MessageField_Data:
-	case AbccMisoStates::MessageField:
-		BufferCsvMessageMsgEntry(
-			frame,
-			ss_csv_tail,
-			align_msg_fields,
-			display_base);
-
-		break;
-
-	case AbccMisoStates::Crc32:
+	else if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Compact)
 	{
-		if ((U32)frame.mData1 != (U32)frame.mData2)
-		{
-			miso_event = ErrorEvent::CrcError;
-			mosi_event = ErrorEvent::CrcError;
-		}
-
-		break;
-	}
-
-	default:
-		break;
-	}
-}
-
-void SpiAnalyzerResults::BufferCsvMessageMosiEntry(
-	U32 sample_rate,
-	U64 trigger_sample,
-	U64 packet_id,
-	Frame &frame,
-	std::stringstream &ss_csv_head,
-	std::stringstream &ss_csv_body,
-	std::stringstream &ss_csv_tail,
-	ErrorEvent &mosi_event,
-	ErrorEvent &miso_event,
-	bool &fragmentation,
-	bool &app_stat_reached,
-	bool &align_msg_fields,
-	bool &add_entry,
-	DisplayBase display_base)
-{
-	switch (frame.mType)
-	{
-		case AbccSpiError::Fragmentation:
-			mosi_event = ErrorEvent::SpiFragmentationError;
-			break;
-
-		case AbccMosiStates::SpiControl:
-		{
-			char timeStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-			bool message = ((frame.mData1 & ABP_SPI_CTRL_M) != 0);
-
-			if (message)
-			{
-				/* Add in the timestamp, packet ID */
-				AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, trigger_sample, sample_rate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
-				ss_csv_head << std::endl
-							<< MOSI_STR + CSV_DELIMITER << timeStr << CSV_DELIMITER << packet_id;
-				add_entry = true;
-			}
-
-			if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
-			{
-				mosi_event = ErrorEvent::RetransmitWarning;
-				miso_event = ErrorEvent::RetransmitWarning;
-			}
-
-			ss_csv_tail << CSV_DELIMITER;
-
-			if (message)
-			{
-				if (frame.mData1 & ABP_SPI_CTRL_LAST_FRAG)
-				{
-					if (fragmentation)
-					{
-						ss_csv_tail << LAST_FRAG_STR;
-						fragmentation = false;
-					}
-				}
-				else
-				{
-					if (!fragmentation)
-					{
-						fragmentation = true;
-						ss_csv_tail << FIRST_FRAG_STR;
-					}
-					else
-					{
-						ss_csv_tail << FRAGMENT_STR;
-					}
-				}
-			}
-
-			break;
-		}
-
-		case AbccMosiStates::ApplicationStatus:
-		{
-			char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-
-			app_stat_reached = true;
-			GetApplStsString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-			ss_csv_body << CSV_DELIMITER << dataStr;
-
-			break;
-		}
+		SNPRINTF(text->acObject, sizeof(text->acObject), "Obj {%02X:", msg_header->obj);
+		SNPRINTF(text->acInstance, sizeof(text->acInstance), "%04Xh}", msg_header->inst);
 
-		case AbccMosiStates::MessageField_Size:
-		case AbccMosiStates::MessageField_SourceId:
-		case AbccMosiStates::MessageField_Object:
-		case AbccMosiStates::MessageField_Instance:
-		case AbccMosiStates::MessageField_Command:
-		case AbccMosiStates::MessageField_CommandExtension:
-		case AbccMosiStates::MessageField_Data:
-		case AbccMosiStates::MessageField:
-			BufferCsvMessageMsgEntry(
-				frame,
-				ss_csv_tail,
-				align_msg_fields,
-				display_base);
-
-			break;
-
-		case AbccMosiStates::Crc32:
+		if (msg_header->cmd & ABP_MSG_HEADER_C_BIT)
 		{
-			if ((U32)frame.mData1 != (U32)frame.mData2)
-			{
-				mosi_event = ErrorEvent::CrcError;
-			}
-
-			break;
-		}
-
-		default:
-			break;
-	}
-}
-
-void SpiAnalyzerResults::ExportMessageDataToFile(const char *file, DisplayBase display_base)
-{
-	std::stringstream ssMosiHead;
-	std::stringstream ssMisoHead;
-	std::stringstream ssMisoTail;
-	std::stringstream ssMosiTail;
-	std::stringstream ssSharedBody;
-
-	bool mosiFragmentation = false;
-	bool misoFragmentation = false;
-	bool mosiPreviousFragState = false;
-	bool misoPreviousFragState = false;
-	void* f = AnalyzerHelpers::StartFile(file);
-
-	U64 triggerSample = mAnalyzer->GetTriggerSample();
-	U32 sampleRate = mAnalyzer->GetSampleRate();
-	U64 numFrames = GetNumFrames();
-	U64 i = 0;
-
-	/* Add header fields */
-	ssMosiHead << "Channel" + CSV_DELIMITER +
-				  "Time [s]" + CSV_DELIMITER +
-				  "Packet ID" + CSV_DELIMITER +
-				  "Error Event" + CSV_DELIMITER +
-				  "Anybus State" + CSV_DELIMITER +
-				  "Application State" + CSV_DELIMITER +
-				  "Message Fragmentation" + CSV_DELIMITER +
-				  "Message Size [bytes]" + CSV_DELIMITER +
-				  "Source ID" + CSV_DELIMITER +
-				  "Object" + CSV_DELIMITER +
-				  "Instance" + CSV_DELIMITER +
-				  "Command" + CSV_DELIMITER +
-				  "CmdExt" + CSV_DELIMITER +
-				  "Message Data";
-
-	AnalyzerHelpers::AppendToFile((U8*)ssMosiHead.str().c_str(), (U32)ssMosiHead.str().length(), f);
-	ssMosiHead.str(std::string());
-
-	while (i < numFrames)
-	{
-		U64 packetId = GetPacketContainingFrameSequential(i);
-
-		if (packetId != INVALID_RESULT_INDEX)
-		{
-			U64 firstFrameId;
-			U64 lastFrameId;
-			ErrorEvent mosiEvent = ErrorEvent::None;
-			ErrorEvent misoEvent = ErrorEvent::None;
-			bool mosiAppStatReached = false;
-			bool misoAnbStatReached = false;
-			bool alignMosiMsgFields = true;
-			bool alignMisoMsgFields = true;
-			bool addMosiEntry = false;
-			bool addMisoEntry = false;
-
-			GetFramesContainedInPacket(packetId, &firstFrameId, &lastFrameId);
-
-			/* Iterate through packet and extract message header and data
-			** stream is written only on receipt of "last fragment". */
-			for (U64 frameId = firstFrameId; frameId <= lastFrameId; frameId++)
-			{
-				Frame frame = GetFrame(frameId);
-
-				if (IS_MOSI_FRAME(frame))
-				{
-					BufferCsvMessageMosiEntry(
-						sampleRate,
-						triggerSample,
-						packetId,
-						frame,
-						ssMosiHead,
-						ssSharedBody,
-						ssMosiTail,
-						mosiEvent,
-						misoEvent,
-						mosiFragmentation,
-						mosiAppStatReached,
-						alignMosiMsgFields,
-						addMosiEntry,
-						display_base);
-				}
-				else
-				{
-					 BufferCsvMessageMisoEntry(
-						sampleRate,
-						triggerSample,
-						packetId,
-						frame,
-						ssMisoHead,
-						ssSharedBody,
-						ssMisoTail,
-						mosiEvent,
-						misoEvent,
-						misoFragmentation,
-						misoAnbStatReached,
-						alignMisoMsgFields,
-						addMisoEntry,
-						display_base);
-				}
-			}
-
-			if ((mosiEvent == ErrorEvent::SpiFragmentationError) ||
-				(misoEvent == ErrorEvent::SpiFragmentationError))
-			{
-				mosiFragmentation = mosiPreviousFragState;
-				misoFragmentation = misoPreviousFragState;
-
-				/* Determine if additional tabs need to be added to get correct alignment in CSV */
-				if (!mosiAppStatReached)
-				{
-					ssSharedBody << CSV_DELIMITER;
-				}
-
-				if (!misoAnbStatReached)
-				{
-					ssSharedBody << CSV_DELIMITER;
-				}
-			}
-
-			if (addMosiEntry)
-			{
-				if (mosiEvent == ErrorEvent::None)
-				{
-					mosiPreviousFragState = mosiFragmentation;
-				}
-
-				AppendCsvMessageEntry(f, ssMosiHead, ssSharedBody, ssMosiTail, mosiEvent);
-			}
-
-			if (addMisoEntry)
-			{
-				if (misoEvent == ErrorEvent::None)
-				{
-					misoPreviousFragState = misoFragmentation;
-				}
-
-				AppendCsvMessageEntry(f, ssMisoHead, ssSharedBody, ssMisoTail, misoEvent);
-			}
-
-			ssMisoHead.str(std::string());
-			ssMosiHead.str(std::string());
-			ssMisoTail.str(std::string());
-			ssMosiTail.str(std::string());
-			ssSharedBody.str(std::string());
-
-			/* Jump to the next frame after the processed packet */
-			i = lastFrameId + 1;
+			SNPRINTF(text->acCommand, sizeof(text->acCommand), ", Cmd {%02X:", (U8)(msg_header->cmd & ABP_MSG_HEADER_CMD_BITS));
 		}
 		else
 		{
-			/* Jump to next frame */
-			i++;
-		}
-
-		if (UpdateExportProgressAndCheckForCancel(i, numFrames) == true)
-		{
-			AnalyzerHelpers::EndFile(f);
-			return;
+			SNPRINTF(text->acCommand, sizeof(text->acCommand), ", Rsp {%02X:", (U8)(msg_header->cmd & ABP_MSG_HEADER_CMD_BITS));
 		}
 	}
-
-	UpdateExportProgressAndCheckForCancel(numFrames, numFrames);
-	AnalyzerHelpers::EndFile(f);
 }
 
-void SpiAnalyzerResults::ExportProcessDataToFile(const char* file, DisplayBase display_base)
-{
-	std::stringstream ssMosiHead;
-	std::stringstream ssMisoHead;
-	std::stringstream ssMosiTail;
-	std::stringstream ssMisoTail;
-	std::stringstream ssSharedBody;
-	void* f = AnalyzerHelpers::StartFile(file);
-	bool addCsvHeader = true;
-
-	U64 triggerSample = mAnalyzer->GetTriggerSample();
-	U32 sampleRate = mAnalyzer->GetSampleRate();
-	U64 numFrames = GetNumFrames();
-	U64 i = 0;
-
-	while (i < numFrames)
-	{
-		U64 packetId = GetPacketContainingFrameSequential(i);
-		char timeStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE];
-		char dataStr[DISPLAY_NUMERIC_STRING_BUFFER_SIZE] = "";
-		bool addMosiEntry = false;
-		bool addMisoEntry = false;
-
-		if (packetId != INVALID_RESULT_INDEX)
-		{
-			U64 firstFrameId;
-			U64 lastFrameId;
-			ErrorEvent mosiEvent = ErrorEvent::None;
-			ErrorEvent misoEvent = ErrorEvent::None;
-			bool mosiAppStatReached = false;
-			bool misoAnbStatReached = false;
-
-			GetFramesContainedInPacket(packetId, &firstFrameId, &lastFrameId);
-
-			/* Iterate through packet and extract message header and data
-			** stream is written only on receipt of "last fragment". */
-			for (U64 frameId = firstFrameId; frameId <= lastFrameId; frameId++)
-			{
-				Frame frame = GetFrame(frameId);
-
-				if (IS_MOSI_FRAME(frame))
-				{
-					switch (frame.mType)
-					{
-					case AbccSpiError::Fragmentation:
-						mosiEvent = ErrorEvent::SpiFragmentationError;
-						break;
-					case AbccMosiStates::ProcessDataLength:
-						if (addCsvHeader)
-						{
-							U32 dwBytes = ((U16)frame.mData1) << 1;
-							/* Add header fields */
-							std::stringstream ssHeader;
-							ssHeader << "Channel" + CSV_DELIMITER +
-										"Time [s]" + CSV_DELIMITER +
-										"Packet ID" + CSV_DELIMITER +
-										"Error Event" + CSV_DELIMITER +
-										"Anybus State" + CSV_DELIMITER +
-										"Application State" + CSV_DELIMITER +
-										"Network Time";
-
-							for (U16 cnt = 0; cnt < dwBytes; cnt++)
-							{
-								ssHeader << CSV_DELIMITER + "Process Data " << cnt;
-								AnalyzerHelpers::AppendToFile((U8*)ssHeader.str().c_str(), (U32)ssHeader.str().length(), f);
-								ssHeader.str(std::string());
-							}
-
-							AnalyzerHelpers::AppendToFile((U8*)ssHeader.str().c_str(), (U32)ssHeader.str().length(), f);
-							addCsvHeader = false;
-						}
-
-						break;
-					case AbccMosiStates::SpiControl:
-					{
-						if (frame.mData1 & ABP_SPI_CTRL_WRPD_VALID)
-						{
-							/* Add in the timestamp, packet ID */
-							AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, triggerSample, sampleRate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
-							ssMosiHead << std::endl
-									   << MOSI_STR + CSV_DELIMITER << timeStr << CSV_DELIMITER << packetId;
-							addMosiEntry = true;
-						}
-
-						break;
-					}
-					case AbccMosiStates::ApplicationStatus:
-					{
-						mosiAppStatReached = true;
-						GetApplStsString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-						ssSharedBody << CSV_DELIMITER << dataStr;
-						break;
-					}
-					case AbccMosiStates::WriteProcessData:
-					{
-						GetNumberString(frame.mData1, display_base, GET_MOSI_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-						ssMosiTail << CSV_DELIMITER << dataStr;
-						break;
-					}
-					case AbccMosiStates::Crc32:
-					{
-						if ((U32)frame.mData1 != (U32)frame.mData2)
-						{
-							mosiEvent = ErrorEvent::CrcError;
-						}
-
-						break;
-					}
-					default:
-						break;
-					}
-				}
-				else
-				{
-					/* MISO Frame */
-					switch (frame.mType)
-					{
-					case AbccSpiError::Fragmentation:
-						misoEvent = ErrorEvent::SpiFragmentationError;
-						break;
-					case AbccMisoStates::AnybusStatus:
-					{
-						misoAnbStatReached = true;
-						GetAbccStatusString((U8)frame.mData1, dataStr, sizeof(dataStr), display_base);
-						ssSharedBody << CSV_DELIMITER << dataStr;
-						break;
-					}
-					case AbccMisoStates::SpiStatus:
-					{
-						if (frame.mData1 & ABP_SPI_STATUS_NEW_PD)
-						{
-							/* Add in the timestamp, packet ID */
-							AnalyzerHelpers::GetTimeString(frame.mStartingSampleInclusive, triggerSample, sampleRate, timeStr, DISPLAY_NUMERIC_STRING_BUFFER_SIZE);
-							ssMisoHead << std::endl
-									   << MISO_STR + CSV_DELIMITER << timeStr << CSV_DELIMITER << packetId;
-							addMisoEntry = true;
-						}
-
-						break;
-					}
-					case AbccMisoStates::NetworkTime:
-					{
-						/* Append network time stamp to both string streams */
-						GetNumberString(frame.mData1, DisplayBase::Decimal, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-						ssMisoTail << CSV_DELIMITER << dataStr;
-						ssMosiTail << CSV_DELIMITER << dataStr;
-						break;
-					}
-					case AbccMisoStates::ReadProcessData:
-					{
-						GetNumberString(frame.mData1, display_base, GET_MISO_FRAME_BITSIZE(frame.mType), dataStr, sizeof(dataStr), BaseType::Numeric);
-						ssMisoTail << CSV_DELIMITER << dataStr;
-						break;
-					}
-					case AbccMisoStates::Crc32:
-					{
-						if ((U32)frame.mData1 != (U32)frame.mData2)
-						{
-							misoEvent = ErrorEvent::CrcError;
-							mosiEvent = ErrorEvent::CrcError;
-						}
-
-						break;
-					}
-					default:
-						break;
-					}
-				}
-
-				if (UpdateExportProgressAndCheckForCancel(i, numFrames) == true)
-				{
-					AnalyzerHelpers::EndFile(f);
-					return;
-				}
-			}
-
-			if ((mosiEvent == ErrorEvent::SpiFragmentationError) ||
-				(misoEvent == ErrorEvent::SpiFragmentationError))
-			{
-				/* Determine if additional tabs need to be added to get correct alignment in CSV */
-				if (!mosiAppStatReached)
-				{
-					ssSharedBody << CSV_DELIMITER;
-				}
-
-				if (!misoAnbStatReached)
-				{
-					ssSharedBody << CSV_DELIMITER;
-				}
-			}
-
-			if (addMosiEntry)
-			{
-				AppendCsvMessageEntry(f, ssMosiHead, ssSharedBody, ssMosiTail, mosiEvent);
-			}
-
-			if (addMisoEntry)
-			{
-				AppendCsvMessageEntry(f, ssMisoHead, ssSharedBody, ssMisoTail, misoEvent);
-			}
-
-			ssMisoHead.str(std::string());
-			ssMosiHead.str(std::string());
-			ssMisoTail.str(std::string());
-			ssMosiTail.str(std::string());
-			ssSharedBody.str(std::string());
-
-			/* Jump to the next frame after the processed packet */
-			i = lastFrameId + 1;
-		}
-		else
-		{
-			/* Jump to next frame */
-			i++;
-
-			if (UpdateExportProgressAndCheckForCancel(i, numFrames) == true)
-			{
-				AnalyzerHelpers::EndFile(f);
-				return;
-			}
-		}
-	}
-
-	UpdateExportProgressAndCheckForCancel(numFrames, numFrames);
-	AnalyzerHelpers::EndFile(f);
-}
-
-void SpiAnalyzerResults::GenerateExportFile(const char* file, DisplayBase display_base, U32 export_type_user_id)
-{
-	switch (static_cast<ExportType>(export_type_user_id))
-	{
-	case ExportType::Frames:
-		/* Export all frame data */
-		ExportAllFramesToFile(file, display_base);
-		break;
-	case ExportType::MessageData:
-		/* Export 'valid' message data */
-		ExportMessageDataToFile(file, display_base);
-		break;
-	case ExportType::ProcessData:
-		/* Export 'valid' process data */
-		ExportProcessDataToFile(file, display_base);
-		break;
-	default:
-		break;
-	}
-}
-
-U64 SpiAnalyzerResults::GetFrameIdOfAbccFieldContainedInPacket(U64 packet_index, SpiChannel_t channel, U8 type)
-{
-	U64 frameIndex = INVALID_RESULT_INDEX;
-	U64 firstFrameIndex;
-	U64 lastFrameIndex;
-
-	if (packet_index != INVALID_RESULT_INDEX)
-	{
-		GetFramesContainedInPacket(packet_index, &firstFrameIndex, &lastFrameIndex);
-		if ((firstFrameIndex != INVALID_RESULT_INDEX) && (lastFrameIndex != INVALID_RESULT_INDEX))
-		{
-			for (frameIndex = firstFrameIndex; frameIndex <= lastFrameIndex; frameIndex++)
-			{
-				Frame frame = GetFrame(frameIndex);
-				if (((channel == SpiChannel::MOSI) && IS_MOSI_FRAME(frame) && (frame.mType == type)) ||
-					((channel == SpiChannel::MISO) && IS_MISO_FRAME(frame) && (frame.mType == type)))
-				{
-					break;
-				}
-			}
-		}
-	}
-	return frameIndex;
-}
-
-void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame &frame, DisplayBase display_base)
+void SpiAnalyzerResults::GenerateMessageTabularText(ResultText_t* result_text, SpiChannel_t channel, U64 frame_index, Frame &frame, DisplayBase display_base)
 {
 	char str[FORMATTED_STRING_BUFFER_SIZE];
 
@@ -2111,127 +1533,11 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 	{
 		case AbccMisoStates::MessageField_Size:
 		{
-			bool sizeError = frame.HasFlag(SPI_PROTO_EVENT_FLAG);
-
-			if (sizeError && mSettings->mErrorIndexing)
-			{
-				WriteTabularText(channel, "Message Size: Exceeds Maximum", NotifEvent::Alert);
-			}
-			else
-			{
-				if (sizeError)
-				{
-					SNPRINTF(mMsgSizeStr[channel], sizeof(mMsgSizeStr[channel]), "!Size: %u Bytes", (U16)frame.mData1);
-				}
-				else
-				{
-					SNPRINTF(mMsgSizeStr[channel], sizeof(mMsgSizeStr[channel]), "Size: %u Bytes", (U16)frame.mData1);
-				}
-			}
-
-			break;
-		}
-
-		case AbccMisoStates::MessageField_SourceId:
-		{
-			SNPRINTF(mMsgSrcStr[channel], sizeof(mMsgSrcStr[channel]), "Source ID: %d (0x%02X)", (U8)frame.mData1, (U8)frame.mData1);
-			break;
-		}
-
-		case AbccMisoStates::MessageField_Object:
-		{
-			if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed)
-			{
-				NotifEvent_t notification = GetObjectString((U8)frame.mData1, str, sizeof(str), display_base);
-
-				if (notification == NotifEvent::Alert)
-				{
-					SNPRINTF(mMsgObjStr[channel], sizeof(mMsgObjStr[channel]), "!Object: %s", str);
-				}
-				else
-				{
-					SNPRINTF(mMsgObjStr[channel], sizeof(mMsgObjStr[channel]), "Object: %s", str);
-				}
-			}
-			else if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Compact)
-			{
-				SNPRINTF(mMsgObjStr[channel], sizeof(mMsgObjStr[channel]), "Obj {%02X:", (U8)frame.mData1);
-			}
-
-			break;
-		}
-
-		case AbccMisoStates::MessageField_Instance:
-		{
-			if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed)
-			{
-				bool found = false;
-				NotifEvent_t notification = NotifEvent::None;
-				found = GetInstString((U8)mSettings->mNetworkType, (U8)frame.mData2, (U16)frame.mData1, str, sizeof(str), &notification, display_base);
-
-				if (!found)
-				{
-					SNPRINTF(str, sizeof(str), "%d (0x%04X)", (U16)frame.mData1, (U16)frame.mData1);
-				}
-
-				if (notification)
-				{
-					SNPRINTF(mMsgInstStr[channel], sizeof(mMsgInstStr[channel]), "!Instance: %s", str);
-				}
-				else
-				{
-					SNPRINTF(mMsgInstStr[channel], sizeof(mMsgInstStr[channel]), "Instance: %s", str);
-				}
-			}
-			else if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Compact)
-			{
-				SNPRINTF(mMsgInstStr[channel], sizeof(mMsgInstStr[channel]), "%04Xh}", (U16)frame.mData1);
-			}
-
-			break;
-		}
-
-		case AbccMisoStates::MessageField_Command:
-		{
-			mMsgErrorRspFlag[channel] = ((frame.mData1 & ABP_MSG_HEADER_E_BIT) != 0);
-
-			if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed)
-			{
-				NotifEvent_t notification = GetCmdString((U8)frame.mData1, (U8)frame.mData2, str, sizeof(str), display_base);
-
-				if ((mMsgErrorRspFlag[channel] == true) || (notification == NotifEvent::Alert))
-				{
-					if ((U8)frame.mData1 & ABP_MSG_HEADER_C_BIT)
-					{
-						SNPRINTF(mMsgCmdStr[channel], sizeof(mMsgCmdStr[channel]), "!Command: %s", str);
-					}
-					else
-					{
-						SNPRINTF(mMsgCmdStr[channel], sizeof(mMsgCmdStr[channel]), "!Response: %s", str);
-					}
-				}
-				else
-				{
-					if ((U8)frame.mData1 & ABP_MSG_HEADER_C_BIT)
-					{
-						SNPRINTF(mMsgCmdStr[channel], sizeof(mMsgCmdStr[channel]), "Command: %s", str);
-					}
-					else
-					{
-						SNPRINTF(mMsgCmdStr[channel], sizeof(mMsgCmdStr[channel]), "Response: %s", str);
-					}
-				}
-			}
-			else if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Compact)
+			bool sizeError = frame.HasFlag(SPI_PROTO_EVENT_FLAG);
+
+			if (sizeError && mSettings->mErrorIndexing)
 			{
-				if ((U8)frame.mData1 & ABP_MSG_HEADER_C_BIT)
-				{
-					SNPRINTF(mMsgCmdStr[channel], sizeof(mMsgCmdStr[channel]), ", Cmd {%02X:", (U8)(frame.mData1 & ABP_MSG_HEADER_CMD_BITS));
-				}
-				else
-				{
-					SNPRINTF(mMsgCmdStr[channel], sizeof(mMsgCmdStr[channel]), ", Rsp {%02X:", (U8)(frame.mData1 & ABP_MSG_HEADER_CMD_BITS));
-				}
+				WriteTabularText(result_text, channel, "Message Size: Exceeds Maximum", NotifEvent::Alert);
 			}
 
 			break;
@@ -2239,9 +1545,15 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 
 		case AbccMisoStates::MessageField_CommandExtension:
 		{
-			if (mMsgValidFlag[channel])
+			MsgHeaderFields_t fields;
+
+			if (mMessageHeaders.Find(channel, frame_index, &fields) && (fields.bFlags & MSG_HEADER_VALID_FLAG))
 			{
 				U16 cmdExt = static_cast<U16>(frame.mData1);
+				MsgHeaderInfo_t* psMsgHdr = reinterpret_cast<MsgHeaderInfo_t*>(&frame.mData2);
+				MsgHeaderText_t text;
+
+				FormatMessageHeaderTabularText(psMsgHdr, &fields, display_base, &text);
 
 				if ((mSettings->mMessageSrcIdIndexing) ||
 					(mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed))
@@ -2250,18 +1562,17 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 					const char mosiMsgBanner[] = "-----MOSI MESSAGE-----";
 					const char* msgBanner = (channel == SpiChannel::MISO) ? misoMsgBanner : mosiMsgBanner;
 
-					AddTabularText(msgBanner);
+					AddTabularString(result_text, msgBanner);
 				}
 
 				if (mSettings->mMessageSrcIdIndexing)
 				{
-					WriteTabularText(channel, mMsgSrcStr[channel], NotifEvent::None);
+					WriteTabularText(result_text, channel, text.acSourceId, NotifEvent::None);
 				}
 
 				if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed)
 				{
 					NotifEvent_t notification = NotifEvent::None;
-					MsgHeaderInfo_t* psMsgHdr = reinterpret_cast<MsgHeaderInfo_t*>(&frame.mData2);
 					bool found = false;
 
 					if (IsIndexedAttributeCmd(psMsgHdr->cmd))
@@ -2281,18 +1592,26 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 
 					if (notification == NotifEvent::Alert)
 					{
-						SNPRINTF(mMsgExtStr[channel], sizeof(mMsgExtStr[channel]), "!Extension: %s", str);
+						SNPRINTF(text.acExtension, sizeof(text.acExtension), "!Extension: %s", str);
 					}
 					else
 					{
-						SNPRINTF(mMsgExtStr[channel], sizeof(mMsgExtStr[channel]), "Extension: %s", str);
+						SNPRINTF(text.acExtension, sizeof(text.acExtension), "Extension: %s", str);
 					}
 
-					WriteTabularText(channel, mMsgSizeStr[channel], NotifEvent::None);
-					WriteTabularText(channel, mMsgObjStr[channel], NotifEvent::None);
-					WriteTabularText(channel, mMsgInstStr[channel], NotifEvent::None);
-					WriteTabularText(channel, mMsgCmdStr[channel], NotifEvent::None);
-					WriteTabularText(channel, mMsgExtStr[channel], NotifEvent::None);
+					WriteTabularText(result_text, channel, text.acSize, NotifEvent::None);
+					WriteTabularText(result_text, channel, text.acObject, NotifEvent::None);
+					WriteTabularText(result_text, channel, text.acInstance, NotifEvent::None);
+					WriteTabularText(result_text, channel, text.acCommand, NotifEvent::None);
+					WriteTabularText(result_text, channel, text.acExtension, NotifEvent::None);
+
+					const char* alert = GetTransactionAlert(result_text, channel, frame_index);
+
+					if (alert != nullptr)
+					{
+						SNPRINTF(str, sizeof(str), "Transaction: %s", alert);
+						WriteTabularText(result_text, channel, str, NotifEvent::Alert);
+					}
 
 					SegmentationType segmentation = GetMessageSegmentationType(psMsgHdr);
 
@@ -2354,13 +1673,13 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 
 						if (addSegment)
 						{
-							WriteTabularText(channel, str, notification);
+							WriteTabularText(result_text, channel, str, notification);
 						}
 					}
 
 					if (frame.HasFlag(SPI_MSG_FIRST_FRAG_FLAG))
 					{
-						WriteTabularText(channel, "First Fragment; More Follow.", NotifEvent::None);
+						WriteTabularText(result_text, channel, "First Fragment; More Follow.", NotifEvent::None);
 					}
 				}
 				else if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Compact)
@@ -2368,35 +1687,36 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 					const char misoTag[] = MISO_TAG_STR;
 					const char mosiTag[] = MOSI_TAG_STR;
 					const char* tag = (channel == SpiChannel::MISO) ? misoTag : mosiTag;
+					const char* alert = GetTransactionAlert(result_text, channel, frame_index);
 
-					SNPRINTF(mMsgExtStr[channel], sizeof(mMsgExtStr[channel]), "%04Xh}", cmdExt);
+					SNPRINTF(text.acExtension, sizeof(text.acExtension), "%04Xh}", cmdExt);
 
-					if (mMsgErrorRspFlag[channel])
+					if (((psMsgHdr->cmd & ABP_MSG_HEADER_E_BIT) != 0) || (alert != nullptr))
 					{
-						AddTabularText(tag, "!",
-							mMsgObjStr[channel],
-							mMsgInstStr[channel],
-							mMsgCmdStr[channel],
-							mMsgExtStr[channel]);
+						AddTabularString(result_text, tag, "!",
+							text.acObject,
+							text.acInstance,
+							text.acCommand,
+							text.acExtension);
 					}
 					else
 					{
 						if (frame.HasFlag(SPI_MSG_FIRST_FRAG_FLAG))
 						{
-							AddTabularText(tag,
-								mMsgObjStr[channel],
-								mMsgInstStr[channel],
-								mMsgCmdStr[channel],
-								mMsgExtStr[channel],
+							AddTabularString(result_text, tag,
+								text.acObject,
+								text.acInstance,
+								text.acCommand,
+								text.acExtension,
 								"++");
 						}
 						else
 						{
-							AddTabularText(tag,
-								mMsgObjStr[channel],
-								mMsgInstStr[channel],
-								mMsgCmdStr[channel],
-								mMsgExtStr[channel]);
+							AddTabularString(result_text, tag,
+								text.acObject,
+								text.acInstance,
+								text.acCommand,
+								text.acExtension);
 						}
 					}
 				}
@@ -2412,80 +1732,40 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 			NotifEvent_t notification = NotifEvent::None;
 			MsgDataFrameData2_t* info = (MsgDataFrameData2_t*)&frame.mData2;
 
-			if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
+			if (frame.HasFlag(SPI_AGGREGATED_FRAME_FLAG))
 			{
-				const U16 nwSpecErrCodeOffset = 2;
-				char errorStr[FORMATTED_STRING_BUFFER_SIZE];
-
-				// The error response may be composed of one to three bytes.
-				// This payload can represent a common error response,
-				// an object specific error response, or a network specific
-				// error response.
-
-				if (info->msgDataCnt == 0)
-				{
-					notification = GetErrorRspString((U8)frame.mData1, str, sizeof(str), display_base);
-					SNPRINTF(errorStr, sizeof(errorStr), "Error Code: %s", str);
-					WriteTabularText(channel, errorStr, notification);
-				}
-				else if (info->msgDataCnt <= nwSpecErrCodeOffset)
-				{
-					U8 nwTypeIdx = 0;
-					bool nwSpecificError = (info->msgDataCnt == nwSpecErrCodeOffset);
-
-					if (nwSpecificError)
-					{
-						nwTypeIdx = static_cast<U8>(mSettings->mNetworkType);
-					}
-
-					notification = GetErrorRspString(nwSpecificError, nwTypeIdx, info->msgHeader.obj, (U8)frame.mData1, str, sizeof(str), display_base);
-
-					if (nwSpecificError)
-					{
-						SNPRINTF(errorStr, sizeof(errorStr), "Network Error: %s", str);
-					}
-					else
-					{
-						SNPRINTF(errorStr, sizeof(errorStr), "Object Error: %s", str);
-					}
+				// Only the leading bytes of a run (error response or exception
+				// code) are described, as a single entry
+				U8 data[3];
+				U32 count = GET_AGGREGATED_FRAME_LENGTH(frame.mData1);
+				size_t length = 0;
 
-					WriteTabularText(channel, errorStr, notification);
-				}
-			}
-			else if (channel == SpiChannel::MISO)
-			{
-				bool nwObject = (info->msgHeader.obj == ABP_OBJ_NUM_NW);
-				bool exception = false;
-				bool attribute = IsAttributeCmd(info->msgHeader.cmd);
-				bool firstAttributeByte = (attribute && (info->msgDataCnt == 0));
+				count = mFrameData.Read(GET_AGGREGATED_FRAME_OFFSET(frame.mData1), data, (count < sizeof(data)) ? count : (U32)sizeof(data));
 
-				if (firstAttributeByte)
+				for (U32 i = 0; i < count; i++)
 				{
-					U16 tableIndex;
+					NotifEvent_t byteNotification = NotifEvent::None;
+					U16 msgDataCnt = (U16)(info->msgDataCnt + i);
+					bool errorRsp = frame.HasFlag(SPI_PROTO_EVENT_FLAG) && IsErrorRspByte(info->msgDataCnt, data[0], msgDataCnt);
 
-					if (GetExceptionTableIndex(nwObject, (U8)mSettings->mNetworkType, &info->msgHeader, &tableIndex))
+					if (FormatMessageDataTabularText(channel, &info->msgHeader, msgDataCnt, errorRsp, data[i], display_base, &str[length], sizeof(str) - length, &byteNotification))
 					{
-						notification = GetExceptionString(nwObject, tableIndex, (U8)frame.mData1, str, sizeof(str), display_base);
-						exception = true;
+						length = strlen(str);
+						length += SNPRINTF(&str[length], sizeof(str) - length, ", ");
+						notification = (byteNotification != NotifEvent::None) ? byteNotification : notification;
 					}
 				}
 
-				if (exception)
+				if (length > 0)
 				{
-					char excepStr[FORMATTED_STRING_BUFFER_SIZE];
-
-					if (nwObject)
-					{
-						SNPRINTF(excepStr, sizeof(excepStr), "Exception Info: %s", str);
-						WriteTabularText(channel, excepStr, notification);
-					}
-					else
-					{
-						SNPRINTF(excepStr, sizeof(excepStr), "Exception Code: %s", str);
-						WriteTabularText(channel, excepStr, notification);
-					}
+					str[length - 2] = '\0';
+					WriteTabularText(result_text, channel, str, notification);
 				}
 			}
+			else if (FormatMessageDataTabularText(channel, &info->msgHeader, info->msgDataCnt, frame.HasFlag(SPI_PROTO_EVENT_FLAG), (U8)frame.mData1, display_base, str, sizeof(str), &notification))
+			{
+				WriteTabularText(result_text, channel, str, notification);
+			}
 
 			break;
 		}
@@ -2495,7 +1775,7 @@ void SpiAnalyzerResults::GenerateMessageTabularText(SpiChannel_t channel, Frame
 	}
 }
 
-void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame, DisplayBase display_base)
+void SpiAnalyzerResults::GenerateMosiTabularText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base)
 {
 	char str[FORMATTED_STRING_BUFFER_SIZE];
 
@@ -2514,7 +1794,7 @@ void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame,
 				if (addEntry)
 				{
 					SNPRINTF(str, sizeof(str), "Application Status: %s", appStsStr);
-					WriteTabularText(SpiChannel::NotSpecified, str, notification);
+					WriteTabularText(result_text, SpiChannel::NotSpecified, str, notification);
 				}
 			}
 
@@ -2523,13 +1803,11 @@ void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame,
 
 		case AbccMosiStates::SpiControl:
 		{
-			mMsgValidFlag[SpiChannel::MOSI] = ((frame.mData1 & ABP_SPI_CTRL_M) != 0);
-
 			if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
 			{
 				if (frame_index != 0)
 				{
-					WriteTabularText(SpiChannel::MOSI, "{Message Retransmit}", NotifEvent::None);
+					WriteTabularText(result_text, SpiChannel::MOSI, "{Message Retransmit}", NotifEvent::None);
 					return;
 				}
 			}
@@ -2541,12 +1819,12 @@ void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame,
 					if (frame.mData1 & ABP_SPI_CTRL_LAST_FRAG)
 					{
 						/* Last fragment */
-						WriteTabularText(SpiChannel::MOSI, "{Message Fragment}", NotifEvent::None);
+						WriteTabularText(result_text, SpiChannel::MOSI, "{Message Fragment}", NotifEvent::None);
 					}
 					else
 					{
 						/* More fragments follow */
-						WriteTabularText(SpiChannel::MOSI, "{Message Fragment}++", NotifEvent::None);
+						WriteTabularText(result_text, SpiChannel::MOSI, "{Message Fragment}++", NotifEvent::None);
 					}
 				}
 
@@ -2569,7 +1847,7 @@ void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame,
 			** then add as a single text entry. */
 			if (mSettings->mMessageIndexingVerbosityLevel != MessageIndexing::Disabled)
 			{
-				GenerateMessageTabularText(SpiChannel::MOSI, frame, display_base);
+				GenerateMessageTabularText(result_text, SpiChannel::MOSI, frame_index, frame, display_base);
 			}
 
 			break;
@@ -2581,7 +1859,7 @@ void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame,
 
 			if (crcError && mSettings->mErrorIndexing)
 			{
-				WriteTabularText(SpiChannel::MOSI, "CRC32", NotifEvent::Alert);
+				WriteTabularText(result_text, SpiChannel::MOSI, "CRC32", NotifEvent::Alert);
 			}
 
 			break;
@@ -2594,7 +1872,7 @@ void SpiAnalyzerResults::GenerateMosiTabularText(U64 frame_index, Frame &frame,
 
 }
 
-void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame, DisplayBase display_base)
+void SpiAnalyzerResults::GenerateMisoTabularText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base)
 {
 	char str[FORMATTED_STRING_BUFFER_SIZE];
 
@@ -2629,9 +1907,12 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 				U64 packetId = GetPacketContainingFrame(frame_index);
 				U32 delta = ((NetworkTimeInfo_t*)&frame.mData2)->deltaTime;
 				SNPRINTF(str, sizeof(str), "0x%08X (Delta: 0x%08X)", (U32)frame.mData1, delta);
-				AddTabularText("Time: ", str);
+				AddTabularString(result_text, "Time: ", str);
 				SNPRINTF(str, sizeof(str), "Packet: 0x%016llX", packetId);
-				AddTabularText(str);
+				AddTabularString(result_text, str);
+
+				// The packet may not be committed yet
+				result_text->fCacheable = false;
 			}
 
 			break;
@@ -2647,7 +1928,7 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 			if (addEntry)
 			{
 				SNPRINTF(str, sizeof(str), "Anybus Status: (%s)", anbSts);
-				WriteTabularText(SpiChannel::MISO, str, notification);
+				WriteTabularText(result_text, SpiChannel::MISO, str, notification);
 			}
 
 			break;
@@ -2657,11 +1938,9 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 		{
 			if (mSettings->mMessageIndexingVerbosityLevel != MessageIndexing::Disabled)
 			{
-				mMsgValidFlag[SpiChannel::MISO] = ((frame.mData1 & ABP_SPI_STATUS_M) != 0);
-
 				if (frame.HasFlag(SPI_PROTO_EVENT_FLAG))
 				{
-					WriteTabularText(SpiChannel::MISO, "{Write Message Buffer Full}", NotifEvent::None);
+					WriteTabularText(result_text, SpiChannel::MISO, "{Write Message Buffer Full}", NotifEvent::None);
 				}
 				else if (frame.HasFlag(SPI_MSG_FRAG_FLAG) && !frame.HasFlag(SPI_MSG_FIRST_FRAG_FLAG))
 				{
@@ -2671,12 +1950,12 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 						if (frame.mData1 & ABP_SPI_STATUS_LAST_FRAG)
 						{
 							/* Last fragment */
-							WriteTabularText(SpiChannel::MISO, "{Message Fragment}", NotifEvent::None);
+							WriteTabularText(result_text, SpiChannel::MISO, "{Message Fragment}", NotifEvent::None);
 						}
 						else
 						{
 							/* More fragments follow */
-							WriteTabularText(SpiChannel::MISO, "{Message Fragment}++", NotifEvent::None);
+							WriteTabularText(result_text, SpiChannel::MISO, "{Message Fragment}++", NotifEvent::None);
 						}
 					}
 				}
@@ -2698,7 +1977,7 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 			** then add as a single text entry. */
 			if (mSettings->mMessageIndexingVerbosityLevel != MessageIndexing::Disabled)
 			{
-				GenerateMessageTabularText(SpiChannel::MISO, frame, display_base);
+				GenerateMessageTabularText(result_text, SpiChannel::MISO, frame_index, frame, display_base);
 			}
 
 			break;
@@ -2710,7 +1989,7 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 
 			if (crcError && mSettings->mErrorIndexing)
 			{
-				WriteTabularText(SpiChannel::MISO, "CRC32", NotifEvent::Alert);
+				WriteTabularText(result_text, SpiChannel::MISO, "CRC32", NotifEvent::Alert);
 			}
 
 			break;
@@ -2724,7 +2003,52 @@ void SpiAnalyzerResults::GenerateMisoTabularText(U64 frame_index, Frame &frame,
 
 void SpiAnalyzerResults::GenerateFrameTabularText(U64 frame_index, DisplayBase display_base)
 {
+	U64 key = AbccTextCache::GetKey(frame_index, TextKind::Tabular, SpiChannel::NotSpecified, display_base);
+	U32 generation = mTextCache.GetGeneration();
+	ResultText_t resultText;
+
 	ClearTabularText();
+
+	if (mTextCache.Find(key, &resultText.asStrings))
+	{
+		for (const std::string& str : resultText.asStrings)
+		{
+			AddTabularText(str.c_str());
+		}
+
+		return;
+	}
+
+	// Cleared by the frames whose text depends on packets not yet committed
+	resultText.fCacheable = true;
+	BuildFrameTabularText(&resultText, frame_index, display_base);
+
+	if (resultText.fCacheable)
+	{
+		mTextCache.Insert(key, generation, &resultText.asStrings);
+	}
+}
+
+void SpiAnalyzerResults::BuildFrameTabularText(ResultText_t* result_text, U64 frame_index, DisplayBase display_base)
+{
+	if (mSettings->mIndexGranularity == IndexGranularity::Packets)
+	{
+		U64 packetId;
+
+		// The summary of a packet is the text of its first frame
+		if (mPacketSummaries.FindPacketStartingAt(frame_index, &packetId))
+		{
+			BuildPacketTabularText(result_text, packetId, display_base);
+		}
+		else if (GetPacketContainingFrame(frame_index) == INVALID_RESULT_INDEX)
+		{
+			// The packet may not be committed yet
+			result_text->fCacheable = false;
+		}
+
+		return;
+	}
+
 	Frame frame = GetFrame(frame_index);
 
 	if (mSettings->mErrorIndexing)
@@ -2739,14 +2063,14 @@ void SpiAnalyzerResults::GenerateFrameTabularText(U64 frame_index, DisplayBase d
 				switch (frame.mType)
 				{
 					case AbccSpiError::Fragmentation:
-						WriteTabularText(SpiChannel::NotSpecified, "FRAGMENT: ABCC SPI Packet is Fragmented", NotifEvent::Alert);
+						WriteTabularText(result_text, SpiChannel::NotSpecified, "FRAGMENT: ABCC SPI Packet is Fragmented", NotifEvent::Alert);
 						break;
 					case AbccSpiError::EndOfTransfer:
-						WriteTabularText(SpiChannel::NotSpecified, "CLOCKING: Unexpected ABCC SPI Clocking Behavior", NotifEvent::Alert);
+						WriteTabularText(result_text, SpiChannel::NotSpecified, "CLOCKING: Unexpected ABCC SPI Clocking Behavior", NotifEvent::Alert);
 						break;
 					case AbccSpiError::Generic:
 					default:
-						WriteTabularText(SpiChannel::NotSpecified, "ERROR: General Error in ABCC SPI Communication", NotifEvent::Alert);
+						WriteTabularText(result_text, SpiChannel::NotSpecified, "ERROR: General Error in ABCC SPI Communication", NotifEvent::Alert);
 						break;
 				}
 			}
@@ -2757,22 +2081,340 @@ void SpiAnalyzerResults::GenerateFrameTabularText(U64 frame_index, DisplayBase d
 
 	if (IS_MOSI_FRAME(frame))
 	{
-		GenerateMosiTabularText(frame_index, frame, display_base);
+		GenerateMosiTabularText(result_text, frame_index, frame, display_base);
 	}
 	else
 	{
-		GenerateMisoTabularText(frame_index, frame, display_base);
+		GenerateMisoTabularText(result_text, frame_index, frame, display_base);
 	}
 }
 
-void SpiAnalyzerResults::GeneratePacketTabularText(U64 /*packet_id*/, DisplayBase /*display_base*/) //unreferenced vars commented out to remove warnings.
+void SpiAnalyzerResults::GeneratePacketTabularText(U64 packet_id, DisplayBase display_base)
 {
-	ClearResultStrings();
-	AddResultString("not supported");
+	ResultText_t resultText;
+
+	ClearTabularText();
+	BuildPacketTabularText(&resultText, packet_id, display_base);
 }
 
-void SpiAnalyzerResults::GenerateTransactionTabularText(U64 /*transaction_id*/, DisplayBase /*display_base*/) //unreferenced vars commented out to remove warnings.
+/*
+** A single entry per packet. The indexing settings select the parts of the
+** summary as they select the entries of the frames; packets without any
+** part get no entry.
+*/
+void SpiAnalyzerResults::BuildPacketTabularText(ResultText_t* result_text, U64 packet_id, DisplayBase display_base)
 {
-	ClearResultStrings();
-	AddResultString("not supported");
+	PacketSummary_t packet;
+	std::string summary;
+	char str[FORMATTED_STRING_BUFFER_SIZE];
+
+	if (!mPacketSummaries.GetSummary(packet_id, &packet))
+	{
+		return;
+	}
+
+	if (mSettings->mErrorIndexing)
+	{
+		if (packet.wFlags & PACKET_SUMMARY_FRAGMENTATION_ERROR)
+		{
+			AppendSummaryText(&summary, SpiChannel::NotSpecified, "FRAGMENT: ABCC SPI Packet is Fragmented", NotifEvent::Alert);
+		}
+
+		if (packet.wFlags & PACKET_SUMMARY_CLOCKING_ERROR)
+		{
+			AppendSummaryText(&summary, SpiChannel::NotSpecified, "CLOCKING: Unexpected ABCC SPI Clocking Behavior", NotifEvent::Alert);
+		}
+
+		if (packet.wFlags & PACKET_SUMMARY_GENERIC_ERROR)
+		{
+			AppendSummaryText(&summary, SpiChannel::NotSpecified, "ERROR: General Error in ABCC SPI Communication", NotifEvent::Alert);
+		}
+
+		for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+		{
+			if (packet.asMsg[i].bFlags & PACKET_MSG_CRC_ERROR)
+			{
+				AppendSummaryText(&summary, (SpiChannel_t)i, "CRC32", NotifEvent::Alert);
+			}
+		}
+	}
+
+	if (packet.wFlags & PACKET_SUMMARY_ANB_STATUS_CHANGE)
+	{
+		char anbSts[FORMATTED_STRING_BUFFER_SIZE];
+		NotifEvent_t notification = GetAbccStatusString(packet.bAnbStatus, anbSts, sizeof(anbSts), display_base);
+
+		if (mSettings->mAnybusStatusIndexing || ((notification == NotifEvent::Alert) && mSettings->mErrorIndexing))
+		{
+			SNPRINTF(str, sizeof(str), "Anybus Status: (%s)", anbSts);
+			AppendSummaryText(&summary, SpiChannel::MISO, str, notification);
+		}
+	}
+
+	if (packet.wFlags & PACKET_SUMMARY_APPL_STATUS_CHANGE)
+	{
+		char appStsStr[FORMATTED_STRING_BUFFER_SIZE];
+		NotifEvent_t notification = GetApplStsString(packet.bApplStatus, appStsStr, sizeof(appStsStr), display_base);
+
+		if (mSettings->mApplStatusIndexing || ((notification == NotifEvent::Alert) && mSettings->mErrorIndexing))
+		{
+			SNPRINTF(str, sizeof(str), "Application Status: %s", appStsStr);
+			AppendSummaryText(&summary, SpiChannel::NotSpecified, str, notification);
+		}
+	}
+
+	if (mSettings->mMessageIndexingVerbosityLevel != MessageIndexing::Disabled)
+	{
+		if ((packet.wFlags & PACKET_SUMMARY_RETRANSMIT) && (packet_id != 0))
+		{
+			AppendSummaryText(&summary, SpiChannel::MOSI, "{Message Retransmit}", NotifEvent::None);
+		}
+
+		if (packet.wFlags & PACKET_SUMMARY_WRMSG_FULL)
+		{
+			AppendSummaryText(&summary, SpiChannel::MISO, "{Write Message Buffer Full}", NotifEvent::None);
+		}
+
+		BuildPacketMessageText(SpiChannel::MOSI, &packet.asMsg[SpiChannel::MOSI], display_base, &summary);
+		BuildPacketMessageText(SpiChannel::MISO, &packet.asMsg[SpiChannel::MISO], display_base, &summary);
+	}
+
+	if (packet.wFlags & PACKET_SUMMARY_NETWORK_TIME)
+	{
+		bool addEntry;
+
+		switch (mSettings->mTimestampIndexing)
+		{
+			case TimestampIndexing::AllPackets:
+				addEntry = true;
+				break;
+
+			case TimestampIndexing::WriteProcessDataValid:
+				addEntry = ((packet.wFlags & PACKET_SUMMARY_WR_PD_VALID) != 0);
+				break;
+
+			case TimestampIndexing::NewReadProcessData:
+				addEntry = ((packet.wFlags & PACKET_SUMMARY_NEW_RD_PD) != 0);
+				break;
+
+			default:
+			case TimestampIndexing::Disabled:
+				addEntry = false;
+				break;
+		}
+
+		if (addEntry)
+		{
+			SNPRINTF(str, sizeof(str), "Time: 0x%08X", packet.dwNetworkTime);
+			AppendSummaryText(&summary, SpiChannel::NotSpecified, str, NotifEvent::None);
+		}
+	}
+
+	if (!summary.empty())
+	{
+		SNPRINTF(str, sizeof(str), "Packet: 0x%016llX" SUMMARY_SEPARATOR_STR, packet_id);
+		AddTabularString(result_text, str, summary.c_str());
+	}
+}
+
+void SpiAnalyzerResults::BuildPacketMessageText(SpiChannel_t channel, const PacketMsgSummary_t* msg, DisplayBase display_base, std::string* summary)
+{
+	const MsgHeaderInfo_t* header = &msg->sHeader;
+	char str[FORMATTED_STRING_BUFFER_SIZE];
+	bool errorRsp;
+	bool commandMsg;
+	const char* moreFragments;
+
+	if (!(msg->bFlags & PACKET_MSG_VALID))
+	{
+		return;
+	}
+
+	if (msg->bFlags & PACKET_MSG_FRAG)
+	{
+		/* Fragmentation is in progress */
+		if (msg->bFlags & PACKET_MSG_LAST_FRAG)
+		{
+			AppendSummaryText(summary, channel, "{Message Fragment}", NotifEvent::None);
+		}
+		else
+		{
+			AppendSummaryText(summary, channel, "{Message Fragment}++", NotifEvent::None);
+		}
+
+		return;
+	}
+
+	if ((msg->bFlags & PACKET_MSG_SIZE_ERROR) && mSettings->mErrorIndexing)
+	{
+		AppendSummaryText(summary, channel, "Message Size: Exceeds Maximum", NotifEvent::Alert);
+	}
+
+	if (!(msg->bFlags & PACKET_MSG_HEADER))
+	{
+		return;
+	}
+
+	errorRsp = ((header->cmd & ABP_MSG_HEADER_E_BIT) != 0);
+	commandMsg = ((header->cmd & ABP_MSG_HEADER_C_BIT) != 0);
+	moreFragments = (msg->bFlags & PACKET_MSG_FIRST_FRAG) ? "++" : "";
+
+	if (mSettings->mMessageSrcIdIndexing)
+	{
+		SNPRINTF(str, sizeof(str), "Source ID: %d (0x%02X)", msg->bSourceId, msg->bSourceId);
+		AppendSummaryText(summary, channel, str, NotifEvent::None);
+	}
+
+	if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Detailed)
+	{
+		char objStr[FORMATTED_STRING_BUFFER_SIZE];
+		char instStr[FORMATTED_STRING_BUFFER_SIZE];
+		char cmdStr[FORMATTED_STRING_BUFFER_SIZE];
+		char extStr[FORMATTED_STRING_BUFFER_SIZE];
+		char entry[FORMATTED_STRING_BUFFER_SIZE * 4];
+		NotifEvent_t notification = NotifEvent::None;
+		NotifEvent_t entryNotification = NotifEvent::None;
+		bool found = false;
+
+		if (GetCmdString(header->cmd, header->obj, cmdStr, sizeof(cmdStr), display_base) == NotifEvent::Alert)
+		{
+			entryNotification = NotifEvent::Alert;
+		}
+
+		if (GetObjectString(header->obj, objStr, sizeof(objStr), display_base) == NotifEvent::Alert)
+		{
+			entryNotification = NotifEvent::Alert;
+		}
+
+		if (!GetInstString((U8)mSettings->mNetworkType, header->obj, header->inst, instStr, sizeof(instStr), &notification, display_base))
+		{
+			SNPRINTF(instStr, sizeof(instStr), "%d (0x%04X)", header->inst, header->inst);
+		}
+
+		if (IsIndexedAttributeCmd(header->cmd))
+		{
+			found = GetAttrString(header->obj, header->inst, header->cmdExt, extStr, sizeof(extStr), AttributeAccessMode::Indexed, &notification, display_base);
+		}
+		else if (IsNonIndexedAttributeCmd(header->cmd))
+		{
+			found = GetAttrString(header->obj, header->inst, header->cmdExt, extStr, sizeof(extStr), AttributeAccessMode::Normal, &notification, display_base);
+		}
+
+		if (!found)
+		{
+			SNPRINTF(extStr, sizeof(extStr), "%d (0x%04X)", header->cmdExt, header->cmdExt);
+		}
+
+		if (errorRsp || notification)
+		{
+			entryNotification = NotifEvent::Alert;
+		}
+
+		SNPRINTF(entry, sizeof(entry), "%s: %s, Object: %s, Instance: %s, Extension: %s, Size: %u Bytes%s",
+			commandMsg ? "Command" : "Response", cmdStr, objStr, instStr, extStr, msg->wSize, moreFragments);
+		AppendSummaryText(summary, channel, entry, entryNotification);
+	}
+	else if (mSettings->mMessageIndexingVerbosityLevel == MessageIndexing::Compact)
+	{
+		SNPRINTF(str, sizeof(str), "Obj {%02X:%04Xh}, %s {%02X:%04Xh}%s",
+			header->obj, header->inst,
+			commandMsg ? "Cmd" : "Rsp", (U8)(header->cmd & ABP_MSG_HEADER_CMD_BITS), header->cmdExt,
+			errorRsp ? "" : moreFragments);
+		AppendSummaryText(summary, channel, str, errorRsp ? NotifEvent::Alert : NotifEvent::None);
+	}
+}
+
+/*
+** A single entry per transaction, the packets of a command and its response
+** are grouped by GroupTransactionPackets() with the transaction index as ID.
+*/
+void SpiAnalyzerResults::GenerateTransactionTabularText(U64 transaction_id, DisplayBase display_base)
+{
+	ResultText_t resultText;
+	AbccTransaction_t transaction;
+	std::string summary;
+	char objStr[FORMATTED_STRING_BUFFER_SIZE];
+	char cmdStr[FORMATTED_STRING_BUFFER_SIZE];
+	char str[FORMATTED_STRING_BUFFER_SIZE * 3];
+	NotifEvent_t notification = NotifEvent::None;
+	bool commandSeen;
+	SpiChannel_t commandChannel;
+	SpiChannel_t responseChannel;
+
+	ClearTabularText();
+
+	if (!mTransactions.GetTransaction(transaction_id, &transaction))
+	{
+		return;
+	}
+
+	commandSeen = (transaction.lCommandMessage != INVALID_MESSAGE_INDEX);
+	commandChannel = (transaction.bFlags & ABCC_TRANSACTION_MOSI_COMMAND_FLAG) ? SpiChannel::MOSI : SpiChannel::MISO;
+	responseChannel = (commandChannel == SpiChannel::MOSI) ? SpiChannel::MISO : SpiChannel::MOSI;
+
+	if (GetCmdString(transaction.sHeader.cmd, transaction.sHeader.obj, cmdStr, sizeof(cmdStr), display_base) == NotifEvent::Alert)
+	{
+		notification = NotifEvent::Alert;
+	}
+
+	if (GetObjectString(transaction.sHeader.obj, objStr, sizeof(objStr), display_base) == NotifEvent::Alert)
+	{
+		notification = NotifEvent::Alert;
+	}
+
+	// The header is that of the command, or of a response without a command
+	SNPRINTF(str, sizeof(str), "%s: %s, Object: %s, Source ID: %d (0x%02X)",
+		commandSeen ? "Command" : "Response", cmdStr, objStr, transaction.bSourceId, transaction.bSourceId);
+	AppendSummaryText(&summary, commandSeen ? commandChannel : responseChannel, str, notification);
+
+	if (transaction.bFlags & ABCC_TRANSACTION_REUSED_SOURCE_ID_FLAG)
+	{
+		AppendSummaryText(&summary, commandChannel, REUSED_SRC_ID_STR, NotifEvent::Alert);
+	}
+
+	if (transaction.lResponseMessage == INVALID_MESSAGE_INDEX)
+	{
+		if (transaction.bFlags & ABCC_TRANSACTION_SUPERSEDED_FLAG)
+		{
+			AppendSummaryText(&summary, commandChannel, SUPERSEDED_CMD_STR, NotifEvent::Alert);
+		}
+		else
+		{
+			AppendSummaryText(&summary, responseChannel, "No Response", NotifEvent::None);
+		}
+	}
+	else
+	{
+		if (transaction.bFlags & ABCC_TRANSACTION_ERROR_RESPONSE_FLAG)
+		{
+			AppendSummaryText(&summary, responseChannel, "Error Response", NotifEvent::Alert);
+		}
+
+		if (transaction.bFlags & ABCC_TRANSACTION_ORPHANED_FLAG)
+		{
+			AppendSummaryText(&summary, responseChannel, ORPHANED_RSP_STR, NotifEvent::Alert);
+		}
+
+		if (transaction.bFlags & ABCC_TRANSACTION_DUPLICATED_FLAG)
+		{
+			AppendSummaryText(&summary, responseChannel, DUPLICATED_RSP_STR, NotifEvent::Alert);
+		}
+
+		if (transaction.bFlags & ABCC_TRANSACTION_MISMATCH_FLAG)
+		{
+			AppendSummaryText(&summary, responseChannel, MISMATCHED_RSP_STR, NotifEvent::Alert);
+		}
+
+		if (commandSeen && (mAnalyzer->GetSampleRate() != 0))
+		{
+			// From the start of the command to the end of the response
+			double latency = (double)(transaction.lResponseEndSample - transaction.lCommandStartSample) / (double)mAnalyzer->GetSampleRate();
+
+			SNPRINTF(str, sizeof(str), "Latency: %.3f us", latency * 1e6);
+			AppendSummaryText(&summary, SpiChannel::NotSpecified, str, NotifEvent::None);
+		}
+	}
+
+	SNPRINTF(str, sizeof(str), "Transaction: 0x%016llX" SUMMARY_SEPARATOR_STR, transaction_id);
+	AddTabularString(&resultText, str, summary.c_str());
 }
@@ -13,15 +13,20 @@
 #define ABCC_SPI_ANALYZER_RESULTS_H
 
 #include "AnalyzerResults.h"
+#include "AbccByteArena.h"
+#include "AbccMessageHeaderIndex.h"
+#include "AbccMessageTable.h"
+#include "AbccPacketSummaryTable.h"
+#include "AbccTransactionIndex.h"
+#include "AbccTextCache.h"
 #include "AbccSpiAnalyzerTypes.h"
 
 #ifndef FORMATTED_STRING_BUFFER_SIZE
 #define FORMATTED_STRING_BUFFER_SIZE 256
 #endif
 
-#ifndef NUM_DATA_CHANNELS
-#define NUM_DATA_CHANNELS 2
-#endif
+/* Leading bytes of an aggregated frame shown in its bubble */
+#define MAX_BLOCK_BUBBLE_TEXT_BYTES 32
 
 enum class ErrorEvent : U32
 {
@@ -29,12 +34,24 @@ enum class ErrorEvent : U32
 	RetransmitWarning,
 	CrcError,
 	SpiFragmentationError,
+	OrphanedResponse,
+	DuplicatedResponse,
+	MismatchedResponse,
+	ReusedSourceId,
 	SizeOfEnum
 };
 
 class SpiAnalyzer;
 class SpiAnalyzerSettings;
 
+/*
+** @brief The frames and packets of a capture, and the stores built from them
+**        as they are decoded (messages, transactions, packet summaries, ...).
+**
+** The analyzer thread adds to the stores while the text and exports are
+** generated from other threads. Each store serializes the accesses to itself,
+** so it can be read at any time without further locking.
+*/
 class SpiAnalyzerResults : public AnalyzerResults
 {
 public:
@@ -49,7 +66,59 @@ public:
 	virtual void GeneratePacketTabularText(U64 packet_id, DisplayBase display_base);
 	virtual void GenerateTransactionTabularText(U64 transaction_id, DisplayBase display_base);
 
-	virtual U64 GetFrameIdOfAbccFieldContainedInPacket(U64 packet_index, SpiChannel_t channel, U8 type);
+	/* Discards the cached text derived from the presentation
+	** settings. Called when only those settings changed, the frames themselves
+	** are kept. */
+	void InvalidateText();
+
+	/*******************************************************************************
+	** @brief Store the bytes of an aggregated frame.
+	**
+	** @return The reference to keep in the frame's mData1.
+	*/
+	U64 AddFrameData(const U8* data, U32 length);
+
+	/*******************************************************************************
+	** @brief The complete messages of the capture, built as the frames are added.
+	*/
+	AbccMessageTable* GetMessageTable()
+	{
+		return &mMessages;
+	}
+
+	/*******************************************************************************
+	** @brief The fields of the message headers, built as the frames are added.
+	*/
+	AbccMessageHeaderIndex* GetMessageHeaderIndex()
+	{
+		return &mMessageHeaders;
+	}
+
+	/*******************************************************************************
+	** @brief The commands of the capture paired with their responses.
+	*/
+	AbccTransactionIndex* GetTransactionIndex()
+	{
+		return &mTransactions;
+	}
+
+	/*******************************************************************************
+	** @brief The summary of each packet, built as the frames are added.
+	*/
+	AbccPacketSummaryTable* GetPacketSummaryTable()
+	{
+		return &mPacketSummaries;
+	}
+
+	/*******************************************************************************
+	** @brief Group the packets of the transactions completed since the last call,
+	**        so Logic can navigate between a command and its response. Called
+	**        after the transaction index was updated.
+	**
+	** A packet can only be part of one transaction, while it may carry the
+	** messages of two; it is kept in the first transaction completed with it.
+	*/
+	void GroupTransactionPackets();
 
 protected: /* Enums, Types, and Classes */
 
@@ -60,91 +129,76 @@ protected: /* Enums, Types, and Classes */
 		AbccMosiStates::Enum eMosi;
 	} AbccSpiStatesUnion_t;
 
+	/* The tabular text of the fields of a message header */
+	typedef struct MsgHeaderText
+	{
+		char acSize[FORMATTED_STRING_BUFFER_SIZE];
+		char acSourceId[FORMATTED_STRING_BUFFER_SIZE];
+		char acObject[FORMATTED_STRING_BUFFER_SIZE];
+		char acInstance[FORMATTED_STRING_BUFFER_SIZE];
+		char acCommand[FORMATTED_STRING_BUFFER_SIZE];
+		char acExtension[FORMATTED_STRING_BUFFER_SIZE];
+	} MsgHeaderText_t;
+
+	/* The result strings of the text being generated, kept for the text cache */
+	typedef struct ResultText
+	{
+		std::vector<std::string> asStrings;
+		bool fCacheable;			// Cleared if the text depends on packets or transactions that may still change
+	} ResultText_t;
+
 protected:  /* Members */
 
 	SpiAnalyzerSettings* mSettings;
 	SpiAnalyzer* mAnalyzer;
-	char mMsgSizeStr[NUM_DATA_CHANNELS][FORMATTED_STRING_BUFFER_SIZE];
-	char mMsgSrcStr[NUM_DATA_CHANNELS][FORMATTED_STRING_BUFFER_SIZE];
-	char mMsgObjStr[NUM_DATA_CHANNELS][FORMATTED_STRING_BUFFER_SIZE];
-	char mMsgInstStr[NUM_DATA_CHANNELS][FORMATTED_STRING_BUFFER_SIZE];
-	char mMsgCmdStr[NUM_DATA_CHANNELS][FORMATTED_STRING_BUFFER_SIZE];
-	char mMsgExtStr[NUM_DATA_CHANNELS][FORMATTED_STRING_BUFFER_SIZE];
-	bool mMsgValidFlag[NUM_DATA_CHANNELS];
-	bool mMsgErrorRspFlag[NUM_DATA_CHANNELS];
+	AbccByteArena mFrameData;
+	AbccMessageHeaderIndex mMessageHeaders;
+	AbccMessageTable mMessages;
+	AbccTransactionIndex mTransactions;
+	AbccPacketSummaryTable mPacketSummaries;
+	AbccTextCache mTextCache;
+	U64 mGroupedMessageCount;
+	std::vector<bool> mafGroupedPackets;
 
 protected: /* Methods */
 
-	void WriteBubbleText(const char* tag, const char* value, const char* verbose, NotifEvent_t notification, DisplayPriority disp_priority = DisplayPriority::Tag);
-	void WriteTabularText(SpiChannel_t channel, const char* text, NotifEvent_t notification);
+	/* Add a result string, and keep it for the text cache */
+	void AddBubbleString(ResultText_t* result_text, const char* str1, const char* str2 = nullptr);
+	void AddTabularString(ResultText_t* result_text, const char* str1, const char* str2 = nullptr, const char* str3 = nullptr, const char* str4 = nullptr, const char* str5 = nullptr, const char* str6 = nullptr);
+
+	void WriteBubbleText(ResultText_t* result_text, const char* tag, const char* value, const char* verbose, NotifEvent_t notification, DisplayPriority disp_priority = DisplayPriority::Tag);
+	void WriteTabularText(ResultText_t* result_text, SpiChannel_t channel, const char* text, NotifEvent_t notification);
 	void FormatTabularTextBuffer(char* buffer, size_t buffer_size, const char* tag, const char* text, NotifEvent_t notification);
 
-	void BuildSpiCtrlString(U8 spi_control, DisplayBase display_base);
-	void BuildSpiStsString(U8 spi_status, DisplayBase display_base);
-	bool BuildCmdString(U8 command, U8 obj, DisplayBase display_base);
-	void BuildErrorRsp(U8 error_code, DisplayBase display_base);
-	void BuildErrorRsp(bool nw_spec_err, U8 nw_type_idx, U8 error_code, U8 obj, DisplayBase display_base);
-	void BuildAbccStatus(U8 abcc_status, DisplayBase display_base);
-	void BuildApplStatus(U8 appl_status, DisplayBase display_base);
-	void BuildIntMask(U8 int_mask, DisplayBase display_base);
-	void BuildObjectString(U8 object_num, DisplayBase display_base);
-
-	void BuildInstString(U8 nw_type_idx, U8 obj, U16 inst, DisplayBase display_base);
-	void BuildAttrString(const MsgHeaderInfo_t* msg_header_ptr, U16 attr, AttributeAccessMode_t access_mode, DisplayBase display_base);
-
-	void ExportAllFramesToFile(const char* file, DisplayBase display_base);
-	void ExportMessageDataToFile(const char* file, DisplayBase display_base);
-	void ExportProcessDataToFile(const char* file, DisplayBase display_base);
-
-	void BufferCsvMessageMsgEntry(
-		Frame& frame,
-		std::stringstream& ss_csv_data,
-		bool& align_msg_fields,
-		DisplayBase display_base);
-
-	void BufferCsvMessageMisoEntry(
-		U32 sample_rate,
-		U64 trigger_sample,
-		U64 packet_id,
-		Frame& frame,
-		std::stringstream& ss_csv_head,
-		std::stringstream& ss_csv_body,
-		std::stringstream& ss_csv_tail,
-		ErrorEvent& mosi_event,
-		ErrorEvent& miso_event,
-		bool& fragmentation,
-		bool& anb_stat_reached,
-		bool& align_msg_fields,
-		bool& add_entry,
-		DisplayBase display_base);
-
-	void BufferCsvMessageMosiEntry(
-		U32 sample_rate,
-		U64 trigger_sample,
-		U64 packet_id,
-		Frame &frame,
-		std::stringstream &ss_csv_head,
-		std::stringstream &ss_csv_body,
-		std::stringstream &ss_csv_tail,
-		ErrorEvent &mosi_event,
-		ErrorEvent &miso_event,
-		bool &fragmentation,
-		bool &app_stat_reached,
-		bool &align_msg_fields,
-		bool &add_entry,
-		DisplayBase display_base );
-
-	void AppendCsvHeaderDelimeters(std::stringstream &ss_csv_data, U8 count, bool& add_header_delims);
-	void AppendCsvMessageEntry(void* file, std::stringstream &ss_csv_head, std::stringstream &ss_csv_body, std::stringstream &ss_csv_tail, ErrorEvent event);
-	void AppendCsvSafeString(std::stringstream &ss_csv_data, char* input_data_str, DisplayBase display_base);
-
-	void GenerateMessageTabularText(SpiChannel_t channel, Frame &frame, DisplayBase display_base);
-	void GenerateMisoTabularText(U64 frame_index, Frame &frame, DisplayBase display_base);
-	void GenerateMosiTabularText(U64 frame_index, Frame &frame, DisplayBase display_base);
-
-	void GenerateMessageBubbleText(Frame &frame, DisplayBase display_base);
-	void GenerateMisoBubbleText(Frame &frame, DisplayBase display_base);
-	void GenerateMosiBubbleText(Frame &frame, DisplayBase display_base);
+	void BuildSpiCtrlString(ResultText_t* result_text, U8 spi_control, DisplayBase display_base);
+	void BuildSpiStsString(ResultText_t* result_text, U8 spi_status, DisplayBase display_base);
+	bool BuildCmdString(ResultText_t* result_text, U8 command, U8 obj, const char* transaction_alert, DisplayBase display_base);
+	void BuildErrorRsp(ResultText_t* result_text, U8 error_code, DisplayBase display_base);
+	void BuildErrorRsp(ResultText_t* result_text, bool nw_spec_err, U8 nw_type_idx, U8 error_code, U8 obj, DisplayBase display_base);
+	void BuildAbccStatus(ResultText_t* result_text, U8 abcc_status, DisplayBase display_base);
+	void BuildApplStatus(ResultText_t* result_text, U8 appl_status, DisplayBase display_base);
+	void BuildIntMask(ResultText_t* result_text, U8 int_mask, DisplayBase display_base);
+	void BuildObjectString(ResultText_t* result_text, U8 object_num, DisplayBase display_base);
+
+	void BuildInstString(ResultText_t* result_text, U8 nw_type_idx, U8 obj, U16 inst, DisplayBase display_base);
+	void BuildAttrString(ResultText_t* result_text, const MsgHeaderInfo_t* msg_header_ptr, U16 attr, AttributeAccessMode_t access_mode, DisplayBase display_base);
+
+	bool FormatMessageDataTabularText(SpiChannel_t channel, const MsgHeaderInfo_t* msg_header, U16 msg_data_cnt, bool error_rsp, U8 data, DisplayBase display_base, char* text, size_t size, NotifEvent_t* notification);
+	void FormatMessageHeaderTabularText(const MsgHeaderInfo_t* msg_header, const MsgHeaderFields_t* fields, DisplayBase display_base, MsgHeaderText_t* text);
+	void GenerateMessageTabularText(ResultText_t* result_text, SpiChannel_t channel, U64 frame_index, Frame &frame, DisplayBase display_base);
+	void GroupMessagePackets(U64 transaction_index, const AbccMessage_t& message);
+	void GenerateMisoTabularText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base);
+	void GenerateMosiTabularText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base);
+	void BuildFrameTabularText(ResultText_t* result_text, U64 frame_index, DisplayBase display_base);
+	void BuildPacketTabularText(ResultText_t* result_text, U64 packet_id, DisplayBase display_base);
+	void BuildPacketMessageText(SpiChannel_t channel, const PacketMsgSummary_t* msg, DisplayBase display_base, std::string* summary);
+
+	/* The alert of the transaction flags of a message header, nullptr if none */
+	const char* GetTransactionAlert(ResultText_t* result_text, SpiChannel_t channel, U64 frame_index);
+	void GenerateMessageBubbleText(ResultText_t* result_text, SpiChannel_t channel, U64 frame_index, Frame &frame, DisplayBase display_base);
+	void GenerateBlockBubbleText(ResultText_t* result_text, const char* tag, Frame &frame, DisplayBase display_base, BaseType type, U32 first_byte, DisplayPriority priority);
+	void GenerateMisoBubbleText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base);
+	void GenerateMosiBubbleText(ResultText_t* result_text, U64 frame_index, Frame &frame, DisplayBase display_base);
 };
 
 #endif /* ABCC_SPI_ANALYZER_RESULTS_H */
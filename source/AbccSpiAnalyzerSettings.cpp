@@ -27,7 +27,7 @@
 ** incompatibility is introduced, increment this counter. This should be
 ** maintained at the commit level to improve reliability of custom builds
 ** at any point in the commit history. */
-#define SETTINGS_REVISION_STRING "REVISION_00000012"
+#define SETTINGS_REVISION_STRING "REVISION_00000021"
 
 #define ANALYZER_NAME "AbccSpiAnalyzer"
 
@@ -36,6 +36,14 @@
 #define SCLK_CHANNEL_NAME "SCLK"
 #define NSS_CHANNEL_NAME  "NSS"
 
+/* Defaults of the numeric advanced settings, also used for invalid values */
+#define DEFAULT_PROGRESS_INTERVAL           100000
+#define DEFAULT_3WIRE_PACKET_GAP_NS         10000
+#define DEFAULT_3WIRE_MAX_CLOCK_IDLE_NS     5000
+#define DEFAULT_PD_KEYFRAME_INTERVAL        1000
+#define DEFAULT_JITTER_NOMINAL_CYCLE_NS     0
+#define DEFAULT_JITTER_THRESHOLD_NS         0
+
 /*
 ** Overloads reading the SimpleArchive as a U32 and feeding the result
 ** into an enum class. For this to work the enum class MUST define a
@@ -75,6 +83,24 @@ bool operator>> (SimpleArchive &archive, std::string &value)
 	return true;
 }
 
+/*
+** Parses a numeric advanced setting, falling back to the default when the
+** value is not a number or is outside [min_value, max_value].
+*/
+static S32 ParseS32Setting(const std::string& value, long min_value, long max_value, S32 default_value)
+{
+	char* parseEnd = nullptr;
+	long parsedValue = strtol(value.c_str(), &parseEnd, 0);
+
+	if ((parseEnd != value.c_str()) &&
+		(parsedValue >= min_value) && (parsedValue <= max_value))
+	{
+		return static_cast<S32>(parsedValue);
+	}
+
+	return default_value;
+}
+
 SpiAnalyzerSettings::SpiAnalyzerSettings()
 	: mMosiChannel(UNDEFINED_CHANNEL),
 	mMisoChannel(UNDEFINED_CHANNEL),
@@ -85,12 +111,14 @@ SpiAnalyzerSettings::SpiAnalyzerSettings()
 	mMsgDataPriority(DisplayPriority::Tag),
 	mProcessDataPriority(DisplayPriority::Tag),
 	mTimestampIndexing(TimestampIndexing::Disabled),
+	mIndexGranularity(IndexGranularity::Frames),
 	mMessageSrcIdIndexing(true),
 	mErrorIndexing(true),
 	mAnybusStatusIndexing(true),
 	mApplStatusIndexing(true),
 	mAdvSettingsPath(""),
-	mChangeID(0)
+	mDecodeChangeID(0),
+	mPresentationChangeID(0)
 {
 	SetDefaultAdvancedSettings();
 
@@ -179,6 +207,18 @@ SpiAnalyzerSettings::SpiAnalyzerSettings()
 		"New Read Process Data", "The timestamp from ABCC SPI packets containing \"new\" read process data will be added to tabular results.");
 	mIndexTimestampsInterface->SetNumber(static_cast<double>(mTimestampIndexing));
 
+	mIndexGranularityInterface.reset(new AnalyzerSettingInterfaceNumberList());
+	mIndexGranularityInterface->SetTitleAndTooltip("Index - Granularity :",
+		"Specifies if the tabular results are added per frame or per packet.");
+	mIndexGranularityInterface->AddNumber(static_cast<double>(IndexGranularity::Frames),
+		"Frames", "Entries are added for the individual frames of the packets.\n"
+		"Recommended setting for general use.");
+	mIndexGranularityInterface->AddNumber(static_cast<double>(IndexGranularity::Packets),
+		"Packets", "A single entry summarizing the status, message header, and events of a packet is added per packet.\n"
+		"The other indexing options select what the summary holds and which packets are added.\n"
+		"Useful for long captures, the tabular results are far smaller.");
+	mIndexGranularityInterface->SetNumber(static_cast<double>(mIndexGranularity));
+
 	mIndexMessageSrcIdInterface.reset(new AnalyzerSettingInterfaceBool());
 	mIndexMessageSrcIdInterface->SetTitleAndTooltip("Index - Message 'Source ID' :",
 		"Enable indexed searching of the source ID associated with an ABCC transaction.");
@@ -231,6 +271,7 @@ SpiAnalyzerSettings::SpiAnalyzerSettings()
 	AddInterface(mEnableChannelInterface.get());
 
 	AddInterface(mNetworkTypeInterface.get());
+	AddInterface(mIndexGranularityInterface.get());
 	AddInterface(mIndexErrorsInterface.get());
 	AddInterface(mIndexTimestampsInterface.get());
 	AddInterface(mIndexAnybusStatusInterface.get());
@@ -247,6 +288,10 @@ SpiAnalyzerSettings::SpiAnalyzerSettings()
 	AddExportExtension(static_cast<U32>(ExportType::ProcessData), "Process Data", "csv");
 	AddExportOption(static_cast<U32>(ExportType::MessageData), "Export Message Data");
 	AddExportExtension(static_cast<U32>(ExportType::MessageData), "Message Data", "csv");
+	AddExportOption(static_cast<U32>(ExportType::Latency), "Export Command Latency");
+	AddExportExtension(static_cast<U32>(ExportType::Latency), "Command Latency", "csv");
+	AddExportOption(static_cast<U32>(ExportType::Jitter), "Export Network Time Jitter");
+	AddExportExtension(static_cast<U32>(ExportType::Jitter), "Network Time Jitter", "csv");
 
 	ClearChannels();
 	AddChannel(mMosiChannel, MOSI_CHANNEL_NAME, false);
@@ -266,6 +311,17 @@ void SpiAnalyzerSettings::SetDefaultAdvancedSettings()
 	mExportDelimiter.assign(",");
 	mClockingAlertLimit = -1;
 	mExpandBitFrames = true;
+	mMarkerDensity = MarkerDensity::Packets;
+	mWordMode = false;
+	mProgressInterval = DEFAULT_PROGRESS_INTERVAL;
+	m3WirePacketGapNs = DEFAULT_3WIRE_PACKET_GAP_NS;
+	m3WireMaxClockIdleNs = DEFAULT_3WIRE_MAX_CLOCK_IDLE_NS;
+	mAggregateProcessData = false;
+	mAggregateMessageData = false;
+	mProcessDataChangesOnly = false;
+	mProcessDataKeyframeInterval = DEFAULT_PD_KEYFRAME_INTERVAL;
+	mJitterNominalCycleNs = DEFAULT_JITTER_NOMINAL_CYCLE_NS;
+	mJitterThresholdNs = DEFAULT_JITTER_THRESHOLD_NS;
 	mSimulateLogFilePath = "";
 	mSimulateLogFileDefaultState = ABP_ANB_STATE_SETUP;
 	mSimulateClockIdleHigh = -1;
@@ -510,6 +566,63 @@ bool SpiAnalyzerSettings::ParseAdvancedSettingsFile()
 						{
 							mExpandBitFrames = (nodeValue.compare("1") == 0);
 						}
+						else if (nodeName.compare("marker-density") == 0)
+						{
+							long parsedValue = strtol(nodeValue.c_str(), nullptr, 0);
+
+							if ((parsedValue >= 0) &&
+								(parsedValue < static_cast<long>(MarkerDensity::SizeOfEnum)))
+							{
+								mMarkerDensity = static_cast<MarkerDensity>(parsedValue);
+							}
+						}
+						else if (nodeName.compare("spi-data-size") == 0)
+						{
+							const int wordMode = 16;
+							long parsedValue = strtol(nodeValue.c_str(), nullptr, 0);
+
+							mWordMode = (parsedValue == wordMode);
+						}
+						else if (nodeName.compare("progress-interval") == 0)
+						{
+							// Values <= 0 are valid, they report on every transfer
+							mProgressInterval = ParseS32Setting(nodeValue, ABP_SINT32_MIN, ABP_SINT32_MAX, DEFAULT_PROGRESS_INTERVAL);
+						}
+						else if (nodeName.compare("3-wire-packet-gap-ns") == 0)
+						{
+							m3WirePacketGapNs = ParseS32Setting(nodeValue, 1, ABP_SINT32_MAX, DEFAULT_3WIRE_PACKET_GAP_NS);
+						}
+						else if (nodeName.compare("3-wire-max-clock-idle-ns") == 0)
+						{
+							m3WireMaxClockIdleNs = ParseS32Setting(nodeValue, 1, ABP_SINT32_MAX, DEFAULT_3WIRE_MAX_CLOCK_IDLE_NS);
+						}
+						else if (nodeName.compare("aggregate-process-data") == 0)
+						{
+							mAggregateProcessData = (nodeValue.compare("1") == 0);
+						}
+						else if (nodeName.compare("aggregate-message-data") == 0)
+						{
+							mAggregateMessageData = (nodeValue.compare("1") == 0);
+						}
+						else if (nodeName.compare("process-data-changes-only") == 0)
+						{
+							mProcessDataChangesOnly = (nodeValue.compare("1") == 0);
+						}
+						else if (nodeName.compare("process-data-keyframe-interval") == 0)
+						{
+							// 0 presents only the first image in full
+							mProcessDataKeyframeInterval = ParseS32Setting(nodeValue, 0, ABP_SINT32_MAX, DEFAULT_PD_KEYFRAME_INTERVAL);
+						}
+						else if (nodeName.compare("jitter-nominal-cycle-ns") == 0)
+						{
+							// 0 estimates the cycle from the first intervals
+							mJitterNominalCycleNs = ParseS32Setting(nodeValue, 0, ABP_SINT32_MAX, DEFAULT_JITTER_NOMINAL_CYCLE_NS);
+						}
+						else if (nodeName.compare("jitter-threshold-ns") == 0)
+						{
+							// 0 uses a tenth of the nominal cycle
+							mJitterThresholdNs = ParseS32Setting(nodeValue, 0, ABP_SINT32_MAX, DEFAULT_JITTER_THRESHOLD_NS);
+						}
 						else if (nodeName.compare("simulation") == 0)
 						{
 							// Attempt to get applicable settings for simulation from child nodes.
@@ -590,6 +703,7 @@ bool SpiAnalyzerSettings::SetSettingsFromInterfaces()
 	mMessageSrcIdIndexing          = mIndexMessageSrcIdInterface->GetValue();
 	mErrorIndexing                 = mIndexErrorsInterface->GetValue();
 	mTimestampIndexing             = static_cast<TimestampIndexing>(U32(mIndexTimestampsInterface->GetNumber()));
+	mIndexGranularity              = static_cast<IndexGranularity>(U32(mIndexGranularityInterface->GetNumber()));
 	mAnybusStatusIndexing          = mIndexAnybusStatusInterface->GetValue();
 	mApplStatusIndexing            = mIndexApplStatusInterface->GetValue();
 	mAdvSettingsPath               = mAdvancedSettingsInterface->GetText();
@@ -636,11 +750,23 @@ void SpiAnalyzerSettings::LoadSettings(const char* settings)
 		textArchive >> mTimestampIndexing;
 		textArchive >> mAnybusStatusIndexing;
 		textArchive >> mApplStatusIndexing;
+		textArchive >> mIndexGranularity;
 		textArchive >> m3WireOn4Channels;
 		textArchive >> m4WireOn3Channels;
 		textArchive >> mExportDelimiter;
 		textArchive >> mClockingAlertLimit;
 		textArchive >> mExpandBitFrames;
+		textArchive >> mMarkerDensity;
+		textArchive >> mWordMode;
+		textArchive >> mProgressInterval;
+		textArchive >> m3WirePacketGapNs;
+		textArchive >> m3WireMaxClockIdleNs;
+		textArchive >> mAggregateProcessData;
+		textArchive >> mAggregateMessageData;
+		textArchive >> mProcessDataChangesOnly;
+		textArchive >> mProcessDataKeyframeInterval;
+		textArchive >> mJitterNominalCycleNs;
+		textArchive >> mJitterThresholdNs;
 		textArchive >> &mAdvSettingsPath;
 	}
 
@@ -673,14 +799,26 @@ const char* SpiAnalyzerSettings::SaveSettings()
 	textArchive << mTimestampIndexing;
 	textArchive << mAnybusStatusIndexing;
 	textArchive << mApplStatusIndexing;
+	textArchive << mIndexGranularity;
 	textArchive << m3WireOn4Channels;
 	textArchive << m4WireOn3Channels;
 	textArchive << mExportDelimiter.c_str();
 	textArchive << mClockingAlertLimit;
 	textArchive << mExpandBitFrames;
+	textArchive << mMarkerDensity;
+	textArchive << mWordMode;
+	textArchive << mProgressInterval;
+	textArchive << m3WirePacketGapNs;
+	textArchive << m3WireMaxClockIdleNs;
+	textArchive << mAggregateProcessData;
+	textArchive << mAggregateMessageData;
+	textArchive << mProcessDataChangesOnly;
+	textArchive << mProcessDataKeyframeInterval;
+	textArchive << mJitterNominalCycleNs;
+	textArchive << mJitterThresholdNs;
 	textArchive << mAdvSettingsPath;
 
-	SaveSettingChangeID();
+	SaveSettingChangeIDs();
 
 	return SetReturnString(textArchive.GetString());
 }
@@ -699,13 +837,90 @@ void SpiAnalyzerSettings::UpdateInterfacesFromSettings()
 	mIndexMessageSrcIdInterface->SetValue(mMessageSrcIdIndexing);
 	mIndexErrorsInterface->SetValue(mErrorIndexing);
 	mIndexTimestampsInterface->SetNumber(static_cast<double>(mTimestampIndexing));
+	mIndexGranularityInterface->SetNumber(static_cast<double>(mIndexGranularity));
 	mIndexAnybusStatusInterface->SetValue(mAnybusStatusIndexing);
 	mIndexApplStatusInterface->SetValue(mApplStatusIndexing);
 	mAdvancedSettingsInterface->SetText(mAdvSettingsPath);
 }
 
-U8 SpiAnalyzerSettings::SaveSettingChangeID()
+/*
+** Only the settings the analyzer worker consumes are part of the decode
+** snapshot; changing any of these requires the capture to be decoded again.
+** The simulation settings are included since they change the generated data.
+*/
+std::string SpiAnalyzerSettings::GetDecodeSettingsSnapshot()
+{
+	SimpleArchive textArchive;
+
+	textArchive << mMosiChannel;
+	textArchive << mMisoChannel;
+	textArchive << mClockChannel;
+	textArchive << mEnableChannel;
+	textArchive << m3WireOn4Channels;
+	textArchive << m4WireOn3Channels;
+	textArchive << mClockingAlertLimit;
+	textArchive << mExpandBitFrames;
+	textArchive << mMarkerDensity;
+	textArchive << mWordMode;
+	textArchive << m3WirePacketGapNs;
+	textArchive << m3WireMaxClockIdleNs;
+	textArchive << mAggregateProcessData;
+	textArchive << mAggregateMessageData;
+	textArchive << mProcessDataChangesOnly;
+	textArchive << mProcessDataKeyframeInterval;
+	textArchive << mSimulateLogFilePath.c_str();
+	textArchive << mSimulateLogFileDefaultState;
+	textArchive << mSimulateClockIdleHigh;
+	textArchive << mSimulateClockFrequency;
+	textArchive << mSimulatePacketGapNs;
+	textArchive << mSimulateByteGapNs;
+	textArchive << mSimulateChipSelectNs;
+	textArchive << mSimulateMsgDataLength;
+	textArchive << mSimulateWordMode;
+
+	return std::string(textArchive.GetString());
+}
+
+/*
+** Settings only read by the results when generating text. The progress
+** interval is in neither snapshot, it does not change the results at all.
+*/
+std::string SpiAnalyzerSettings::GetPresentationSettingsSnapshot()
 {
-	mChangeID++;
-	return mChangeID;
+	SimpleArchive textArchive;
+
+	textArchive << mNetworkType;
+	textArchive << mMessageIndexingVerbosityLevel;
+	textArchive << mMsgDataPriority;
+	textArchive << mProcessDataPriority;
+	textArchive << mMessageSrcIdIndexing;
+	textArchive << mErrorIndexing;
+	textArchive << mTimestampIndexing;
+	textArchive << mAnybusStatusIndexing;
+	textArchive << mApplStatusIndexing;
+	textArchive << mIndexGranularity;
+	textArchive << mExportDelimiter.c_str();
+	textArchive << mJitterNominalCycleNs;
+	textArchive << mJitterThresholdNs;
+
+	return std::string(textArchive.GetString());
+}
+
+void SpiAnalyzerSettings::SaveSettingChangeIDs()
+{
+	std::string snapshot = GetDecodeSettingsSnapshot();
+
+	if (snapshot != mDecodeSettingsSnapshot)
+	{
+		mDecodeSettingsSnapshot = snapshot;
+		mDecodeChangeID++;
+	}
+
+	snapshot = GetPresentationSettingsSnapshot();
+
+	if (snapshot != mPresentationSettingsSnapshot)
+	{
+		mPresentationSettingsSnapshot = snapshot;
+		mPresentationChangeID++;
+	}
 }
@@ -36,11 +36,31 @@ enum class TimestampIndexing : U32
 	SizeOfEnum
 };
 
+/* The unit each entry of the tabular results describes */
+enum class IndexGranularity : U32
+{
+	Frames,		/* Entries per frame, as selected by the other indexing settings */
+	Packets,	/* A single summary entry per packet */
+	SizeOfEnum
+};
+
+/* Each level includes the markers of the levels below it */
+enum class MarkerDensity : U32
+{
+	None,		/* No markers are placed */
+	Errors,		/* Only error markers */
+	Packets,	/* Packet boundary and error markers */
+	Bits,		/* Per-bit sample markers in addition to the above */
+	SizeOfEnum
+};
+
 enum class ExportType : U32
 {
 	Frames,
 	ProcessData,
 	MessageData,
+	Latency,
+	Jitter,
 	SizeOfEnum
 };
 
@@ -101,13 +121,18 @@ public: /* Members */
 	Channel mEnableChannel;
 
 	U32 mNetworkType;
-	U8 mChangeID;
+
+	/* Incremented when a saved setting changes the decoded frames, or only
+	** the way the frames are presented (bubble, tabular and export text) */
+	U8 mDecodeChangeID;
+	U8 mPresentationChangeID;
 
 	DisplayPriority mMsgDataPriority;
 	DisplayPriority mProcessDataPriority;
 
 	MessageIndexing mMessageIndexingVerbosityLevel;
 	TimestampIndexing mTimestampIndexing;
+	IndexGranularity mIndexGranularity;
 
 	bool mMessageSrcIdIndexing;
 	bool mErrorIndexing;
@@ -120,6 +145,17 @@ public: /* Members */
 	std::string mExportDelimiter;
 	S32 mClockingAlertLimit;
 	bool mExpandBitFrames;
+	MarkerDensity mMarkerDensity;
+	bool mWordMode;
+	S32 mProgressInterval;
+	S32 m3WirePacketGapNs;
+	S32 m3WireMaxClockIdleNs;
+	bool mAggregateProcessData;
+	bool mAggregateMessageData;
+	bool mProcessDataChangesOnly;
+	S32 mProcessDataKeyframeInterval;
+	S32 mJitterNominalCycleNs;
+	S32 mJitterThresholdNs;
 
 	std::string mSimulateLogFilePath;
 	U32 mSimulateLogFileDefaultState;
@@ -142,11 +178,15 @@ protected: /* Members */
 	std::unique_ptr< AnalyzerSettingInterfaceNumberList >	mMsgDataPriorityInterface;
 	std::unique_ptr< AnalyzerSettingInterfaceNumberList >	mProcessDataPriorityInterface;
 	std::unique_ptr< AnalyzerSettingInterfaceNumberList >	mIndexTimestampsInterface;
+	std::unique_ptr< AnalyzerSettingInterfaceNumberList >	mIndexGranularityInterface;
 	std::unique_ptr< AnalyzerSettingInterfaceBool >			mIndexMessageSrcIdInterface;
 	std::unique_ptr< AnalyzerSettingInterfaceBool >			mIndexErrorsInterface;
 	std::unique_ptr< AnalyzerSettingInterfaceBool >			mIndexAnybusStatusInterface;
 	std::unique_ptr< AnalyzerSettingInterfaceBool >			mIndexApplStatusInterface;
 
+	std::string mDecodeSettingsSnapshot;
+	std::string mPresentationSettingsSnapshot;
+
 protected: /* Methods */
 
 	std::unique_ptr< AnalyzerSettingInterfaceText >			mAdvancedSettingsInterface;
@@ -155,7 +195,9 @@ protected: /* Methods */
 	void SetDefaultAdvancedSettings();
 
 	void SetSettingError( const std::string& setting_name, const std::string& error_text );
-	U8 SaveSettingChangeID();
+	void SaveSettingChangeIDs();
+	std::string GetDecodeSettingsSnapshot();
+	std::string GetPresentationSettingsSnapshot();
 };
 
 #endif /* ABCC_SPI_ANALYZER_SETTINGS_H */
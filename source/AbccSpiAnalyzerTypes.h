@@ -10,7 +10,7 @@
 
 #ifndef ABCC_SPI_ANALYZER_TYPES_H
 #define ABCC_SPI_ANALYZER_TYPES_H
-#include "Analyzer.h"
+#include "LogicPublicTypes.h"
 
 /* Indicates a SPI settings error (e.g. CPOL, CPHA, EN Active Hi/Lo) */
 #define SPI_ERROR_FLAG						( 1 << 0 )
@@ -24,6 +24,20 @@
 /* Indicates that message fragmentation is in progress */
 #define SPI_MSG_FRAG_FLAG					( 1 << 3 )
 
+/* Indicates a frame aggregating a block of data (the process data, or a run of
+** message data) rather than a single field. mData1 refers to the bytes kept in
+** the frame data arena, see GET_AGGREGATED_FRAME_OFFSET/LENGTH(). */
+#define SPI_AGGREGATED_FRAME_FLAG			( 1 << 4 )
+
+/* mData1 of an aggregated frame holds the offset of its bytes in the lower 48
+** bits and the number of bytes in the upper 16 bits, leaving mData2 to describe
+** the bytes (e.g. the message header of message data) */
+#define AGGREGATED_FRAME_LENGTH_SHIFT		48
+#define AGGREGATED_FRAME_MAX_LENGTH			0xFFFF
+#define AGGREGATED_FRAME_DATA1(offset, length)	( ((U64)(length) << AGGREGATED_FRAME_LENGTH_SHIFT) | (U64)(offset) )
+#define GET_AGGREGATED_FRAME_OFFSET(data1)	( (U64)(data1) & ((1ULL << AGGREGATED_FRAME_LENGTH_SHIFT) - 1) )
+#define GET_AGGREGATED_FRAME_LENGTH(data1)	( (U32)((U64)(data1) >> AGGREGATED_FRAME_LENGTH_SHIFT) )
+
 /* Event flag to indicate any critical events that are part of the ABCC SPI protocol
 ** This flag is field-specific.
 ** This flag is relevant for the following fields:
@@ -48,6 +62,9 @@
 #define GET_MOSI_FRAME_BITSIZE(x)			((asMosiStates[x].frameSize)*8)
 #define GET_MISO_FRAME_BITSIZE(x)			((asMisoStates[x].frameSize)*8)
 
+/* The SPI data channels, MOSI and MISO, see SpiChannel_t */
+#define NUM_DATA_CHANNELS					2
+
 enum class DisplayPriority : U32
 {
 	Value,
@@ -55,6 +72,12 @@ enum class DisplayPriority : U32
 	SizeOfEnum
 };
 
+enum class BaseType : U8
+{
+	Character,
+	Numeric
+};
+
 typedef enum NotifEvent {
 	None,
 	Alert
@@ -0,0 +1,86 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccTextCache.cpp
+**    Summary: Least recently used cache of the text generated for frames.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include "AbccTextCache.h"
+
+AbccTextCache::AbccTextCache()
+	: mGeneration(0)
+{
+}
+
+U64 AbccTextCache::GetKey(U64 frame_index, TextKind kind, SpiChannel_t channel, DisplayBase display_base)
+{
+	// The frame index occupies the upper 56 bits, far more than a capture holds
+	return (frame_index << 8) |
+		((U64)kind << 6) |
+		((U64)channel << 4) |
+		((U64)display_base & 0x0F);
+}
+
+U32 AbccTextCache::GetGeneration()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mGeneration;
+}
+
+bool AbccTextCache::Find(U64 key, std::vector<std::string>* strings)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	auto it = mIndex.find(key);
+
+	if (it == mIndex.end())
+	{
+		return false;
+	}
+
+	mEntries.splice(mEntries.begin(), mEntries, it->second);
+	*strings = it->second->asStrings;
+
+	return true;
+}
+
+void AbccTextCache::Insert(U64 key, U32 generation, std::vector<std::string>* strings)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (generation != mGeneration)
+	{
+		return;
+	}
+
+	auto it = mIndex.find(key);
+
+	if (it != mIndex.end())
+	{
+		mEntries.splice(mEntries.begin(), mEntries, it->second);
+		it->second->asStrings.swap(*strings);
+		return;
+	}
+
+	if (mEntries.size() >= TEXT_CACHE_MAX_ENTRIES)
+	{
+		mIndex.erase(mEntries.back().lKey);
+		mEntries.pop_back();
+	}
+
+	mEntries.push_front(TextCacheEntry_t());
+	mEntries.front().lKey = key;
+	mEntries.front().asStrings.swap(*strings);
+	mIndex[key] = mEntries.begin();
+}
+
+void AbccTextCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mEntries.clear();
+	mIndex.clear();
+	mGeneration++;
+}
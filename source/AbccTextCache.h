@@ -0,0 +1,104 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccTextCache.h
+**    Summary: Least recently used cache of the text generated for frames.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_TEXT_CACHE_H
+#define ABCC_TEXT_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AbccSpiAnalyzerTypes.h"
+
+/* Number of frame texts kept, bubble and tabular texts alike */
+#define TEXT_CACHE_MAX_ENTRIES				32768
+
+enum class TextKind : U8
+{
+	Bubble,
+	Tabular,
+	SizeOfEnum
+};
+
+/*
+** @brief Holds the result strings of the most recently generated frame texts,
+**        so that repainting the same frames does not format them again.
+**
+** An entry is identified by the frame, the kind of text, the channel it was
+** generated for, and the display base. The text also depends on the
+** presentation settings, so the cache is cleared when they change. The least
+** recently used entry is discarded when the cache is full.
+**
+** Each clear starts a new generation. A text generated while the cache was
+** cleared is stale, so it is inserted with the generation read before
+** generating it, and dropped if that generation has ended.
+*/
+class AbccTextCache
+{
+public:
+
+	AbccTextCache();
+
+	/*******************************************************************************
+	** @brief The key of the text of a frame.
+	*/
+	static U64 GetKey(U64 frame_index, TextKind kind, SpiChannel_t channel, DisplayBase display_base);
+
+	/*******************************************************************************
+	** @brief The current generation, to be read before generating a text.
+	*/
+	U32 GetGeneration();
+
+	/*******************************************************************************
+	** @brief Look up the strings of a text, marking them as recently used.
+	**
+	** @param key - The key of the text.
+	** @param strings - Receives a copy of the strings.
+	**
+	** @return false if the text is not cached.
+	*/
+	bool Find(U64 key, std::vector<std::string>* strings);
+
+	/*******************************************************************************
+	** @brief Add the strings of a text, discarding the least recently used text
+	**        if the cache is full. The text is dropped if the cache was cleared
+	**        since its generation was read.
+	**
+	** @param key - The key of the text.
+	** @param generation - The generation read before generating the text.
+	** @param strings - The strings, moved into the cache.
+	*/
+	void Insert(U64 key, U32 generation, std::vector<std::string>* strings);
+
+	/*******************************************************************************
+	** @brief Discard all texts, and start a new generation.
+	*/
+	void Clear();
+
+protected: // Types
+
+	typedef struct TextCacheEntry
+	{
+		U64 lKey;
+		std::vector<std::string> asStrings;
+	} TextCacheEntry_t;
+
+protected: // Members
+
+	std::mutex mMutex;
+	U32 mGeneration;							// Incremented by each clear
+	std::list<TextCacheEntry_t> mEntries;		// Most recently used first
+	std::unordered_map<U64, std::list<TextCacheEntry_t>::iterator> mIndex;
+};
+
+#endif /* ABCC_TEXT_CACHE_H */
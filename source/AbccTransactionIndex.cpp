@@ -0,0 +1,281 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccTransactionIndex.cpp
+**    Summary: Pairs each response message with the command it answers.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <algorithm>
+
+#include "AbccTransactionIndex.h"
+
+#include "abcc_td.h"
+#include "abcc_abp/abp.h"
+
+static bool IsSameRequest(const MsgHeaderInfo_t& command, const MsgHeaderInfo_t& response)
+{
+	return ((command.obj == response.obj) &&
+		(command.inst == response.inst) &&
+		((command.cmd & ABP_MSG_HEADER_CMD_BITS) == (response.cmd & ABP_MSG_HEADER_CMD_BITS)));
+}
+
+AbccTransactionIndex::AbccTransactionIndex()
+	: mFirstTransactionIndex(0),
+	mFirstMessageIndex(0)
+{
+	ResetSourceIds();
+}
+
+void AbccTransactionIndex::ResetSourceIds()
+{
+	for (U32 i = 0; i < NUM_DATA_CHANNELS; i++)
+	{
+		for (U32 j = 0; j < 256; j++)
+		{
+			malOutstanding[i][j] = INVALID_TRANSACTION_INDEX;
+			malAnswered[i][j] = INVALID_TRANSACTION_INDEX;
+		}
+	}
+}
+
+void AbccTransactionIndex::Update(const AbccMessageTable& messages)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	U64 messageCount = messages.GetMessageCount();
+	AbccMessage_t message;
+
+	for (U64 i = mFirstMessageIndex + malMessageTransactions.size(); i < messageCount; i++)
+	{
+		if (!messages.GetMessage(i, &message))
+		{
+			break;
+		}
+
+		malMessageTransactions.push_back(INVALID_TRANSACTION_INDEX);
+
+		if ((message.sHeader.cmd & ABP_MSG_HEADER_C_BIT) != 0)
+		{
+			AddCommand(i, message);
+		}
+		else
+		{
+			AddResponse(i, message);
+		}
+	}
+}
+
+U64 AbccTransactionIndex::AddTransaction(const AbccTransaction_t& transaction)
+{
+	mTransactions.push_back(transaction);
+
+	return mFirstTransactionIndex + mTransactions.size() - 1;
+}
+
+AbccTransaction_t* AbccTransactionIndex::FindTransaction(U64 transaction_index)
+{
+	if (transaction_index >= mFirstTransactionIndex)
+	{
+		if ((transaction_index - mFirstTransactionIndex) >= mTransactions.size())
+		{
+			return nullptr;
+		}
+
+		return &mTransactions[(size_t)(transaction_index - mFirstTransactionIndex)];
+	}
+
+	auto it = mRetained.find(transaction_index);
+
+	return (it != mRetained.end()) ? &it->second : nullptr;
+}
+
+const AbccTransaction_t* AbccTransactionIndex::FindTransaction(U64 transaction_index) const
+{
+	return const_cast<AbccTransactionIndex*>(this)->FindTransaction(transaction_index);
+}
+
+bool AbccTransactionIndex::IsReferenced(U64 transaction_index, const AbccTransaction_t& transaction) const
+{
+	U32 channel = ((transaction.bFlags & ABCC_TRANSACTION_MOSI_COMMAND_FLAG) != 0) ? SpiChannel::MOSI : SpiChannel::MISO;
+
+	return ((malOutstanding[channel][transaction.bSourceId] == transaction_index) ||
+		(malAnswered[channel][transaction.bSourceId] == transaction_index));
+}
+
+void AbccTransactionIndex::AddCommand(U64 message_index, const AbccMessage_t& message)
+{
+	U32 channel = ((message.bFlags & ABCC_MESSAGE_MOSI_FLAG) != 0) ? SpiChannel::MOSI : SpiChannel::MISO;
+	U64* outstanding = &malOutstanding[channel][message.bSourceId];
+	AbccTransaction_t transaction;
+
+	transaction.bFlags = (channel == SpiChannel::MOSI) ? ABCC_TRANSACTION_MOSI_COMMAND_FLAG : 0;
+
+	if (*outstanding != INVALID_TRANSACTION_INDEX)
+	{
+		// The source ID is reused, the response to the previous command is lost
+		FindTransaction(*outstanding)->bFlags |= ABCC_TRANSACTION_SUPERSEDED_FLAG;
+		transaction.bFlags |= ABCC_TRANSACTION_REUSED_SOURCE_ID_FLAG;
+	}
+
+	transaction.lCommandMessage = message_index;
+	transaction.lResponseMessage = INVALID_MESSAGE_INDEX;
+	transaction.lCommandStartSample = message.lFirstSample;
+	transaction.lResponseEndSample = 0;
+	transaction.lCommandPacketId = message.lFirstPacketId;
+	transaction.lResponsePacketId = 0;
+	transaction.sHeader = message.sHeader;
+	transaction.bSourceId = message.bSourceId;
+
+	*outstanding = AddTransaction(transaction);
+	malAnswered[channel][message.bSourceId] = INVALID_TRANSACTION_INDEX;
+	malMessageTransactions[(size_t)(message_index - mFirstMessageIndex)] = *outstanding;
+}
+
+void AbccTransactionIndex::AddResponse(U64 message_index, const AbccMessage_t& message)
+{
+	// The command was sent on the opposite channel
+	U32 channel = ((message.bFlags & ABCC_MESSAGE_MOSI_FLAG) != 0) ? SpiChannel::MISO : SpiChannel::MOSI;
+	U64* outstanding = &malOutstanding[channel][message.bSourceId];
+	U64 transactionIndex = *outstanding;
+	U8 flags = ((message.sHeader.cmd & ABP_MSG_HEADER_E_BIT) != 0) ? ABCC_TRANSACTION_ERROR_RESPONSE_FLAG : 0;
+
+	if (transactionIndex == INVALID_TRANSACTION_INDEX)
+	{
+		U64 answered = malAnswered[channel][message.bSourceId];
+		AbccTransaction_t transaction;
+
+		if ((answered != INVALID_TRANSACTION_INDEX) &&
+			IsSameRequest(FindTransaction(answered)->sHeader, message.sHeader))
+		{
+			// A second response to the command
+			transaction = *FindTransaction(answered);
+			transaction.bFlags &= ABCC_TRANSACTION_MOSI_COMMAND_FLAG;
+			transaction.bFlags |= ABCC_TRANSACTION_DUPLICATED_FLAG;
+		}
+		else
+		{
+			transaction.lCommandMessage = INVALID_MESSAGE_INDEX;
+			transaction.lCommandStartSample = 0;
+			transaction.lCommandPacketId = 0;
+			transaction.sHeader = message.sHeader;
+			transaction.bSourceId = message.bSourceId;
+			transaction.bFlags = ABCC_TRANSACTION_ORPHANED_FLAG;
+
+			if (channel == SpiChannel::MOSI)
+			{
+				transaction.bFlags |= ABCC_TRANSACTION_MOSI_COMMAND_FLAG;
+			}
+		}
+
+		transactionIndex = AddTransaction(transaction);
+	}
+	else
+	{
+		if (!IsSameRequest(FindTransaction(transactionIndex)->sHeader, message.sHeader))
+		{
+			flags |= ABCC_TRANSACTION_MISMATCH_FLAG;
+		}
+
+		malAnswered[channel][message.bSourceId] = transactionIndex;
+		*outstanding = INVALID_TRANSACTION_INDEX;
+	}
+
+	AbccTransaction_t* transaction = FindTransaction(transactionIndex);
+
+	transaction->lResponseMessage = message_index;
+	transaction->lResponseEndSample = message.lLastSample;
+	transaction->lResponsePacketId = message.lLastPacketId;
+	transaction->bFlags |= flags;
+	malMessageTransactions[(size_t)(message_index - mFirstMessageIndex)] = transactionIndex;
+}
+
+void AbccTransactionIndex::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mTransactions.clear();
+	mFirstTransactionIndex = 0;
+	malMessageTransactions.clear();
+	mFirstMessageIndex = 0;
+	mRetained.clear();
+	ResetSourceIds();
+}
+
+void AbccTransactionIndex::Discard(U64 transaction_index, U64 message_index)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// The source IDs no longer refer to a retained transaction once it was
+	// superseded, or answered and the source ID reused
+	for (auto it = mRetained.begin(); it != mRetained.end();)
+	{
+		if (IsReferenced(it->first, it->second))
+		{
+			++it;
+		}
+		else
+		{
+			it = mRetained.erase(it);
+		}
+	}
+
+	if (transaction_index > mFirstTransactionIndex)
+	{
+		size_t count = (size_t)std::min<U64>(transaction_index - mFirstTransactionIndex, mTransactions.size());
+
+		for (size_t i = 0; i < count; i++)
+		{
+			if (IsReferenced(mFirstTransactionIndex + i, mTransactions[i]))
+			{
+				mRetained[mFirstTransactionIndex + i] = mTransactions[i];
+			}
+		}
+
+		mTransactions.erase(mTransactions.begin(), mTransactions.begin() + count);
+		mFirstTransactionIndex += count;
+	}
+
+	if (message_index > mFirstMessageIndex)
+	{
+		size_t count = (size_t)std::min<U64>(message_index - mFirstMessageIndex, malMessageTransactions.size());
+
+		malMessageTransactions.erase(malMessageTransactions.begin(), malMessageTransactions.begin() + count);
+		mFirstMessageIndex += count;
+	}
+}
+
+U64 AbccTransactionIndex::GetTransactionCount() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	return mFirstTransactionIndex + mTransactions.size();
+}
+
+bool AbccTransactionIndex::GetTransaction(U64 transaction_index, AbccTransaction_t* transaction) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	const AbccTransaction_t* stored = FindTransaction(transaction_index);
+
+	if (stored == nullptr)
+	{
+		return false;
+	}
+
+	*transaction = *stored;
+
+	return true;
+}
+
+U64 AbccTransactionIndex::GetMessageTransaction(U64 message_index) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if ((message_index < mFirstMessageIndex) || ((message_index - mFirstMessageIndex) >= malMessageTransactions.size()))
+	{
+		return INVALID_TRANSACTION_INDEX;
+	}
+
+	return malMessageTransactions[(size_t)(message_index - mFirstMessageIndex)];
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccTransactionIndex.h
+**    Summary: Pairs each response message with the command it answers.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_TRANSACTION_INDEX_H
+#define ABCC_TRANSACTION_INDEX_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+#include "AbccMessageTable.h"
+
+/* The command was sent on MOSI, i.e. by the host */
+#define ABCC_TRANSACTION_MOSI_COMMAND_FLAG		( 1 << 0 )
+
+/* The response is an error response */
+#define ABCC_TRANSACTION_ERROR_RESPONSE_FLAG	( 1 << 1 )
+
+/* A response without an outstanding command from the same source ID */
+#define ABCC_TRANSACTION_ORPHANED_FLAG			( 1 << 2 )
+
+/* A response to a command that was already answered */
+#define ABCC_TRANSACTION_DUPLICATED_FLAG		( 1 << 3 )
+
+/* The object, instance, or command of the response differ from the command */
+#define ABCC_TRANSACTION_MISMATCH_FLAG			( 1 << 4 )
+
+/* The source ID was reused by a new command before a response was seen */
+#define ABCC_TRANSACTION_SUPERSEDED_FLAG		( 1 << 5 )
+
+/* The command reused the source ID of a command that was still outstanding,
+** set on the command that superseded it */
+#define ABCC_TRANSACTION_REUSED_SOURCE_ID_FLAG	( 1 << 6 )
+
+/* The index returned when no transaction matches */
+#define INVALID_TRANSACTION_INDEX				0xFFFFFFFFFFFFFFFFull
+
+/* A command and its response. Either message index is INVALID_MESSAGE_INDEX
+** if the message was not seen; a command without a response is still
+** outstanding, or was superseded. */
+typedef struct AbccTransaction
+{
+	U64 lCommandMessage;
+	U64 lResponseMessage;
+	S64 lCommandStartSample;
+	S64 lResponseEndSample;
+	U64 lCommandPacketId;
+	U64 lResponsePacketId;
+	MsgHeaderInfo_t sHeader;	// Of the command, or of an orphaned response
+	U8 bSourceId;
+	U8 bFlags;
+} AbccTransaction_t;
+
+/*
+** @brief Correlates the messages of an AbccMessageTable as they complete.
+**
+** A command and its response are sent on opposite channels and carry the
+** same source ID, which the sender does not reuse while the command is
+** outstanding. The outstanding commands are therefore directly indexed by
+** the channel and source ID of the command. A response is paired with the
+** command outstanding for its source ID, and flagged if its header does not
+** match the command.
+*/
+class AbccTransactionIndex
+{
+public:
+
+	AbccTransactionIndex();
+
+	/*******************************************************************************
+	** @brief Correlate the messages added to the table since the last call.
+	**
+	** @param messages - The message table, called after each packet ended.
+	*/
+	void Update(const AbccMessageTable& messages);
+
+	/*******************************************************************************
+	** @brief Discard all transactions.
+	*/
+	void Clear();
+
+	/*******************************************************************************
+	** @brief Discard the transactions before an index, and the transaction
+	**        index of the messages before an index, when they are only needed
+	**        until exported. The remaining transactions keep their index. The
+	**        transaction outstanding or last answered for each source ID is
+	**        kept, so that later responses are still paired with it.
+	**
+	** @param transaction_index - Index of the first transaction to keep.
+	** @param message_index - Index of the first message to keep.
+	*/
+	void Discard(U64 transaction_index, U64 message_index);
+
+	/*******************************************************************************
+	** @brief The number of transactions, ordered by their first message,
+	**        including the discarded ones.
+	*/
+	U64 GetTransactionCount() const;
+
+	/*******************************************************************************
+	** @brief Get a transaction.
+	**
+	** @param transaction_index - Index of the transaction.
+	** @param transaction - Receives the transaction.
+	**
+	** @return false if the index is out of range.
+	*/
+	bool GetTransaction(U64 transaction_index, AbccTransaction_t* transaction) const;
+
+	/*******************************************************************************
+	** @brief Find the transaction a message is part of.
+	**
+	** @param message_index - Index of the message in the message table.
+	**
+	** @return The index of the transaction, INVALID_TRANSACTION_INDEX if the
+	**         message was not correlated yet.
+	*/
+	U64 GetMessageTransaction(U64 message_index) const;
+
+protected: // Members
+
+	mutable std::mutex mMutex;
+	std::vector<AbccTransaction_t> mTransactions;
+	U64 mFirstTransactionIndex;		// Of mTransactions[0]
+	std::vector<U64> malMessageTransactions;
+	U64 mFirstMessageIndex;			// Of malMessageTransactions[0]
+
+	// The discarded transactions the source IDs still refer to
+	std::map<U64, AbccTransaction_t> mRetained;
+
+	// Indexed by the channel and source ID of the command
+	U64 malOutstanding[NUM_DATA_CHANNELS][256];
+	U64 malAnswered[NUM_DATA_CHANNELS][256];
+
+protected: // Methods
+
+	void AddCommand(U64 message_index, const AbccMessage_t& message);
+	void AddResponse(U64 message_index, const AbccMessage_t& message);
+	U64 AddTransaction(const AbccTransaction_t& transaction);
+	AbccTransaction_t* FindTransaction(U64 transaction_index);
+	const AbccTransaction_t* FindTransaction(U64 transaction_index) const;
+	bool IsReferenced(U64 transaction_index, const AbccTransaction_t& transaction) const;
+	void ResetSourceIds();
+};
+
+#endif /* ABCC_TRANSACTION_INDEX_H */
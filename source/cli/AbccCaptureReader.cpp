@@ -0,0 +1,551 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccCaptureReader.cpp
+**    Summary: Streams the digital transitions of a capture exported from Logic
+**             and presents them to the SPI acquisition with the forward-only
+**             interface of the Logic SDK's channel data.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "AbccCaptureReader.h"
+
+#define CSV_READ_BUFFER_SIZE		( 1 << 20 )
+#define CSV_TAIL_SIZE				( 1 << 12 )
+#define CSV_SEEK_SCAN_SIZE			( 1 << 16 )
+#define BINARY_TRANSITION_BATCH		( 1 << 16 )
+
+#define BINARY_IDENTIFIER			"<SALEAE>"
+#define BINARY_IDENTIFIER_SIZE		8
+#define BINARY_SUPPORTED_VERSION	0
+#define BINARY_TYPE_DIGITAL			0
+
+// Each source is read by a single thread, skip the locking of the stdio
+// routines, which otherwise dominates parsing when decoding in parallel.
+#if defined(_WIN32)
+#define READ_CHAR(file)				_fgetc_nolock(file)
+#else
+#define READ_CHAR(file)				getc_unlocked(file)
+#endif
+
+static BitState ToggleState(BitState state)
+{
+	return (state == BitState::BIT_HIGH) ? BitState::BIT_LOW : BitState::BIT_HIGH;
+}
+
+static bool SeekFile(FILE* file, S64 offset)
+{
+#if defined(_WIN32)
+	return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+	return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+static S64 TellFile(FILE* file)
+{
+#if defined(_WIN32)
+	return _ftelli64(file);
+#else
+	return (S64)ftello(file);
+#endif
+}
+
+static S64 GetFileSize(FILE* file)
+{
+#if defined(_WIN32)
+	_fseeki64(file, 0, SEEK_END);
+#else
+	fseeko(file, 0, SEEK_END);
+#endif
+
+	return TellFile(file);
+}
+
+std::unique_ptr<CaptureTransitionSource> OpenCaptureSource(const std::string& input, bool binary, S32 channel)
+{
+	std::unique_ptr<CaptureTransitionSource> source;
+	std::string file = input;
+
+	if (binary)
+	{
+		file += "/digital_" + std::to_string(channel) + ".bin";
+		source.reset(new BinaryTransitionSource());
+	}
+	else
+	{
+		source.reset(new CsvTransitionSource());
+	}
+
+	if (!source->Open(file.c_str(), (U32)channel))
+	{
+		fprintf(stderr, "Failed to read channel %d from %s\n", channel, file.c_str());
+		source.reset();
+	}
+
+	return source;
+}
+
+S64 GetSampleFromTime(double time_s, U32 sample_rate, U64 trigger_sample)
+{
+	return (S64)llround(time_s * (double)sample_rate) + (S64)trigger_sample;
+}
+
+CsvTransitionSource::CsvTransitionSource()
+	: mFile(nullptr),
+	mReadBuffer(CSV_READ_BUFFER_SIZE),
+	mColumn(0),
+	mState(BitState::BIT_LOW),
+	mBeginTime(0.0),
+	mEndTime(0.0),
+	mDataOffset(0),
+	mFileSize(0)
+{
+}
+
+CsvTransitionSource::~CsvTransitionSource()
+{
+	if (mFile != nullptr)
+	{
+		fclose(mFile);
+	}
+}
+
+bool CsvTransitionSource::Open(const char* file, U32 channel)
+{
+	double time;
+	BitState state;
+	S64 offset;
+
+	// Binary mode, the file is positioned by byte offsets
+	mFile = fopen(file, "rb");
+
+	if (mFile == nullptr)
+	{
+		return false;
+	}
+
+	setvbuf(mFile, mReadBuffer.data(), _IOFBF, mReadBuffer.size());
+
+	// The first data column follows the time column
+	mColumn = channel + 1;
+
+	// Skip the header row, the first data row holds the initial states
+	SkipToNextRow();
+	mDataOffset = TellFile(mFile);
+
+	if (!ReadRow(&mBeginTime, &mState))
+	{
+		return false;
+	}
+
+	// The last row holds the time of the last transition of any channel
+	offset = TellFile(mFile);
+	mFileSize = GetFileSize(mFile);
+	mEndTime = mBeginTime;
+
+	if (mFileSize - CSV_TAIL_SIZE > offset)
+	{
+		SeekFile(mFile, mFileSize - CSV_TAIL_SIZE);
+		SkipToNextRow();
+	}
+	else
+	{
+		SeekFile(mFile, offset);
+	}
+
+	while (ReadRow(&time, &state))
+	{
+		mEndTime = time;
+	}
+
+	return SeekFile(mFile, offset);
+}
+
+bool CsvTransitionSource::SkipToNextRow()
+{
+	int c;
+
+	do
+	{
+		c = READ_CHAR(mFile);
+	} while ((c != EOF) && (c != '\n'));
+
+	return (c != EOF);
+}
+
+bool CsvTransitionSource::ReadRow(double* time_s, BitState* state)
+{
+	const char* field;
+	char* end;
+
+	mLine.clear();
+
+	for (int c = READ_CHAR(mFile); (c != EOF) && (c != '\n'); c = READ_CHAR(mFile))
+	{
+		mLine.push_back((char)c);
+	}
+
+	if (mLine.empty())
+	{
+		return false;
+	}
+
+	field = mLine.c_str();
+	*time_s = strtod(field, &end);
+
+	if (end == field)
+	{
+		return false;
+	}
+
+	for (U32 column = 0; column < mColumn; column++)
+	{
+		field = strchr(field, ',');
+
+		if (field == nullptr)
+		{
+			return false;
+		}
+
+		field++;
+	}
+
+	while (*field == ' ')
+	{
+		field++;
+	}
+
+	*state = (*field == '1') ? BitState::BIT_HIGH : BitState::BIT_LOW;
+	return true;
+}
+
+BitState CsvTransitionSource::GetInitialState()
+{
+	return mState;
+}
+
+double CsvTransitionSource::GetBeginTime()
+{
+	return mBeginTime;
+}
+
+double CsvTransitionSource::GetEndTime()
+{
+	return mEndTime;
+}
+
+bool CsvTransitionSource::SeekToTime(double time_s)
+{
+	S64 lowOffset = mDataOffset;
+	S64 highOffset = mFileSize;
+	S64 rowOffset;
+	double time;
+	BitState state;
+
+	// Bisect the file down to a range small enough to be scanned row by row.
+	// The low offset is always the start of a row at or before the time.
+	while (highOffset - lowOffset > CSV_SEEK_SCAN_SIZE)
+	{
+		S64 middleOffset = lowOffset + (highOffset - lowOffset) / 2;
+
+		if (!SeekFile(mFile, middleOffset))
+		{
+			return false;
+		}
+
+		SkipToNextRow();
+		rowOffset = TellFile(mFile);
+
+		if (ReadRow(&time, &state) && (time <= time_s))
+		{
+			lowOffset = rowOffset;
+		}
+		else
+		{
+			highOffset = middleOffset;
+		}
+	}
+
+	if (!SeekFile(mFile, lowOffset) || !ReadRow(&time, &mState))
+	{
+		return false;
+	}
+
+	for (;;)
+	{
+		rowOffset = TellFile(mFile);
+
+		if (!ReadRow(&time, &state))
+		{
+			return true;
+		}
+
+		if (time > time_s)
+		{
+			// Continue with the first row after the time
+			return SeekFile(mFile, rowOffset);
+		}
+
+		mState = state;
+	}
+}
+
+bool CsvTransitionSource::ReadTransition(double* time_s)
+{
+	BitState state;
+
+	// Rows are added for changes of any channel, skip to the next change of this one
+	while (ReadRow(time_s, &state))
+	{
+		if (state != mState)
+		{
+			mState = state;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+BinaryTransitionSource::BinaryTransitionSource()
+	: mFile(nullptr),
+	mTransitions(BINARY_TRANSITION_BATCH),
+	mTransitionIndex(0),
+	mTransitionCount(0),
+	mRemainingTransitions(0),
+	mTotalTransitions(0),
+	mTransitionsOffset(0),
+	mCaptureInitialState(BitState::BIT_LOW),
+	mInitialState(BitState::BIT_LOW),
+	mBeginTime(0.0),
+	mEndTime(0.0)
+{
+}
+
+BinaryTransitionSource::~BinaryTransitionSource()
+{
+	if (mFile != nullptr)
+	{
+		fclose(mFile);
+	}
+}
+
+bool BinaryTransitionSource::Open(const char* file, U32 channel)
+{
+	char identifier[BINARY_IDENTIFIER_SIZE];
+	S32 version;
+	S32 type;
+	U32 initialState;
+
+	// Each channel is exported to a file of its own
+	(void)channel;
+
+	mFile = fopen(file, "rb");
+
+	if (mFile == nullptr)
+	{
+		return false;
+	}
+
+	if ((fread(identifier, sizeof(identifier), 1, mFile) != 1) ||
+		(memcmp(identifier, BINARY_IDENTIFIER, BINARY_IDENTIFIER_SIZE) != 0) ||
+		(fread(&version, sizeof(version), 1, mFile) != 1) ||
+		(fread(&type, sizeof(type), 1, mFile) != 1) ||
+		(version != BINARY_SUPPORTED_VERSION) ||
+		(type != BINARY_TYPE_DIGITAL))
+	{
+		return false;
+	}
+
+	if ((fread(&initialState, sizeof(initialState), 1, mFile) != 1) ||
+		(fread(&mBeginTime, sizeof(mBeginTime), 1, mFile) != 1) ||
+		(fread(&mEndTime, sizeof(mEndTime), 1, mFile) != 1) ||
+		(fread(&mTotalTransitions, sizeof(mTotalTransitions), 1, mFile) != 1))
+	{
+		return false;
+	}
+
+	mTransitionsOffset = TellFile(mFile);
+	mRemainingTransitions = mTotalTransitions;
+	mCaptureInitialState = (initialState != 0) ? BitState::BIT_HIGH : BitState::BIT_LOW;
+	mInitialState = mCaptureInitialState;
+	return true;
+}
+
+BitState BinaryTransitionSource::GetInitialState()
+{
+	return mInitialState;
+}
+
+double BinaryTransitionSource::GetBeginTime()
+{
+	return mBeginTime;
+}
+
+double BinaryTransitionSource::GetEndTime()
+{
+	return mEndTime;
+}
+
+bool BinaryTransitionSource::SeekToTime(double time_s)
+{
+	U64 lowIndex = 0;
+	U64 highIndex = mTotalTransitions;
+	double time;
+
+	// Bisect the sorted transition times for the first one after the time
+	while (lowIndex < highIndex)
+	{
+		U64 middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+
+		if (!SeekFile(mFile, mTransitionsOffset + (S64)(middleIndex * sizeof(double))) ||
+			(fread(&time, sizeof(time), 1, mFile) != 1))
+		{
+			return false;
+		}
+
+		if (time <= time_s)
+		{
+			lowIndex = middleIndex + 1;
+		}
+		else
+		{
+			highIndex = middleIndex;
+		}
+	}
+
+	mInitialState = ((lowIndex & 1) != 0) ? ToggleState(mCaptureInitialState) : mCaptureInitialState;
+	mRemainingTransitions = mTotalTransitions - lowIndex;
+	mTransitionIndex = 0;
+	mTransitionCount = 0;
+
+	return SeekFile(mFile, mTransitionsOffset + (S64)(lowIndex * sizeof(double)));
+}
+
+bool BinaryTransitionSource::ReadTransition(double* time_s)
+{
+	if (mTransitionIndex == mTransitionCount)
+	{
+		size_t batch = mTransitions.size();
+
+		if (mRemainingTransitions < batch)
+		{
+			batch = (size_t)mRemainingTransitions;
+		}
+
+		mTransitionIndex = 0;
+		mTransitionCount = fread(mTransitions.data(), sizeof(double), batch, mFile);
+		mRemainingTransitions -= mTransitionCount;
+
+		if (mTransitionCount == 0)
+		{
+			return false;
+		}
+	}
+
+	*time_s = mTransitions[mTransitionIndex++];
+	return true;
+}
+
+CaptureChannelData::CaptureChannelData(std::unique_ptr<CaptureTransitionSource> source, U32 sample_rate, U64 trigger_sample, U64 start_sample)
+	: mSource(std::move(source)),
+	mSampleRate(sample_rate),
+	mTriggerSample(trigger_sample),
+	mSample(start_sample),
+	mState(mSource->GetInitialState()),
+	mNextEdge(0),
+	mNextEdgeValid(false)
+{
+	ReadNextEdge();
+}
+
+void CaptureChannelData::ReadNextEdge()
+{
+	double time;
+
+	mNextEdgeValid = false;
+
+	while (mSource->ReadTransition(&time))
+	{
+		S64 sample = GetSampleFromTime(time, mSampleRate, mTriggerSample);
+
+		if ((sample > 0) && ((U64)sample > mSample))
+		{
+			mNextEdge = (U64)sample;
+			mNextEdgeValid = true;
+			break;
+		}
+
+		// Transitions closer than one sample are merged into the current sample
+		mState = ToggleState(mState);
+	}
+}
+
+U64 CaptureChannelData::GetSampleNumber()
+{
+	return mSample;
+}
+
+BitState CaptureChannelData::GetBitState()
+{
+	return mState;
+}
+
+U32 CaptureChannelData::AdvanceToAbsPosition(U64 sample)
+{
+	U32 transitionCount = 0;
+
+	while (mNextEdgeValid && (mNextEdge <= sample))
+	{
+		mSample = mNextEdge;
+		mState = ToggleState(mState);
+		transitionCount++;
+		ReadNextEdge();
+	}
+
+	if (sample > mSample)
+	{
+		mSample = sample;
+	}
+
+	return transitionCount;
+}
+
+void CaptureChannelData::AdvanceToNextEdge()
+{
+	if (!mNextEdgeValid)
+	{
+		throw CaptureEndException();
+	}
+
+	mSample = mNextEdge;
+	mState = ToggleState(mState);
+	ReadNextEdge();
+}
+
+U64 CaptureChannelData::GetSampleOfNextEdge()
+{
+	if (!mNextEdgeValid)
+	{
+		throw CaptureEndException();
+	}
+
+	return mNextEdge;
+}
+
+bool CaptureChannelData::WouldAdvancingToAbsPositionCauseTransition(U64 sample)
+{
+	return mNextEdgeValid && (mNextEdge <= sample);
+}
+
+bool CaptureChannelData::DoMoreTransitionsExistInCurrentData()
+{
+	return mNextEdgeValid;
+}
@@ -0,0 +1,221 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccCaptureReader.h
+**    Summary: Streams the digital transitions of a capture exported from Logic
+**             and presents them to the SPI acquisition with the forward-only
+**             interface of the Logic SDK's channel data.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_CAPTURE_READER_H
+#define ABCC_CAPTURE_READER_H
+
+#include <stdio.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "LogicPublicTypes.h"
+
+/*
+** @brief Thrown when the acquisition needs an edge beyond the end of the
+**        capture. Within Logic, the channel data would instead wait for more
+**        samples to be captured.
+*/
+class CaptureEndException
+{
+};
+
+/*
+** @brief Reads the transitions of one digital channel from an exported file.
+*/
+class CaptureTransitionSource
+{
+public:
+
+	virtual ~CaptureTransitionSource() {}
+
+	/*******************************************************************************
+	** @brief Open the file and read the initial state of the channel.
+	**
+	** @param file - Path of the exported file.
+	** @param channel - The channel (CSV column) to read.
+	**
+	** @return true if the file could be opened and is of the expected format.
+	*/
+	virtual bool Open(const char* file, U32 channel) = 0;
+
+	/*******************************************************************************
+	** @brief The state of the channel at the start of the capture, or at the
+	**        time of the last SeekToTime().
+	*/
+	virtual BitState GetInitialState() = 0;
+
+	/*******************************************************************************
+	** @brief The time of the start of the capture in seconds, relative to the
+	**        trigger.
+	*/
+	virtual double GetBeginTime() = 0;
+
+	/*******************************************************************************
+	** @brief The time of the end of the capture in seconds, relative to the
+	**        trigger.
+	*/
+	virtual double GetEndTime() = 0;
+
+	/*******************************************************************************
+	** @brief Continue reading from a point in the capture. The initial state
+	**        becomes the state at that time, and reading continues with the
+	**        first transition after it.
+	**
+	** @param time_s - The time in seconds, relative to the trigger.
+	**
+	** @return false if the file could not be positioned.
+	*/
+	virtual bool SeekToTime(double time_s) = 0;
+
+	/*******************************************************************************
+	** @brief Read the time of the next transition.
+	**
+	** @param time_s - Receives the time of the transition in seconds.
+	**
+	** @return false if there are no more transitions.
+	*/
+	virtual bool ReadTransition(double* time_s) = 0;
+};
+
+/*
+** @brief Transitions from a CSV export of the digital channels. The file has
+**        one header row, followed by rows of a time stamp and the state of
+**        each channel, one row for every change of any of the channels.
+*/
+class CsvTransitionSource : public CaptureTransitionSource
+{
+public:
+
+	CsvTransitionSource();
+	virtual ~CsvTransitionSource();
+
+	virtual bool Open(const char* file, U32 channel);
+	virtual BitState GetInitialState();
+	virtual double GetBeginTime();
+	virtual double GetEndTime();
+	virtual bool SeekToTime(double time_s);
+	virtual bool ReadTransition(double* time_s);
+
+protected:
+
+	FILE* mFile;
+	std::vector<char> mReadBuffer;
+	std::string mLine;
+	U32 mColumn;
+	BitState mState;
+	double mBeginTime;
+	double mEndTime;
+	S64 mDataOffset;
+	S64 mFileSize;
+
+	bool ReadRow(double* time_s, BitState* state);
+	bool SkipToNextRow();
+};
+
+/*
+** @brief Transitions from a Logic 2 binary export of one digital channel.
+*/
+class BinaryTransitionSource : public CaptureTransitionSource
+{
+public:
+
+	BinaryTransitionSource();
+	virtual ~BinaryTransitionSource();
+
+	virtual bool Open(const char* file, U32 channel);
+	virtual BitState GetInitialState();
+	virtual double GetBeginTime();
+	virtual double GetEndTime();
+	virtual bool SeekToTime(double time_s);
+	virtual bool ReadTransition(double* time_s);
+
+protected:
+
+	FILE* mFile;
+	std::vector<double> mTransitions;
+	size_t mTransitionIndex;
+	size_t mTransitionCount;
+	U64 mRemainingTransitions;
+	U64 mTotalTransitions;
+	S64 mTransitionsOffset;
+	BitState mCaptureInitialState;
+	BitState mInitialState;
+	double mBeginTime;
+	double mEndTime;
+};
+
+/*******************************************************************************
+** @brief Open the transitions of a channel of an exported capture.
+**
+** @param input - The CSV file, or the directory of the binary export.
+** @param binary - true if the input is a binary export.
+** @param channel - The channel to read.
+**
+** @return The source, or an empty pointer if the channel could not be read.
+*/
+std::unique_ptr<CaptureTransitionSource> OpenCaptureSource(const std::string& input, bool binary, S32 channel);
+
+/*******************************************************************************
+** @brief Convert a time of the capture to a sample number.
+**
+** @param time_s - The time in seconds, relative to the trigger.
+** @param sample_rate - The sample rate of the capture.
+** @param trigger_sample - The sample which corresponds to the time 0.
+**
+** @return The nearest sample, negative for times before the capture.
+*/
+S64 GetSampleFromTime(double time_s, U32 sample_rate, U64 trigger_sample);
+
+/*
+** @brief Forward-only access to the samples of one channel, equivalent to the
+**        subset of the Logic SDK's AnalyzerChannelData used by the acquisition.
+*/
+class CaptureChannelData
+{
+public:
+
+	/*******************************************************************************
+	** @param source - The opened transitions of the channel.
+	** @param sample_rate - The sample rate of the capture.
+	** @param trigger_sample - The sample which corresponds to the time 0.
+	** @param start_sample - The sample corresponding to the initial state of
+	**                      the source, 0 unless the source was positioned
+	**                      with SeekToTime().
+	*/
+	CaptureChannelData(std::unique_ptr<CaptureTransitionSource> source, U32 sample_rate, U64 trigger_sample, U64 start_sample);
+
+	U64 GetSampleNumber();
+	BitState GetBitState();
+
+	U32 AdvanceToAbsPosition(U64 sample);
+	void AdvanceToNextEdge();
+
+	U64 GetSampleOfNextEdge();
+	bool WouldAdvancingToAbsPositionCauseTransition(U64 sample);
+	bool DoMoreTransitionsExistInCurrentData();
+
+protected:
+
+	std::unique_ptr<CaptureTransitionSource> mSource;
+	U32 mSampleRate;
+	U64 mTriggerSample;
+
+	U64 mSample;
+	BitState mState;
+	U64 mNextEdge;
+	bool mNextEdgeValid;
+
+	void ReadNextEdge();
+};
+
+#endif /* ABCC_CAPTURE_READER_H */
@@ -0,0 +1,505 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccParallelDecoder.cpp
+**    Summary: Splits an exported capture into chunks at chip select (or 3-wire
+**             idle) boundaries and decodes the chunks on a pool of threads.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <thread>
+
+#include "AbccParallelDecoder.h"
+
+// Chunks per worker thread, smaller chunks balance the load between workers
+#define CHUNKS_PER_JOB				4
+
+// Longest chunk in seconds of capture, bounds the memory held per chunk
+#define MAX_CHUNK_TIME				1.0
+
+// Chunks decoded ahead of the merge per worker thread
+#define CHUNK_WINDOW_PER_JOB		2
+
+// Packet boundaries at which the speculative decoder state is recorded
+#define MAX_CHUNK_CHECKPOINTS		64
+
+static U64 AppendFrameData(ChunkResult_t* result, const U8* data, U32 length)
+{
+	U64 offset = result->abFrameData.size();
+
+	result->abFrameData.insert(result->abFrameData.end(), data, data + length);
+	return offset;
+}
+
+/*
+** @brief Records the frames and packet boundaries of a chunk.
+*/
+class ChunkOutput : public AbccDecoderSink, public AbccAcquisitionSink
+{
+public:
+
+	ChunkOutput(SpiAcquisition<CaptureChannelData>* acquisition, ChunkResult_t* result)
+		: mAcquisition(acquisition),
+		mResult(result),
+		mPacketEnded(false)
+	{
+	}
+
+	virtual void OnFrame(const AbccFrame_t& frame)
+	{
+		mResult->asFrames.push_back(frame);
+	}
+
+	virtual U64 OnFrameData(const U8* data, U32 length)
+	{
+		return AppendFrameData(mResult, data, length);
+	}
+
+	virtual void OnPacketEnd(PacketType mosi_packet_type, PacketType miso_packet_type)
+	{
+		ChunkPacketEnd_t packetEnd;
+
+		packetEnd.lFrameCount = mResult->asFrames.size();
+		packetEnd.eMosiPacketType = mosi_packet_type;
+		packetEnd.eMisoPacketType = miso_packet_type;
+		mResult->asPacketEnds.push_back(packetEnd);
+		mPacketEnded = true;
+
+		if (mosi_packet_type != PacketType::Cancel)
+		{
+			// Check if any additional clocks appear on SCLK before enable goes inactive
+			mAcquisition->CheckForIdleAfterPacket();
+		}
+	}
+
+	virtual void OnMarker(U64 sample, AcquisitionMarker marker, AcquisitionChannel channel)
+	{
+		// Markers have no representation in the exports
+		(void)sample;
+		(void)marker;
+		(void)channel;
+	}
+
+	bool TakePacketEnded()
+	{
+		bool packetEnded = mPacketEnded;
+
+		mPacketEnded = false;
+		return packetEnded;
+	}
+
+protected:
+
+	SpiAcquisition<CaptureChannelData>* mAcquisition;
+	ChunkResult_t* mResult;
+	bool mPacketEnded;
+};
+
+ParallelDecoder::ParallelDecoder(const ParallelDecodeConfig_t& config)
+	: mConfig(config),
+	mResetState(),
+	mReconciledCount(0),
+	mNextChunk(0),
+	mMergedCount(0)
+{
+	AbccDecoder decoder;
+
+	decoder.Reset();
+	decoder.GetState(&mResetState);
+}
+
+bool ParallelDecoder::FindBoundary(double time_s, ChunkBoundary_t* boundary)
+{
+	const SpiAcquisitionConfig_t& acquisitionConfig = mConfig.sAcquisition;
+	AcquisitionChannel framingChannel = acquisitionConfig.fPure4WireMode ? AcquisitionChannel::Enable : AcquisitionChannel::Clock;
+	std::unique_ptr<CaptureTransitionSource> source;
+	BitState state;
+	double time;
+	double previousTime;
+
+	source = OpenCaptureSource(mConfig.sInput, mConfig.fBinaryInput, mConfig.aiChannels[(U32)framingChannel]);
+
+	if (!source || !source->SeekToTime(time_s))
+	{
+		return false;
+	}
+
+	if (acquisitionConfig.fPure4WireMode)
+	{
+		// The first deassertion of CS (active low) ends a transaction
+		state = source->GetInitialState();
+
+		while (source->ReadTransition(&time))
+		{
+			state = (state == BitState::BIT_HIGH) ? BitState::BIT_LOW : BitState::BIT_HIGH;
+
+			if (state == BitState::BIT_HIGH)
+			{
+				boundary->dTime = time;
+				boundary->lSample = (U64)GetSampleFromTime(time, mConfig.dwSampleRate, mConfig.lTriggerSample);
+				return true;
+			}
+		}
+	}
+	else if (source->ReadTransition(&previousTime))
+	{
+		// The last clock edge before an idle gap ends a transaction
+		while (source->ReadTransition(&time))
+		{
+			S64 previousSample = GetSampleFromTime(previousTime, mConfig.dwSampleRate, mConfig.lTriggerSample);
+			S64 sample = GetSampleFromTime(time, mConfig.dwSampleRate, mConfig.lTriggerSample);
+
+			if ((U64)(sample - previousSample) >= acquisitionConfig.lPacketGapSamples)
+			{
+				boundary->dTime = previousTime;
+				boundary->lSample = (U64)previousSample;
+				return true;
+			}
+
+			previousTime = time;
+		}
+	}
+
+	return false;
+}
+
+bool ParallelDecoder::Prepare()
+{
+	std::unique_ptr<CaptureTransitionSource> clock;
+	ChunkBoundary_t boundary;
+	double beginTime;
+	double endTime;
+	size_t chunkCount;
+
+	mBoundaries.clear();
+
+	// Without CS there is no way to tell where a 4-wire transaction ends
+	if ((mConfig.dwJobs <= 1) || mConfig.sAcquisition.f4WireOn3Channels)
+	{
+		return false;
+	}
+
+	clock = OpenCaptureSource(mConfig.sInput, mConfig.fBinaryInput, mConfig.aiChannels[(U32)AcquisitionChannel::Clock]);
+
+	if (!clock)
+	{
+		return false;
+	}
+
+	beginTime = clock->GetBeginTime();
+	endTime = clock->GetEndTime();
+	chunkCount = (size_t)mConfig.dwJobs * CHUNKS_PER_JOB;
+
+	if ((endTime - beginTime) / chunkCount > MAX_CHUNK_TIME)
+	{
+		chunkCount = (size_t)((endTime - beginTime) / MAX_CHUNK_TIME) + 1;
+	}
+
+	// Split at the first boundary after each nominal chunk start, chunks
+	// without a boundary of their own are merged into the previous chunk.
+	for (size_t chunk = 1; chunk < chunkCount; chunk++)
+	{
+		double time = beginTime + (endTime - beginTime) * chunk / chunkCount;
+
+		if (!mBoundaries.empty() && (time <= mBoundaries.back().dTime))
+		{
+			continue;
+		}
+
+		if (!FindBoundary(time, &boundary))
+		{
+			break;
+		}
+
+		if (boundary.lSample > 0)
+		{
+			mBoundaries.push_back(boundary);
+		}
+	}
+
+	return !mBoundaries.empty();
+}
+
+void ParallelDecoder::DecodeChunk(size_t chunk, const AbccDecoderState_t* initial_state, const ChunkResult_t* speculative, ChunkResult_t* result)
+{
+	std::unique_ptr<CaptureChannelData> channels[(U32)AcquisitionChannel::SizeOfEnum];
+	SpiAcquisition<CaptureChannelData> acquisition;
+	AbccDecoder decoder;
+	ChunkOutput output(&acquisition, result);
+	AbccTransfer_t transfer;
+	size_t checkpointIndex = 0;
+	U64 transferCount = 0;
+	U64 startSample = (chunk > 0) ? mBoundaries[chunk - 1].lSample : 0;
+	U64 endSample = (chunk < mBoundaries.size()) ? mBoundaries[chunk].lSample : (U64)-1;
+
+	for (U32 i = 0; i < (U32)AcquisitionChannel::SizeOfEnum; i++)
+	{
+		std::unique_ptr<CaptureTransitionSource> source;
+
+		if (mConfig.aiChannels[i] < 0)
+		{
+			continue;
+		}
+
+		source = OpenCaptureSource(mConfig.sInput, mConfig.fBinaryInput, mConfig.aiChannels[i]);
+
+		if (source && (chunk > 0))
+		{
+			// The state at the boundary includes the boundary's own transition
+			if (!source->SeekToTime(mBoundaries[chunk - 1].dTime))
+			{
+				source.reset();
+			}
+		}
+
+		if (!source)
+		{
+			// Decoded as an empty chunk, the sequential pass reports the error
+			decoder.GetState(&result->sEndState);
+			return;
+		}
+
+		channels[i].reset(new CaptureChannelData(std::move(source), mConfig.dwSampleRate, mConfig.lTriggerSample, startSample));
+	}
+
+	CaptureChannelData* clock = channels[(U32)AcquisitionChannel::Clock].get();
+
+	acquisition.Setup(mConfig.sAcquisition,
+		channels[(U32)AcquisitionChannel::Mosi].get(),
+		channels[(U32)AcquisitionChannel::Miso].get(),
+		clock,
+		channels[(U32)AcquisitionChannel::Enable].get());
+	acquisition.SetSink(&output);
+	decoder.SetSink(&output);
+	decoder.SetAggregateProcessData(mConfig.fAggregateProcessData);
+	decoder.SetAggregateMessageData(mConfig.fAggregateMessageData);
+
+	if (initial_state != nullptr)
+	{
+		decoder.SetState(initial_state);
+	}
+	else
+	{
+		decoder.Reset();
+	}
+
+	try
+	{
+		acquisition.AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+
+		// Transfers that start after the boundary belong to the next chunk
+		while (clock->GetSampleNumber() < endSample)
+		{
+			if (acquisition.GetTransfer(&transfer) == GetByteStatus::Skip)
+			{
+				continue;
+			}
+
+			decoder.ProcessTransfer(&transfer);
+			transferCount++;
+
+			if (!output.TakePacketEnded())
+			{
+				continue;
+			}
+
+			ChunkCheckpoint_t checkpoint;
+
+			checkpoint.lTransferCount = transferCount;
+			checkpoint.lClockSample = clock->GetSampleNumber();
+			checkpoint.lFrameCount = result->asFrames.size();
+			checkpoint.lPacketCount = result->asPacketEnds.size();
+			decoder.GetState(&checkpoint.sState);
+
+			if (speculative == nullptr)
+			{
+				if (result->asCheckpoints.size() < MAX_CHUNK_CHECKPOINTS)
+				{
+					result->asCheckpoints.push_back(checkpoint);
+				}
+
+				continue;
+			}
+
+			// Both decodes acquire the same transfers as long as the acquisition
+			// is at the same position; once the decoder state also matches, the
+			// remaining output of the speculative decode is valid.
+			while ((checkpointIndex < speculative->asCheckpoints.size()) &&
+				(speculative->asCheckpoints[checkpointIndex].lTransferCount < transferCount))
+			{
+				checkpointIndex++;
+			}
+
+			if (checkpointIndex < speculative->asCheckpoints.size())
+			{
+				const ChunkCheckpoint_t& match = speculative->asCheckpoints[checkpointIndex];
+
+				if ((match.lTransferCount == checkpoint.lTransferCount) &&
+					(match.lClockSample == checkpoint.lClockSample) &&
+					IsSameDecoderState(match.sState, checkpoint.sState))
+				{
+					for (size_t i = (size_t)match.lFrameCount; i < speculative->asFrames.size(); i++)
+					{
+						AbccFrame_t frame = speculative->asFrames[i];
+
+						if ((frame.bFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+						{
+							U32 length = GET_AGGREGATED_FRAME_LENGTH(frame.lData1);
+							U64 offset = AppendFrameData(result, &speculative->abFrameData[(size_t)GET_AGGREGATED_FRAME_OFFSET(frame.lData1)], length);
+
+							frame.lData1 = AGGREGATED_FRAME_DATA1(offset, length);
+						}
+
+						result->asFrames.push_back(frame);
+					}
+
+					for (size_t i = (size_t)match.lPacketCount; i < speculative->asPacketEnds.size(); i++)
+					{
+						ChunkPacketEnd_t packetEnd = speculative->asPacketEnds[i];
+
+						packetEnd.lFrameCount = packetEnd.lFrameCount - match.lFrameCount + checkpoint.lFrameCount;
+						result->asPacketEnds.push_back(packetEnd);
+					}
+
+					result->sEndState = speculative->sEndState;
+					return;
+				}
+			}
+		}
+	}
+	catch (const CaptureEndException&)
+	{
+		// The last chunk ends with the capture
+	}
+
+	decoder.GetState(&result->sEndState);
+}
+
+void ParallelDecoder::WorkerThread()
+{
+	const size_t window = (size_t)mConfig.dwJobs * CHUNK_WINDOW_PER_JOB;
+
+	for (;;)
+	{
+		size_t chunk;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+
+			mChunkMerged.wait(lock, [&] { return (mNextChunk >= mResults.size()) || (mNextChunk < mMergedCount + window); });
+
+			if (mNextChunk >= mResults.size())
+			{
+				return;
+			}
+
+			chunk = mNextChunk++;
+		}
+
+		DecodeChunk(chunk, nullptr, nullptr, mResults[chunk].get());
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mResults[chunk]->fDone = true;
+		}
+
+		mChunkDone.notify_all();
+	}
+}
+
+void ParallelDecoder::ReplayFrame(const ChunkResult_t* result, size_t frame_index, AbccDecoderSink* sink)
+{
+	AbccFrame_t frame = result->asFrames[frame_index];
+
+	if ((frame.bFlags & SPI_AGGREGATED_FRAME_FLAG) != 0)
+	{
+		// The bytes are handed to the sink, the frame refers to its copy
+		U32 length = GET_AGGREGATED_FRAME_LENGTH(frame.lData1);
+		U64 offset = sink->OnFrameData(&result->abFrameData[(size_t)GET_AGGREGATED_FRAME_OFFSET(frame.lData1)], length);
+
+		frame.lData1 = AGGREGATED_FRAME_DATA1(offset, length);
+	}
+
+	sink->OnFrame(frame);
+}
+
+void ParallelDecoder::ReplayChunk(const ChunkResult_t* result, AbccDecoderSink* sink)
+{
+	size_t frameIndex = 0;
+
+	for (const ChunkPacketEnd_t& packetEnd : result->asPacketEnds)
+	{
+		for (; frameIndex < packetEnd.lFrameCount; frameIndex++)
+		{
+			ReplayFrame(result, frameIndex, sink);
+		}
+
+		sink->OnPacketEnd(packetEnd.eMosiPacketType, packetEnd.eMisoPacketType);
+	}
+
+	// Frames of a packet left open at the boundary continue in the next chunk
+	for (; frameIndex < result->asFrames.size(); frameIndex++)
+	{
+		ReplayFrame(result, frameIndex, sink);
+	}
+}
+
+void ParallelDecoder::Run(AbccDecoderSink* sink)
+{
+	std::vector<std::thread> workers;
+	AbccDecoderState_t state = mResetState;
+
+	mResults.clear();
+	mNextChunk = 0;
+	mMergedCount = 0;
+	mReconciledCount = 0;
+
+	for (size_t chunk = 0; chunk < GetChunkCount(); chunk++)
+	{
+		mResults.emplace_back(new ChunkResult_t());
+		mResults.back()->fDone = false;
+	}
+
+	for (U32 i = 0; i < mConfig.dwJobs; i++)
+	{
+		workers.emplace_back(&ParallelDecoder::WorkerThread, this);
+	}
+
+	// Merge the chunks in order, reconciling the state each was entered with
+	for (size_t chunk = 0; chunk < mResults.size(); chunk++)
+	{
+		std::unique_ptr<ChunkResult_t> result;
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mChunkDone.wait(lock, [&] { return mResults[chunk]->fDone; });
+			result = std::move(mResults[chunk]);
+		}
+
+		if (!IsSameDecoderState(state, mResetState))
+		{
+			std::unique_ptr<ChunkResult_t> reconciled(new ChunkResult_t());
+
+			DecodeChunk(chunk, &state, result.get(), reconciled.get());
+			result = std::move(reconciled);
+			mReconciledCount++;
+		}
+
+		ReplayChunk(result.get(), sink);
+		state = result->sEndState;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mMergedCount = chunk + 1;
+		}
+
+		mChunkMerged.notify_all();
+	}
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccParallelDecoder.h
+**    Summary: Splits an exported capture into chunks at chip select (or 3-wire
+**             idle) boundaries and decodes the chunks on a pool of threads.
+**
+*******************************************************************************
+******************************************************************************/
+
+#ifndef ABCC_PARALLEL_DECODER_H
+#define ABCC_PARALLEL_DECODER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "AbccCaptureReader.h"
+#include "AbccDecoder.h"
+#include "AbccSpiAcquisition.h"
+
+typedef struct ParallelDecodeConfig
+{
+	std::string sInput;
+	bool fBinaryInput;
+	U32 dwSampleRate;
+	U64 lTriggerSample;
+	S32 aiChannels[(U32)AcquisitionChannel::SizeOfEnum];	// Negative if not captured
+	SpiAcquisitionConfig_t sAcquisition;
+	U32 dwJobs;
+	bool fAggregateProcessData;
+	bool fAggregateMessageData;
+} ParallelDecodeConfig_t;
+
+/* A packet boundary, the capture is split at the transition ending the
+** transaction: CS deasserting, or the clock edge preceding a 3-wire idle gap */
+typedef struct ChunkBoundary
+{
+	double dTime;
+	U64 lSample;
+} ChunkBoundary_t;
+
+/* Decoder state after a transfer that ended a packet */
+typedef struct ChunkCheckpoint
+{
+	U64 lTransferCount;
+	U64 lClockSample;
+	U64 lFrameCount;
+	U64 lPacketCount;
+	AbccDecoderState_t sState;
+} ChunkCheckpoint_t;
+
+typedef struct ChunkPacketEnd
+{
+	U64 lFrameCount;	// Frames of the chunk preceding the end of the packet
+	PacketType eMosiPacketType;
+	PacketType eMisoPacketType;
+} ChunkPacketEnd_t;
+
+/* The decoder output of one chunk, replayed in capture order */
+typedef struct ChunkResult
+{
+	std::vector<AbccFrame_t> asFrames;
+	std::vector<U8> abFrameData;		// Bytes of the aggregated frames
+	std::vector<ChunkPacketEnd_t> asPacketEnds;
+	std::vector<ChunkCheckpoint_t> asCheckpoints;
+	AbccDecoderState_t sEndState;
+	bool fDone;
+} ChunkResult_t;
+
+/*
+** @brief Decodes the chunks of a capture concurrently.
+**
+** Apart from the acquisition, which restarts at each boundary, the only state
+** carried across packets is the decoder state (message fragmentation, toggle
+** bit, last network time...). Each chunk is therefore decoded speculatively
+** from the reset state, and the decoder state is recorded at its first packet
+** boundaries. When the chunks are merged in order, a chunk that was entered
+** with a different state is decoded again from the actual state, until it
+** reaches a packet boundary with the same state as the speculative decode.
+** The output from that point on is taken from the speculative decode.
+*/
+class ParallelDecoder
+{
+public:
+
+	ParallelDecoder(const ParallelDecodeConfig_t& config);
+
+	/*******************************************************************************
+	** @brief Find the boundaries at which the capture is split.
+	**
+	** @return false if the capture cannot be split, e.g. there is no CS and no
+	**         idle detection (4-wire on 3 channels).
+	*/
+	bool Prepare();
+
+	/*******************************************************************************
+	** @brief Decode the capture, the sink receives the frames and packets in
+	**        capture order, as if decoded sequentially.
+	**
+	** @param sink - The output of the merged decode.
+	*/
+	void Run(AbccDecoderSink* sink);
+
+	/*******************************************************************************
+	** @brief The number of chunks the capture was split into.
+	*/
+	size_t GetChunkCount() const
+	{
+		return mBoundaries.size() + 1;
+	}
+
+	/*******************************************************************************
+	** @brief The number of chunks that had to be decoded again when merged.
+	*/
+	U32 GetReconciledCount() const
+	{
+		return mReconciledCount;
+	}
+
+protected: // Members
+
+	ParallelDecodeConfig_t mConfig;
+	std::vector<ChunkBoundary_t> mBoundaries;
+	std::vector<std::unique_ptr<ChunkResult_t>> mResults;
+	AbccDecoderState_t mResetState;
+	U32 mReconciledCount;
+
+	// Workers do not run ahead of the merge by more than a window of chunks
+	std::mutex mMutex;
+	std::condition_variable mChunkDone;
+	std::condition_variable mChunkMerged;
+	size_t mNextChunk;
+	size_t mMergedCount;
+
+protected: // Methods
+
+	bool FindBoundary(double time_s, ChunkBoundary_t* boundary);
+
+	void WorkerThread();
+
+	void DecodeChunk(size_t chunk, const AbccDecoderState_t* initial_state, const ChunkResult_t* speculative, ChunkResult_t* result);
+
+	void ReplayFrame(const ChunkResult_t* result, size_t frame_index, AbccDecoderSink* sink);
+	void ReplayChunk(const ChunkResult_t* result, AbccDecoderSink* sink);
+};
+
+#endif /* ABCC_PARALLEL_DECODER_H */
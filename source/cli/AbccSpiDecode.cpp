@@ -0,0 +1,715 @@
+/******************************************************************************
+**  Copyright (C) 2015-2021 HMS Industrial Networks Inc, all rights reserved
+*******************************************************************************
+**
+**       File: AbccSpiDecode.cpp
+**    Summary: Offline batch decoder. Runs the acquisition and protocol state
+**             machines of the plugin on a capture exported from Logic and
+**             writes the same CSV exports as the plugin.
+**
+*******************************************************************************
+******************************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AbccByteArena.h"
+#include "AbccCaptureReader.h"
+#include "AbccDecoder.h"
+#include "AbccMessageTable.h"
+#include "AbccParallelDecoder.h"
+#include "AbccProcessDataFilter.h"
+#include "AbccTransactionIndex.h"
+#include "AbccSpiAcquisition.h"
+#include "AbccSpiAnalyzerExport.h"
+
+typedef struct DecodeOptions
+{
+	std::string sInput;
+	bool fBinaryInput;
+	U32 dwSampleRate;
+	S32 iMosiChannel;
+	S32 iMisoChannel;
+	S32 iClockChannel;
+	S32 iEnableChannel;
+	bool f3WireOn4Channels;
+	bool f4WireOn3Channels;
+	bool fWordMode;
+	bool fExpandBitFrames;
+	S32 iClockingAlertLimit;
+	S32 i3WirePacketGapNs;
+	S32 i3WireMaxClockIdleNs;
+	U32 dwJobs;
+	bool fAggregateProcessData;
+	bool fAggregateMessageData;
+	bool fProcessDataChangesOnly;
+	U32 dwProcessDataKeyframeInterval;
+	U32 dwNetworkType;
+	std::string sDelimiter;
+	DisplayBase eDisplayBase;
+	TimestampIndexing eJitterFilter;
+	U32 dwJitterNominalCycleNs;
+	U32 dwJitterThresholdNs;
+	std::string asExportFiles[(U32)ExportType::SizeOfEnum];
+} DecodeOptions_t;
+
+/*
+** @brief Collects the frames of the current packet and streams each completed
+**        packet to the exports, assigning packet IDs the way Logic does.
+**
+** The messages are only reassembled when an export uses them. The messages
+** and their transactions are only kept until the packet completing them was
+** exported, so the memory used does not grow with the capture.
+*/
+class DecodeOutput : public AbccDecoderSink, public AbccAcquisitionSink
+{
+public:
+
+	DecodeOutput()
+		: mAcquisition(nullptr),
+		mTrackMessages(false),
+		mPacketCount(0),
+		mFrameCount(0)
+	{
+		mMessages.SetFrameData(&mFrameData);
+	}
+
+	void SetAcquisition(SpiAcquisition<CaptureChannelData>* acquisition)
+	{
+		mAcquisition = acquisition;
+	}
+
+	void SetTrackMessages(bool track_messages)
+	{
+		mTrackMessages = track_messages;
+	}
+
+	void AddExport(std::unique_ptr<SpiAnalyzerExport> exporter)
+	{
+		exporter->SetFrameData(&mFrameData);
+
+		if (mTrackMessages)
+		{
+			exporter->SetTransactions(&mMessages, &mTransactions);
+		}
+
+		mExports.push_back(std::move(exporter));
+	}
+
+	virtual void OnFrame(const AbccFrame_t& frame)
+	{
+		Frame resultFrame;
+
+		resultFrame.mStartingSampleInclusive = frame.lStartingSampleInclusive;
+		resultFrame.mEndingSampleInclusive = frame.lEndingSampleInclusive;
+		resultFrame.mData1 = frame.lData1;
+		resultFrame.mData2 = frame.lData2;
+		resultFrame.mType = frame.bType;
+		resultFrame.mFlags = frame.bFlags;
+
+		mPacketFrames.push_back(resultFrame);
+
+		if (mTrackMessages)
+		{
+			mMessages.AddFrame(frame, mFrameCount);
+		}
+
+		mFrameCount++;
+	}
+
+	virtual U64 OnFrameData(const U8* data, U32 length)
+	{
+		return mFrameData.Append(data, length);
+	}
+
+	virtual void OnPacketEnd(PacketType mosi_packet_type, PacketType miso_packet_type)
+	{
+		(void)miso_packet_type;
+
+		if (mosi_packet_type == PacketType::Cancel)
+		{
+			// The frames remain, but are not part of a packet
+			if (mTrackMessages)
+			{
+				mMessages.EndPacket(INVALID_RESULT_INDEX, true);
+			}
+
+			WritePacket(INVALID_RESULT_INDEX);
+		}
+		else
+		{
+			// Empty packets are not committed
+			if (!mPacketFrames.empty())
+			{
+				if (mTrackMessages)
+				{
+					mMessages.EndPacket(mPacketCount, false);
+					mTransactions.Update(mMessages);
+				}
+
+				WritePacket(mPacketCount++);
+			}
+
+			// Check if any additional clocks appear on SCLK before enable goes inactive,
+			// the parallel decoder checks this while decoding each chunk
+			if (mAcquisition != nullptr)
+			{
+				mAcquisition->CheckForIdleAfterPacket();
+			}
+		}
+	}
+
+	virtual void OnMarker(U64 sample, AcquisitionMarker marker, AcquisitionChannel channel)
+	{
+		// Markers have no representation in the exports
+		(void)sample;
+		(void)marker;
+		(void)channel;
+	}
+
+	void Finish()
+	{
+		// Frames of an incomplete packet at the end of the capture
+		WritePacket(INVALID_RESULT_INDEX);
+
+		for (auto& exporter : mExports)
+		{
+			exporter->End();
+		}
+	}
+
+	U64 GetPacketCount() const
+	{
+		return mPacketCount;
+	}
+
+	U64 GetFrameCount() const
+	{
+		return mFrameCount;
+	}
+
+	U64 GetMessageCount() const
+	{
+		return mMessages.GetMessageCount();
+	}
+
+	U64 GetTransactionCount() const
+	{
+		return mTransactions.GetTransactionCount();
+	}
+
+protected:
+
+	SpiAcquisition<CaptureChannelData>* mAcquisition;
+	std::vector<std::unique_ptr<SpiAnalyzerExport>> mExports;
+	std::vector<Frame> mPacketFrames;
+	AbccByteArena mFrameData;	// Bytes of the aggregated frames of the current packet
+	AbccMessageTable mMessages;
+	AbccTransactionIndex mTransactions;
+	bool mTrackMessages;
+	U64 mPacketCount;
+	U64 mFrameCount;
+
+	void WritePacket(U64 packet_id)
+	{
+		if (mPacketFrames.empty())
+		{
+			return;
+		}
+
+		for (auto& exporter : mExports)
+		{
+			exporter->AddPacket(packet_id, mPacketFrames.data(), mPacketFrames.size());
+		}
+
+		mPacketFrames.clear();
+		mFrameData.Clear();
+
+		DiscardMessages();
+	}
+
+	void DiscardMessages()
+	{
+		U64 messageCount = mMessages.GetMessageCount();
+		AbccTransaction_t transaction;
+
+		// A transaction is complete with its response, which is the last
+		// message of the transaction to be exported
+		for (U64 i = mMessages.GetFirstMessageIndex(); i < messageCount; i++)
+		{
+			if (mTransactions.GetTransaction(mTransactions.GetMessageTransaction(i), &transaction) &&
+				(transaction.lResponseMessage == i))
+			{
+				for (auto& exporter : mExports)
+				{
+					exporter->AddTransaction(transaction);
+				}
+			}
+		}
+
+		// The transactions hold what the latency export needs of their messages
+		mMessages.DiscardMessages(messageCount);
+		mTransactions.Discard(mTransactions.GetTransactionCount(), messageCount);
+	}
+};
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr,
+		"Usage: %s [options] <capture>\n"
+		"\n"
+		"Decodes the ABCC SPI protocol of a capture exported from Logic.\n"
+		"<capture> is either a CSV export of the digital channels, or a directory\n"
+		"with the Logic 2 binary export (digital_<channel>.bin) of each channel.\n"
+		"\n"
+		"Options:\n"
+		"  --sample-rate <Hz>          Sample rate of the capture (required)\n"
+		"  --mosi <channel>            MOSI channel (default 0)\n"
+		"  --miso <channel>            MISO channel (default 1)\n"
+		"  --clock <channel>           SCLK channel (default 2)\n"
+		"  --enable <channel>          CS channel, omit for 3-wire mode\n"
+		"  --3wire-on-4-channels       Ignore CS for framing (3-wire protocol)\n"
+		"  --4wire-on-3-channels       4-wire protocol, CS was not captured\n"
+		"  --word-mode                 Acquire 16-bit transfers\n"
+		"  --packet-gap-ns <ns>        3-wire idle gap between packets (default 10000)\n"
+		"  --clock-idle-ns <ns>        3-wire maximum clock idle time (default 5000)\n"
+		"  --clocking-alert-limit <n>  Maximum clocking errors reported (default -1, no limit)\n"
+		"  --jobs <n>                  Decode chunks of the capture on n threads (default 1)\n"
+		"  --aggregate-process-data    One frame per process data block instead of per byte\n"
+		"  --aggregate-message-data    One frame per run of message data instead of per byte\n"
+		"  --pd-changes-only           Only changed process data produces frames and rows\n"
+		"  --pd-keyframes <n>          Full process data image every n images (default 1000)\n"
+		"  --network-type <index>      Network type used to name instances\n"
+		"  --display-base <base>       bin, dec, hex (default), ascii, or asciihex\n"
+		"  --delimiter <char>          CSV delimiter of the exports (default ,)\n"
+		"  --frames <file>             Export all frames\n"
+		"  --message-data <file>       Export the message data\n"
+		"  --process-data <file>       Export the process data\n"
+		"  --latency <file>            Export the command latency statistics\n"
+		"  --jitter <file>             Export the network time jitter analysis\n"
+		"  --jitter-filter <packets>   all (default), wrpdvalid, or newrdpd\n"
+		"  --nominal-cycle-ns <ns>     Nominal network cycle (default 0, estimate)\n"
+		"  --jitter-threshold-ns <ns>  Outlier threshold (default 0, 10%% of the cycle)\n",
+		name);
+}
+
+static bool ParseDisplayBase(const char* value, DisplayBase* display_base)
+{
+	if (strcmp(value, "bin") == 0)
+	{
+		*display_base = DisplayBase::Binary;
+	}
+	else if (strcmp(value, "dec") == 0)
+	{
+		*display_base = DisplayBase::Decimal;
+	}
+	else if (strcmp(value, "hex") == 0)
+	{
+		*display_base = DisplayBase::Hexadecimal;
+	}
+	else if (strcmp(value, "ascii") == 0)
+	{
+		*display_base = DisplayBase::ASCII;
+	}
+	else if (strcmp(value, "asciihex") == 0)
+	{
+		*display_base = DisplayBase::AsciiHex;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+static bool ParseJitterFilter(const char* value, TimestampIndexing* filter)
+{
+	if (strcmp(value, "all") == 0)
+	{
+		*filter = TimestampIndexing::AllPackets;
+	}
+	else if (strcmp(value, "wrpdvalid") == 0)
+	{
+		*filter = TimestampIndexing::WriteProcessDataValid;
+	}
+	else if (strcmp(value, "newrdpd") == 0)
+	{
+		*filter = TimestampIndexing::NewReadProcessData;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+static bool ParseOptions(int argc, char* argv[], DecodeOptions_t* options)
+{
+	options->fBinaryInput = false;
+	options->dwSampleRate = 0;
+	options->iMosiChannel = 0;
+	options->iMisoChannel = 1;
+	options->iClockChannel = 2;
+	options->iEnableChannel = -1;
+	options->f3WireOn4Channels = false;
+	options->f4WireOn3Channels = false;
+	options->fWordMode = false;
+	options->fExpandBitFrames = true;
+	options->iClockingAlertLimit = -1;
+	options->i3WirePacketGapNs = 10000;
+	options->i3WireMaxClockIdleNs = 5000;
+	options->dwJobs = 1;
+	options->fAggregateProcessData = false;
+	options->fAggregateMessageData = false;
+	options->fProcessDataChangesOnly = false;
+	options->dwProcessDataKeyframeInterval = 1000;
+	options->dwNetworkType = 0;
+	options->sDelimiter = ",";
+	options->eDisplayBase = DisplayBase::Hexadecimal;
+	options->eJitterFilter = TimestampIndexing::AllPackets;
+	options->dwJitterNominalCycleNs = 0;
+	options->dwJitterThresholdNs = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg(argv[i]);
+		const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+		bool hasValue = true;
+
+		if (arg == "--3wire-on-4-channels")
+		{
+			options->f3WireOn4Channels = true;
+			hasValue = false;
+		}
+		else if (arg == "--4wire-on-3-channels")
+		{
+			options->f4WireOn3Channels = true;
+			hasValue = false;
+		}
+		else if (arg == "--word-mode")
+		{
+			options->fWordMode = true;
+			hasValue = false;
+		}
+		else if (arg == "--aggregate-process-data")
+		{
+			options->fAggregateProcessData = true;
+			hasValue = false;
+		}
+		else if (arg == "--aggregate-message-data")
+		{
+			options->fAggregateMessageData = true;
+			hasValue = false;
+		}
+		else if (arg == "--pd-changes-only")
+		{
+			options->fProcessDataChangesOnly = true;
+			hasValue = false;
+		}
+		else if ((arg.compare(0, 2, "--") != 0) && options->sInput.empty())
+		{
+			options->sInput = arg;
+			hasValue = false;
+		}
+		else if (value == nullptr)
+		{
+			return false;
+		}
+		else if (arg == "--sample-rate")
+		{
+			options->dwSampleRate = (U32)strtoul(value, nullptr, 10);
+		}
+		else if (arg == "--mosi")
+		{
+			options->iMosiChannel = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--miso")
+		{
+			options->iMisoChannel = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--clock")
+		{
+			options->iClockChannel = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--enable")
+		{
+			options->iEnableChannel = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--packet-gap-ns")
+		{
+			options->i3WirePacketGapNs = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--clock-idle-ns")
+		{
+			options->i3WireMaxClockIdleNs = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--clocking-alert-limit")
+		{
+			options->iClockingAlertLimit = (S32)strtol(value, nullptr, 10);
+		}
+		else if (arg == "--jobs")
+		{
+			options->dwJobs = (U32)strtoul(value, nullptr, 10);
+		}
+		else if (arg == "--pd-keyframes")
+		{
+			options->dwProcessDataKeyframeInterval = (U32)strtoul(value, nullptr, 10);
+		}
+		else if (arg == "--network-type")
+		{
+			options->dwNetworkType = (U32)strtoul(value, nullptr, 10);
+		}
+		else if (arg == "--display-base")
+		{
+			if (!ParseDisplayBase(value, &options->eDisplayBase))
+			{
+				return false;
+			}
+		}
+		else if (arg == "--delimiter")
+		{
+			options->sDelimiter.assign(value, 1);
+		}
+		else if (arg == "--frames")
+		{
+			options->asExportFiles[(U32)ExportType::Frames] = value;
+		}
+		else if (arg == "--message-data")
+		{
+			options->asExportFiles[(U32)ExportType::MessageData] = value;
+		}
+		else if (arg == "--process-data")
+		{
+			options->asExportFiles[(U32)ExportType::ProcessData] = value;
+		}
+		else if (arg == "--latency")
+		{
+			options->asExportFiles[(U32)ExportType::Latency] = value;
+		}
+		else if (arg == "--jitter")
+		{
+			options->asExportFiles[(U32)ExportType::Jitter] = value;
+		}
+		else if (arg == "--jitter-filter")
+		{
+			if (!ParseJitterFilter(value, &options->eJitterFilter))
+			{
+				return false;
+			}
+		}
+		else if (arg == "--nominal-cycle-ns")
+		{
+			options->dwJitterNominalCycleNs = (U32)strtoul(value, nullptr, 10);
+		}
+		else if (arg == "--jitter-threshold-ns")
+		{
+			options->dwJitterThresholdNs = (U32)strtoul(value, nullptr, 10);
+		}
+		else
+		{
+			return false;
+		}
+
+		if (hasValue)
+		{
+			i++;
+		}
+	}
+
+	if (options->sInput.empty() || (options->dwSampleRate == 0))
+	{
+		return false;
+	}
+
+	// A directory is expected to contain the binary export of each channel
+	options->fBinaryInput = (options->sInput.size() < 4) ||
+		(options->sInput.compare(options->sInput.size() - 4, 4, ".csv") != 0);
+
+	return true;
+}
+
+static U64 GetSamplesFromNs(S32 time_ns, U32 sample_rate)
+{
+	const U64 nsPerSecond = 1000000000ULL;
+
+	// Round up, equivalent to the conversion made by the plugin
+	return (((U64)time_ns * sample_rate) + nsPerSecond - 1) / nsPerSecond;
+}
+
+int main(int argc, char* argv[])
+{
+	DecodeOptions_t options;
+	std::unique_ptr<CaptureTransitionSource> sources[(U32)AcquisitionChannel::SizeOfEnum];
+	std::unique_ptr<CaptureChannelData> channels[(U32)AcquisitionChannel::SizeOfEnum];
+	S32 channelNumbers[(U32)AcquisitionChannel::SizeOfEnum];
+	SpiAcquisitionConfig_t config;
+	SpiAcquisition<CaptureChannelData> acquisition;
+	AbccDecoder decoder;
+	AbccProcessDataFilter filter;
+	DecodeOutput output;
+	AbccTransfer_t transfer;
+	U64 triggerSample;
+	double beginTime;
+
+	if (!ParseOptions(argc, argv, &options))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	channelNumbers[(U32)AcquisitionChannel::Mosi] = options.iMosiChannel;
+	channelNumbers[(U32)AcquisitionChannel::Miso] = options.iMisoChannel;
+	channelNumbers[(U32)AcquisitionChannel::Clock] = options.iClockChannel;
+	channelNumbers[(U32)AcquisitionChannel::Enable] = options.iEnableChannel;
+
+	for (U32 i = 0; i < (U32)AcquisitionChannel::SizeOfEnum; i++)
+	{
+		if (channelNumbers[i] >= 0)
+		{
+			sources[i] = OpenCaptureSource(options.sInput, options.fBinaryInput, channelNumbers[i]);
+
+			if (!sources[i])
+			{
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	// Sample 0 is the start of the capture, times are relative to the trigger
+	beginTime = sources[(U32)AcquisitionChannel::Clock]->GetBeginTime();
+	triggerSample = (beginTime < 0.0) ? (U64)llround(-beginTime * options.dwSampleRate) : 0;
+
+	for (U32 i = 0; i < (U32)AcquisitionChannel::SizeOfEnum; i++)
+	{
+		if (sources[i])
+		{
+			channels[i].reset(new CaptureChannelData(std::move(sources[i]), options.dwSampleRate, triggerSample, 0));
+		}
+	}
+
+	output.SetTrackMessages(
+		!options.asExportFiles[(U32)ExportType::MessageData].empty() ||
+		!options.asExportFiles[(U32)ExportType::Latency].empty());
+
+	for (U32 i = 0; i < (U32)ExportType::SizeOfEnum; i++)
+	{
+		if (!options.asExportFiles[i].empty())
+		{
+			std::unique_ptr<SpiAnalyzerExport> exporter(new SpiAnalyzerExport(
+				static_cast<ExportType>(i),
+				options.eDisplayBase,
+				options.sDelimiter,
+				options.dwNetworkType,
+				options.dwSampleRate,
+				triggerSample));
+
+			exporter->SetJitterOptions(options.eJitterFilter, options.dwJitterNominalCycleNs, options.dwJitterThresholdNs);
+			exporter->SetProcessDataChangesOnly(options.fProcessDataChangesOnly);
+			exporter->Start(options.asExportFiles[i].c_str());
+			output.AddExport(std::move(exporter));
+		}
+	}
+
+	// The process data is filtered in capture order, after the chunks are merged
+	filter.SetSink(&output);
+	filter.Configure(options.fProcessDataChangesOnly, options.dwProcessDataKeyframeInterval);
+
+	CaptureChannelData* enable = channels[(U32)AcquisitionChannel::Enable].get();
+
+	config.f3WireMode = ((enable == nullptr) && !options.f4WireOn3Channels) || options.f3WireOn4Channels;
+	config.fPure4WireMode = (enable != nullptr) && !options.f3WireOn4Channels;
+	config.f4WireOn3Channels = options.f4WireOn3Channels;
+	config.fWordMode = options.fWordMode;
+	config.fBitMarkers = false;
+	config.fExpandBitFrames = options.fExpandBitFrames;
+	config.iClockingAlertLimit = options.iClockingAlertLimit;
+	config.lPacketGapSamples = GetSamplesFromNs(options.i3WirePacketGapNs, options.dwSampleRate);
+	config.lMaxClockIdleSamples = GetSamplesFromNs(options.i3WireMaxClockIdleNs, options.dwSampleRate);
+
+	if (options.dwJobs > 1)
+	{
+		ParallelDecodeConfig_t parallelConfig;
+
+		parallelConfig.sInput = options.sInput;
+		parallelConfig.fBinaryInput = options.fBinaryInput;
+		parallelConfig.dwSampleRate = options.dwSampleRate;
+		parallelConfig.lTriggerSample = triggerSample;
+		parallelConfig.sAcquisition = config;
+		parallelConfig.dwJobs = options.dwJobs;
+		parallelConfig.fAggregateProcessData = options.fAggregateProcessData;
+		parallelConfig.fAggregateMessageData = options.fAggregateMessageData;
+
+		for (U32 i = 0; i < (U32)AcquisitionChannel::SizeOfEnum; i++)
+		{
+			parallelConfig.aiChannels[i] = channelNumbers[i];
+		}
+
+		ParallelDecoder parallel(parallelConfig);
+
+		if (parallel.Prepare())
+		{
+			parallel.Run(&filter);
+			filter.Flush();
+			output.Finish();
+
+			fprintf(stderr, "Decoded %llu frames in %llu packets, %llu messages in %llu transactions (%llu chunks, %u reconciled)\n",
+				(unsigned long long)output.GetFrameCount(),
+				(unsigned long long)output.GetPacketCount(),
+				(unsigned long long)output.GetMessageCount(),
+				(unsigned long long)output.GetTransactionCount(),
+				(unsigned long long)parallel.GetChunkCount(),
+				parallel.GetReconciledCount());
+
+			return EXIT_SUCCESS;
+		}
+
+		fprintf(stderr, "No packet boundaries to split the capture at, decoding sequentially\n");
+	}
+
+	acquisition.Setup(config,
+		channels[(U32)AcquisitionChannel::Mosi].get(),
+		channels[(U32)AcquisitionChannel::Miso].get(),
+		channels[(U32)AcquisitionChannel::Clock].get(),
+		enable);
+	acquisition.SetSink(&output);
+	output.SetAcquisition(&acquisition);
+	decoder.SetSink(&filter);
+	decoder.SetAggregateProcessData(options.fAggregateProcessData);
+	decoder.SetAggregateMessageData(options.fAggregateMessageData);
+
+	try
+	{
+		decoder.Reset();
+		acquisition.AdvanceToActiveEnableEdgeWithCorrectClockPolarity();
+
+		for (;;)
+		{
+			// Read one SPI transfer (8 or 16 bits) at a time and run the statemachines
+			if (acquisition.GetTransfer(&transfer) != GetByteStatus::Skip)
+			{
+				decoder.ProcessTransfer(&transfer);
+			}
+		}
+	}
+	catch (const CaptureEndException&)
+	{
+		// The whole capture was decoded
+	}
+
+	filter.Flush();
+	output.Finish();
+
+	fprintf(stderr, "Decoded %llu frames in %llu packets, %llu messages in %llu transactions\n",
+		(unsigned long long)output.GetFrameCount(),
+		(unsigned long long)output.GetPacketCount(),
+		(unsigned long long)output.GetMessageCount(),
+		(unsigned long long)output.GetTransactionCount());
+
+	return EXIT_SUCCESS;
+}
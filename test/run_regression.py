@@ -0,0 +1,205 @@
+#!/usr/bin/python3
+# -*- coding: utf-8 -*-
+
+"""
+Decoder regression test. Runs the offline decoder (AbccSpiDecode) on short
+captures of the plugin's simulation and compares the exports with the expected
+(golden) exports.
+
+The captures cover the 4-wire, 3-wire, and 16-bit word mode acquisition, each
+including a retransmitted packet. The 4-wire captures also include a packet
+aborted by the master, in word mode while a message header is transferred.
+
+Each capture is decoded into all exports, and again:
+- in chunks on 4 threads (--jobs 4), which must give the same exports.
+- with aggregated process and message data frames, which must give the same
+  exports except for the frames.
+The 4-wire capture is also decoded with only changed process data presented
+(--pd-changes-only), with a full image every 4 images, on one and 4 threads.
+The simulated process data changes every packet, but not all of its bytes, so
+the filter shows in the frames export.
+
+Usage:
+    run_regression.py <AbccSpiDecode> [--update]
+
+--update replaces the golden exports with the output of the decoder, for
+changes that are meant to change the decoded output.
+"""
+
+import os
+import sys
+import difflib
+import tempfile
+import subprocess
+
+TEST_PATH = os.path.dirname(os.path.abspath(__file__))
+CAPTURE_PATH = os.path.join(TEST_PATH, "captures")
+GOLDEN_PATH = os.path.join(TEST_PATH, "golden")
+
+# The captures were simulated at this sample rate
+SAMPLE_RATE = "50000000"
+
+# Each export, as the file suffix and decoder option
+EXPORTS = {
+    "frames": {"suffix": ".frames.csv", "option": "--frames"},
+    "message_data": {"suffix": ".message_data.csv", "option": "--message-data"},
+    "process_data": {"suffix": ".process_data.csv", "option": "--process-data"},
+    "latency": {"suffix": ".latency.csv", "option": "--latency"},
+    "jitter": {"suffix": ".jitter.csv", "option": "--jitter"},
+}
+
+# The exports that do not depend on how the frames are aggregated
+AGGREGATED_EXPORTS = ["message_data", "process_data", "latency", "jitter"]
+
+# Each capture, and the decoder options matching its simulation settings
+CAPTURES = [
+    {"capture": "4wire", "options": ["--enable", "3"]},
+    {"capture": "3wire", "options": []},
+    {"capture": "4wire_word_mode", "options": ["--enable", "3", "--word-mode"]},
+]
+
+PD_CHANGES_OPTIONS = ["--enable", "3", "--pd-changes-only", "--pd-keyframes", "4"]
+
+# Each case names its exports, its capture and options, the exports compared,
+# and the name of their golden exports. The golden exports are updated from the
+# case of the same name.
+CASES = []
+
+for entry in CAPTURES:
+    CASES += [
+        {"name": entry["capture"], "capture": entry["capture"], "golden": entry["capture"],
+         "options": entry["options"], "exports": list(EXPORTS)},
+        {"name": entry["capture"] + "_jobs", "capture": entry["capture"], "golden": entry["capture"],
+         "options": entry["options"] + ["--jobs", "4"], "exports": list(EXPORTS)},
+        {"name": entry["capture"] + "_aggregated", "capture": entry["capture"], "golden": entry["capture"],
+         "options": entry["options"] + ["--aggregate-process-data", "--aggregate-message-data"],
+         "exports": AGGREGATED_EXPORTS},
+    ]
+
+CASES += [
+    {"name": "4wire_pd_changes", "capture": "4wire", "golden": "4wire_pd_changes",
+     "options": PD_CHANGES_OPTIONS, "exports": ["frames", "process_data"]},
+    {"name": "4wire_pd_changes_jobs", "capture": "4wire", "golden": "4wire_pd_changes",
+     "options": PD_CHANGES_OPTIONS + ["--jobs", "4"], "exports": ["frames", "process_data"]},
+]
+
+# Lines of a difference shown for each export that does not match
+MAX_DIFF_LINES = 40
+
+
+def _run_case(decoder: str, case: dict, output_path: str) -> bool:
+    '''
+    Decode the capture of a case into its exports.
+
+    Parameters
+    ----------
+    decoder: str
+        Path of the AbccSpiDecode executable.
+    case: dict
+        The capture, its decoder options and exports, an entry of CASES.
+    output_path: str
+        The folder the exports are written to.
+
+    Returns
+    ----------
+    bool
+        True if the decoder failed.
+    '''
+
+    command = [decoder, "--sample-rate", SAMPLE_RATE] + case["options"]
+
+    for export in case["exports"]:
+        command += [EXPORTS[export]["option"], os.path.join(output_path, case["name"] + EXPORTS[export]["suffix"])]
+
+    command.append(os.path.join(CAPTURE_PATH, case["capture"] + ".csv"))
+
+    try:
+        result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    except OSError as error:
+        print(f"ERROR: Running {decoder} failed: {error}")
+        return True
+
+    if result.returncode != 0:
+        print(f"ERROR: Decoding {case['name']} failed:\n{result.stdout}")
+        return True
+
+    return False
+
+
+def _compare_export(name: str, golden: str, output_path: str) -> bool:
+    '''
+    Compare an export with its golden file.
+
+    Parameters
+    ----------
+    name: str
+        File name of the export.
+    golden: str
+        File name of the golden export.
+    output_path: str
+        The folder the export was written to.
+
+    Returns
+    ----------
+    bool
+        True if the export differs.
+    '''
+
+    with open(os.path.join(GOLDEN_PATH, golden)) as file:
+        expected = file.read().splitlines()
+
+    with open(os.path.join(output_path, name)) as file:
+        actual = file.read().splitlines()
+
+    if expected == actual:
+        print(f"PASS: {name}")
+        return False
+
+    print(f"FAIL: {name}")
+
+    diff = difflib.unified_diff(expected, actual, "golden/" + golden, name, lineterm="")
+
+    for count, line in enumerate(diff):
+        if count == MAX_DIFF_LINES:
+            print("...")
+            break
+
+        print(line)
+
+    return True
+
+
+def _main() -> None:
+    '''
+    Run all cases, then either compare or update the golden exports.
+    '''
+
+    if len(sys.argv) < 2:
+        print(__doc__)
+        exit(True)
+
+    decoder = os.path.abspath(sys.argv[1])
+    update = "--update" in sys.argv[2:]
+    test_error = False
+
+    with tempfile.TemporaryDirectory() as output_path:
+        for case in CASES:
+            if _run_case(decoder, case, output_path):
+                test_error = True
+                continue
+
+            for export in case["exports"]:
+                name = case["name"] + EXPORTS[export]["suffix"]
+                golden = case["golden"] + EXPORTS[export]["suffix"]
+
+                if not update:
+                    test_error |= _compare_export(name, golden, output_path)
+                elif case["name"] == case["golden"]:
+                    os.replace(os.path.join(output_path, name), os.path.join(GOLDEN_PATH, golden))
+                    print(f"UPDATED: {golden}")
+
+    exit(test_error)
+
+
+if __name__ == "__main__":
+    _main()